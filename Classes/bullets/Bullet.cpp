@@ -1,4 +1,5 @@
 #include "Bullet.h"
+#include "Log.h"
 
 USING_NS_CC;
 
@@ -12,7 +13,7 @@ Bullet::Bullet()
     , current_speed(0.0f)
     , hitbox_size(Size::ZERO)
 {
-    CCLOG("Bullet created.");
+    LOG_TRACE(LIFECYCLE, "Bullet created.");
 }
 
 /**
@@ -21,12 +22,13 @@ Bullet::Bullet()
  */
 Bullet::~Bullet()
 {
-    CCLOG("Bullet destroyed.");
+    LOG_TRACE(LIFECYCLE, "Bullet destroyed.");
 }
 
 /**
  * @brief Initialization override.
- * Calls base GameObject initialization and schedules the per-frame update.
+ * Calls base GameObject initialization and activates the bullet.
+ * Bullets are not scheduled; GameWorld moves them once per frame.
  * @return true if successfully initialized.
  */
 bool Bullet::init()
@@ -37,7 +39,6 @@ bool Bullet::init()
     }
 
     is_active = true;
-    this->scheduleUpdate();
 
     return true;
 }
@@ -97,6 +98,18 @@ int Bullet::getDamage() const
     return damage;
 }
 
+/**
+ * @brief Recycling hook used by BulletPool.
+ * Subclasses reset their own per-shot state and call this implementation.
+ * @param startPos The new world coordinates for the bullet.
+ */
+void Bullet::respawn(const Vec2& startPos)
+{
+    is_active = true;
+    this->setVisible(true);
+    this->setPosition(startPos);
+}
+
 /**
  * @brief Trajectory update handler.
  * Provides a hook for subclasses to implement specific movement patterns.
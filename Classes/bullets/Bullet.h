@@ -4,6 +4,13 @@
 #include "GameObject.h"
 #include "GameDefs.h"
 
+/** @brief Concrete projectile kinds, used by BulletPool to keep one free list per type */
+enum class BulletType
+{
+    PEA,
+    PUFF
+};
+
 /**
  * @class Bullet
  * @brief Abstract base class for all projectiles fired by plants.
@@ -14,13 +21,13 @@ class Bullet : public GameObject
 public:
     /**
      * @brief Standard Cocos2d-x initialization.
-     * Sets up the update schedule and resets the active status.
+     * Resets the active status.
      * @return true if initialization was successful.
      */
     virtual bool init() override;
 
     /**
-     * @brief Frame-by-frame update logic.
+     * @brief Frame-by-frame update logic, called by GameWorld.
      * Handles movement updates and boundary checks to remove off-screen bullets.
      * @param delta Time elapsed since the last frame in seconds.
      */
@@ -45,6 +52,20 @@ public:
      */
     int getDamage() const;
 
+    /**
+     * @brief Identifies the concrete projectile type.
+     * @return The BulletType used to return this bullet to the right pool.
+     */
+    virtual BulletType getBulletType() const = 0;
+
+    /**
+     * @brief Brings a recycled bullet back into play.
+     * Reactivates the bullet, makes it visible and moves it to the start position.
+     * The texture and frame set up by init() are kept.
+     * @param startPos The new world coordinates for the bullet.
+     */
+    virtual void respawn(const cocos2d::Vec2& startPos);
+
 protected:
     /**
      * @brief Private constructor to enforce controlled instantiation.
@@ -0,0 +1,131 @@
+#include "BulletPool.h"
+#include "Pea.h"
+#include "Puff.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+BulletPool* BulletPool::instance = nullptr;
+
+BulletPool* BulletPool::getInstance()
+{
+    if (!instance)
+    {
+        instance = new (std::nothrow) BulletPool();
+    }
+    return instance;
+}
+
+BulletPool::BulletPool()
+{
+    resetStats();
+}
+
+void BulletPool::resetStats()
+{
+    stats.hits = 0;
+    stats.misses = 0;
+    stats.releases = 0;
+    stats.in_use = 0;
+    stats.peak_in_use = 0;
+}
+
+std::vector<Bullet*>& BulletPool::freeList(BulletType type)
+{
+    return type == BulletType::PUFF ? free_puffs : free_peas;
+}
+
+Bullet* BulletPool::createBullet(BulletType type)
+{
+    if (type == BulletType::PUFF)
+    {
+        return Puff::create(Vec2::ZERO);
+    }
+    return Pea::create(Vec2::ZERO);
+}
+
+void BulletPool::prewarm(int peaCount, int puffCount)
+{
+    const BulletType types[] = { BulletType::PEA, BulletType::PUFF };
+    const int counts[] = { peaCount, puffCount };
+
+    for (int t = 0; t < 2; ++t)
+    {
+        auto& list = freeList(types[t]);
+        while (static_cast<int>(list.size()) < counts[t])
+        {
+            Bullet* bullet = createBullet(types[t]);
+            if (!bullet) break;
+
+            bullet->deactivate();
+            bullet->retain();
+            list.push_back(bullet);
+        }
+    }
+}
+
+Bullet* BulletPool::acquire(BulletType type, const Vec2& startPos)
+{
+    auto& list = freeList(type);
+    Bullet* bullet = nullptr;
+
+    if (!list.empty())
+    {
+        bullet = list.back();
+        list.pop_back();
+        bullet->respawn(startPos);
+        // Hand the pool's reference over to the caller, like create() does
+        bullet->autorelease();
+        ++stats.hits;
+    }
+    else
+    {
+        bullet = createBullet(type);
+        if (!bullet) return nullptr;
+        bullet->setPosition(startPos);
+        ++stats.misses;
+    }
+
+    ++stats.in_use;
+    stats.peak_in_use = std::max(stats.peak_in_use, stats.in_use);
+    return bullet;
+}
+
+Pea* BulletPool::acquirePea(const Vec2& startPos)
+{
+    return static_cast<Pea*>(acquire(BulletType::PEA, startPos));
+}
+
+Puff* BulletPool::acquirePuff(const Vec2& startPos)
+{
+    return static_cast<Puff*>(acquire(BulletType::PUFF, startPos));
+}
+
+void BulletPool::release(Bullet* bullet)
+{
+    if (!bullet) return;
+
+    if (bullet->isActive()) bullet->deactivate();
+    bullet->retain();
+    freeList(bullet->getBulletType()).push_back(bullet);
+
+    ++stats.releases;
+    if (stats.in_use > 0) --stats.in_use;
+}
+
+void BulletPool::clear()
+{
+    CCLOG("BulletPool: hits=%ld misses=%ld releases=%ld peak=%d",
+        stats.hits, stats.misses, stats.releases, stats.peak_in_use);
+
+    for (auto list : { &free_peas, &free_puffs })
+    {
+        // Bullets still attached to an old scene are freed together with it
+        for (auto bullet : *list)
+        {
+            bullet->release();
+        }
+        list->clear();
+    }
+    stats.in_use = 0;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "cocos2d.h"
+#include "Bullet.h"
+#include <vector>
+
+class Pea;
+class Puff;
+
+/**
+ * @brief Singleton recycling pool for plant projectiles.
+ *
+ * Released bullets stay hidden under their parent instead of being removed from the
+ * scene graph, and are handed back out by acquire with their texture and frame intact.
+ * The pool holds one reference on every free bullet; an acquired bullet is returned
+ * autoreleased, exactly like Pea::create / Puff::create.
+ */
+class BulletPool
+{
+public:
+    /** @brief Hit/miss counters used to size the pool for late waves */
+    struct Stats
+    {
+        long hits;          // Acquires served from the free list
+        long misses;        // Acquires that had to create a new bullet
+        long releases;      // Bullets returned to the pool
+        int in_use;         // Bullets currently handed out
+        int peak_in_use;    // Highest in_use seen since the last reset
+    };
+
+    /** @brief Access the global bullet pool. */
+    static BulletPool* getInstance();
+
+    BulletPool(const BulletPool&) = delete;
+    BulletPool& operator=(const BulletPool&) = delete;
+
+    /**
+     * @brief Creates free bullets ahead of time so the first waves never allocate.
+     * @param peaCount Number of peas to keep ready.
+     * @param puffCount Number of puffs to keep ready.
+     */
+    void prewarm(int peaCount, int puffCount);
+
+    /** @brief Takes a pea from the pool (or creates one) positioned at startPos */
+    Pea* acquirePea(const cocos2d::Vec2& startPos);
+
+    /** @brief Takes a puff from the pool (or creates one) positioned at startPos */
+    Puff* acquirePuff(const cocos2d::Vec2& startPos);
+
+    /**
+     * @brief Returns an inactive bullet to its free list.
+     * The bullet is kept hidden and stays attached to its current parent.
+     */
+    void release(Bullet* bullet);
+
+    /** @brief Drops every free bullet, e.g. when a new game scene starts */
+    void clear();
+
+    const Stats& getStats() const { return stats; }
+    void resetStats();
+
+private:
+    BulletPool();
+    static BulletPool* instance;
+
+    std::vector<Bullet*>& freeList(BulletType type);
+    Bullet* createBullet(BulletType type);
+    Bullet* acquire(BulletType type, const cocos2d::Vec2& startPos);
+
+    std::vector<Bullet*> free_peas;
+    std::vector<Bullet*> free_puffs;
+    Stats stats;
+};
@@ -1,4 +1,5 @@
 #include "Pea.h"
+#include "Log.h"
 
 USING_NS_CC;
 
@@ -17,7 +18,7 @@ const int Pea::DEFAULT_DAMAGE = 20;
  */
 Pea::Pea()
 {
-    CCLOG("Pea created.");
+    LOG_TRACE(LIFECYCLE, "Pea created.");
 }
 
 /**
@@ -58,7 +59,7 @@ bool Pea::init()
     // Load visual asset
     if (!Sprite::initWithFile(IMAGE_FILENAME))
     {
-        CCLOG("Failed to load pea image: %s", IMAGE_FILENAME.c_str());
+        LOG_WARN(ASSETS, "Failed to load pea image: %s", IMAGE_FILENAME.c_str());
         return false;
     }
 
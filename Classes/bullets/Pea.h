@@ -30,6 +30,9 @@ public:
      */
     CREATE_FUNC(Pea);
 
+    /** @brief Pool key of this projectile */
+    virtual BulletType getBulletType() const override { return BulletType::PEA; }
+
 private:
     /**
      * @brief Private constructor.
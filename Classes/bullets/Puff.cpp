@@ -1,4 +1,5 @@
 #include "Puff.h"
+#include "Log.h"
 
 USING_NS_CC;
 
@@ -27,7 +28,7 @@ const float Puff::MAX_LIFETIME = 1.3f;
 Puff::Puff()
     : life_time(0.0f)
 {
-    CCLOG("Puff created.");
+    LOG_TRACE(LIFECYCLE, "Puff created.");
 }
 
 /**
@@ -46,7 +47,7 @@ bool Puff::init()
     // Load the texture for the puff projectile
     if (!Sprite::initWithFile(IMAGE_FILENAME))
     {
-        CCLOG("Failed to load puff image: %s", IMAGE_FILENAME.c_str());
+        LOG_WARN(ASSETS, "Failed to load puff image: %s", IMAGE_FILENAME.c_str());
         return false;
     }
 
@@ -84,6 +85,17 @@ Puff* Puff::create(const Vec2& startPos)
     }
 }
 
+/**
+ * @brief Recycling override.
+ * Restarts the lifetime so a pooled puff travels its full range again.
+ * @param startPos The new world coordinates for the bullet.
+ */
+void Puff::respawn(const Vec2& startPos)
+{
+    Bullet::respawn(startPos);
+    life_time = 0.0f;
+}
+
 /**
  * @brief Movement and lifespan management.
  * Translates the bullet horizontally and deactivates it once the range limit is reached.
@@ -30,6 +30,12 @@ public:
      */
     CREATE_FUNC(Puff);
 
+    /** @brief Pool key of this projectile */
+    virtual BulletType getBulletType() const override { return BulletType::PUFF; }
+
+    /** @brief Resets the travelled lifetime before a recycled puff is fired again */
+    virtual void respawn(const cocos2d::Vec2& startPos) override;
+
 private:
     /**
      * @brief Private constructor using member initializer list.
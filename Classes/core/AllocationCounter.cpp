@@ -0,0 +1,123 @@
+#include "AllocationCounter.h"
+
+#ifdef PVZ_BENCHMARK
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    // Constant-initialized, so they work for allocations made before main()
+    std::atomic<uint64_t> allocations(0);
+    std::atomic<uint64_t> frees(0);
+    std::atomic<uint64_t> bytes(0);
+
+    void* countedAlloc(std::size_t size)
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        bytes.fetch_add(size, std::memory_order_relaxed);
+        return std::malloc(size ? size : 1);
+    }
+
+    void countedFree(void* ptr)
+    {
+        if (!ptr) return;
+        frees.fetch_add(1, std::memory_order_relaxed);
+        std::free(ptr);
+    }
+}
+
+bool AllocationCounter::isEnabled()
+{
+    return true;
+}
+
+uint64_t AllocationCounter::getAllocations()
+{
+    return allocations.load(std::memory_order_relaxed);
+}
+
+uint64_t AllocationCounter::getFrees()
+{
+    return frees.load(std::memory_order_relaxed);
+}
+
+uint64_t AllocationCounter::getBytes()
+{
+    return bytes.load(std::memory_order_relaxed);
+}
+
+// ----------------------------------------------------
+// Global operator new/delete
+// ----------------------------------------------------
+
+void* operator new(std::size_t size)
+{
+    void* ptr = countedAlloc(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    void* ptr = countedAlloc(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return countedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return countedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    countedFree(ptr);
+}
+
+#else
+
+// Shipping builds keep the default allocators; the benchmark report shows n/a
+
+bool AllocationCounter::isEnabled()
+{
+    return false;
+}
+
+uint64_t AllocationCounter::getAllocations()
+{
+    return 0;
+}
+
+uint64_t AllocationCounter::getFrees()
+{
+    return 0;
+}
+
+uint64_t AllocationCounter::getBytes()
+{
+    return 0;
+}
+
+#endif // PVZ_BENCHMARK
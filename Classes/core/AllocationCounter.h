@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Process-wide heap allocation counters.
+ *
+ * With PVZ_BENCHMARK defined, AllocationCounter.cpp replaces the global operator new/delete with
+ * versions that bump relaxed atomic counters around malloc/free. Readings only ever grow, so code
+ * that wants the allocations of a stretch of work diffs two readings. Without it the allocators
+ * are left alone and every reading is 0.
+ */
+class AllocationCounter
+{
+public:
+    /** @brief True if the build counts allocations (PVZ_BENCHMARK) */
+    static bool isEnabled();
+
+    /** @brief Calls to operator new / new[] so far */
+    static uint64_t getAllocations();
+
+    /** @brief Calls to operator delete / delete[] with a non-null pointer so far */
+    static uint64_t getFrees();
+
+    /** @brief Bytes requested from operator new / new[] so far */
+    static uint64_t getBytes();
+};
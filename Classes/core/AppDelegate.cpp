@@ -24,6 +24,12 @@
 
 #include "AppDelegate.h"
 #include "GameMenu.h"
+#include "GameWorld.h"
+#include "Benchmark.h"
+#include "SpriteAtlas.h"
+#include "Log.h"
+#include "PlayerProfile.h"
+#include <cstdlib>
 
 // #define USE_AUDIO_ENGINE 1
 
@@ -45,6 +51,8 @@ AppDelegate::AppDelegate()
 
 AppDelegate::~AppDelegate() 
 {
+    PlayerProfile::getInstance()->compact();
+    Log::stop();
 #if USE_AUDIO_ENGINE
     AudioEngine::end();
 #endif
@@ -107,8 +115,36 @@ bool AppDelegate::applicationDidFinishLaunching() {
 
     register_all_packages();
 
+    // Game logs go through the background writer; PVZ_LOG=none,combat picks the categories to show
+    Log::setSink([](const char* line) { cocos2d::log("%s", line); });
+    Log::configure(std::getenv("PVZ_LOG"));
+    Log::start();
+
+    // Saved coins, unlocks and shop items; compacted again when the app leaves the foreground
+    PlayerProfile::getInstance()->load(FileUtils::getInstance()->getWritablePath());
+
+    // Packed atlases, if tools/atlas/pack_atlases.py was run; loose images otherwise
+    SpriteAtlas::getInstance()->loadIndex();
+
     // create a scene. it's an autorelease object
-	auto scene = GameMenu::createScene();
+	Scene* scene = nullptr;
+
+    // PVZ_BENCHMARK=<preset> runs that benchmark instead of the menu and quits when it is done
+    const char* benchmark = std::getenv("PVZ_BENCHMARK");
+    BenchmarkConfig config;
+    if (benchmark && BenchmarkConfig::getPreset(benchmark, config))
+    {
+        config.quit_when_done = true;
+        scene = GameWorld::createBenchmarkScene(config);
+    }
+    else
+    {
+        if (benchmark)
+        {
+            log("Unknown benchmark '%s'", benchmark);
+        }
+        scene = GameMenu::createScene();
+    }
 
     // run
     director->runWithScene(scene);
@@ -119,6 +155,7 @@ bool AppDelegate::applicationDidFinishLaunching() {
 // This function will be called when the app is inactive. Note, when receiving a phone call it is invoked.
 void AppDelegate::applicationDidEnterBackground() {
     Director::getInstance()->stopAnimation();
+    PlayerProfile::getInstance()->compact();
 
 #if USE_AUDIO_ENGINE
     AudioEngine::pauseAll();
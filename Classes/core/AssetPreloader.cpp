@@ -0,0 +1,194 @@
+#include "AssetPreloader.h"
+#include "SeedPacket.h"
+#include "NormalZombie.h"
+#include "FlagZombie.h"
+#include "PoleVaulter.h"
+#include "BucketHeadZombie.h"
+#include "Zomboni.h"
+#include "Gargantuar.h"
+#include "Imp.h"
+#include "SpriteAtlas.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+namespace
+{
+    // Textures every level shows or spawns regardless of the loadout
+    const char* const LEVEL_TEXTURES[] = {
+        "seedBank.png", "FlagMeterEmpty.png", "FlagMeterFull.png", "FlagMeterParts1.png",
+        "FlagMeterParts2.png", "CoinBank.png", "ShovelBack.png", "Shovel.png", "button.png",
+        "LargeWave.png", "sun_spritesheet.png", "coin_silver_dollar.png", "coin_gold_dollar.png",
+        "Diamond.png", "pea.png", "puff.png", "ice.png", "mower.png", "rake.png"
+    };
+}
+
+// ----------------------------------------------------
+// AssetManifest
+// ----------------------------------------------------
+
+void AssetManifest::add(const std::string& file)
+{
+    if (file.empty()) return;
+    if (std::find(textures.begin(), textures.end(), file) == textures.end())
+    {
+        textures.push_back(file);
+    }
+}
+
+void AssetManifest::add(const std::vector<std::string>& files)
+{
+    for (const auto& file : files)
+    {
+        add(file);
+    }
+}
+
+AssetManifest AssetManifest::forLevel(bool isNightMode, const std::vector<PlantName>& plantNames)
+{
+    AssetManifest manifest;
+    manifest.add(isNightMode ? "background2.png" : "background.png");
+    for (const char* file : LEVEL_TEXTURES)
+    {
+        manifest.add(file);
+    }
+
+    // Every type WavePlanner can put in a batch, plus the flag zombie and the Gargantuar's imp
+    const std::vector<AnimationSpec> zombieSpecLists[] = {
+        NormalZombie::getAnimationSpecs(), FlagZombie::getAnimationSpecs(),
+        PoleVaulter::getAnimationSpecs(), BucketHeadZombie::getAnimationSpecs(),
+        Zomboni::getAnimationSpecs(), Gargantuar::getAnimationSpecs(), Imp::getAnimationSpecs()
+    };
+    for (const auto& specs : zombieSpecLists)
+    {
+        for (const auto& spec : specs)
+        {
+            manifest.add(spec.file);
+        }
+    }
+
+    for (PlantName name : plantNames)
+    {
+        auto it = SeedPacket::CONFIG_TABLE.find(name);
+        if (it == SeedPacket::CONFIG_TABLE.end()) continue;
+
+        manifest.add(it->second.packetImage);
+        manifest.add(it->second.assets);
+    }
+    return manifest;
+}
+
+// ----------------------------------------------------
+// AssetPreloader
+// ----------------------------------------------------
+
+AssetPreloader* AssetPreloader::instance = nullptr;
+
+AssetPreloader* AssetPreloader::getInstance()
+{
+    if (!instance)
+    {
+        instance = new (std::nothrow) AssetPreloader();
+    }
+    return instance;
+}
+
+AssetPreloader::AssetPreloader()
+    : pending(0)
+    , loaded(0)
+    , measuring(false)
+    , time_to_ready(0.0f)
+{
+}
+
+void AssetPreloader::reset()
+{
+    loaded = 0;
+    measuring = pending > 0;
+    time_to_ready = pending == 0 ? 0.0f : -1.0f;
+    start_time = std::chrono::steady_clock::now();
+    on_ready = nullptr;
+}
+
+void AssetPreloader::preload(const AssetManifest& manifest)
+{
+    auto textureCache = Director::getInstance()->getTextureCache();
+
+    std::vector<std::string> files;
+    for (const auto& texture : manifest.textures)
+    {
+        // Packed images are fetched as their atlas pages
+        for (const auto& file : SpriteAtlas::getInstance()->getTextureFiles(texture))
+        {
+            if (std::find(files.begin(), files.end(), file) == files.end())
+            {
+                files.push_back(file);
+            }
+        }
+    }
+
+    for (const auto& file : files)
+    {
+        if (in_flight.count(file) || textureCache->getTextureForKey(file)) continue;
+        in_flight.insert(file);
+
+        if (!measuring)
+        {
+            measuring = true;
+            start_time = std::chrono::steady_clock::now();
+        }
+        ++pending;
+        time_to_ready = -1.0f;
+
+        // The callback runs on the main thread once the loader thread has decoded the image
+        textureCache->addImageAsync(file, [this, file](Texture2D* texture) {
+            onTextureLoaded(file, texture);
+        });
+    }
+}
+
+void AssetPreloader::onTextureLoaded(const std::string& file, Texture2D* texture)
+{
+    in_flight.erase(file);
+    if (texture)
+    {
+        ++loaded;
+    }
+    else
+    {
+        // The synchronous path reports it again when the sprite is created
+        CCLOG("AssetPreloader: failed to load %s", file.c_str());
+    }
+
+    if (pending > 0 && --pending == 0)
+    {
+        finish();
+    }
+}
+
+void AssetPreloader::finish()
+{
+    std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - start_time;
+    time_to_ready = measuring ? elapsed.count() : 0.0f;
+    measuring = false;
+    CCLOG("AssetPreloader: %d textures ready in %.3fs", loaded, time_to_ready);
+
+    if (on_ready)
+    {
+        // Clear first: the callback may replace the scene that owns it
+        ReadyCallback callback = on_ready;
+        on_ready = nullptr;
+        callback(time_to_ready);
+    }
+}
+
+void AssetPreloader::setReadyCallback(const ReadyCallback& callback)
+{
+    on_ready = callback;
+    if (pending == 0 && on_ready)
+    {
+        ReadyCallback ready = on_ready;
+        on_ready = nullptr;
+        ready(time_to_ready);
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "GameTypes.h"
+#include "cocos2d.h"
+#include <chrono>
+#include <functional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief List of textures one level needs before its first frame.
+ */
+struct AssetManifest
+{
+    std::vector<std::string> textures;
+
+    /** @brief Adds a texture unless it is already listed */
+    void add(const std::string& file);
+    void add(const std::vector<std::string>& files);
+
+    /**
+     * @brief Builds the manifest of a GameWorld level.
+     * Covers the lawn and HUD, suns, coins, projectiles, every zombie the wave logic can spawn
+     * and, from SeedPacket::CONFIG_TABLE, the seed packet and plant textures of the loadout.
+     * @param isNightMode Picks the night background
+     * @param plantNames The chosen loadout (may be empty to fetch only the shared assets)
+     */
+    static AssetManifest forLevel(bool isNightMode, const std::vector<PlantName>& plantNames);
+};
+
+/**
+ * @brief Decodes level textures on the TextureCache loader thread ahead of GameWorld.
+ *
+ * preload() may be called several times per session (e.g. shared assets during the intro pan,
+ * then the loadout once it is chosen); textures already cached or in flight are skipped.
+ * Time-to-ready runs from the preload() that starts an idle queue until that queue drains again.
+ */
+class AssetPreloader
+{
+public:
+    /** @brief Called on the main thread with the time-to-ready in seconds */
+    typedef std::function<void(float)> ReadyCallback;
+
+    /** @brief Access the global preloader. */
+    static AssetPreloader* getInstance();
+
+    AssetPreloader(const AssetPreloader&) = delete;
+    AssetPreloader& operator=(const AssetPreloader&) = delete;
+
+    /** @brief Starts a new measurement; loads still in flight keep counting towards it */
+    void reset();
+
+    /** @brief Queues every texture of the manifest that is not cached yet */
+    void preload(const AssetManifest& manifest);
+
+    /**
+     * @brief Sets the completion callback.
+     * Fires immediately if nothing is pending, otherwise once the last queued texture arrives.
+     */
+    void setReadyCallback(const ReadyCallback& callback);
+
+    /** @brief Drops the callback, e.g. when its owner scene goes away */
+    void cancelCallback() { on_ready = nullptr; }
+
+    bool isReady() const { return pending == 0; }
+    int getPendingCount() const { return pending; }
+    int getLoadedCount() const { return loaded; }
+
+    /** @brief Seconds the last queue took to drain, or -1 while textures are pending */
+    float getTimeToReady() const { return time_to_ready; }
+
+private:
+    AssetPreloader();
+    static AssetPreloader* instance;
+
+    void onTextureLoaded(const std::string& file, cocos2d::Texture2D* texture);
+    void finish();
+
+    std::unordered_set<std::string> in_flight;
+    int pending;
+    int loaded;
+    bool measuring;
+    float time_to_ready;
+    std::chrono::steady_clock::time_point start_time;
+    ReadyCallback on_ready;
+};
@@ -1,4 +1,5 @@
 #include "BackGround.h"
+#include "Log.h"
 #include "GameDefs.h"
 #include "cocos2d.h"
 
@@ -61,7 +62,7 @@ bool BackGround::init()
     const std::string& imageFile = is_night_mode ? NIGHT_IMAGE : DAY_IMAGE;
     if (!Sprite::initWithFile(imageFile))
     {
-        CCLOG("Failed to load background image: %s", imageFile.c_str());
+        LOG_WARN(ASSETS, "Failed to load background image: %s", imageFile.c_str());
         return false;
     }
 
@@ -93,13 +94,13 @@ bool BackGround::init()
         // Add as child with higher Z-order to stay on top of the background
         this->addChild(seedBankSprite, 1);
 
-        CCLOG("SeedBank Sprite initialized successfully.");
+        LOG_TRACE(LIFECYCLE, "SeedBank Sprite initialized successfully.");
     }
     else
     {
-        CCLOG("Error: Failed to load seed bank image: %s", SEED_BANK_IMAGE.c_str());
+        LOG_WARN(ASSETS, "Error: Failed to load seed bank image: %s", SEED_BANK_IMAGE.c_str());
     }
 
-    CCLOG("BackGround initialized successfully.");
+    LOG_TRACE(LIFECYCLE, "BackGround initialized successfully.");
     return true;
 }
\ No newline at end of file
@@ -0,0 +1,267 @@
+#include "Benchmark.h"
+#include "AllocationCounter.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+    BenchmarkReport::Percentiles percentiles(std::vector<float>& values)
+    {
+        BenchmarkReport::Percentiles out = { 0.0f, 0.0f, 0.0f, 0.0f };
+        if (values.empty()) return out;
+
+        // Nearest rank, like FrameProfiler::summarize
+        std::sort(values.begin(), values.end());
+        size_t last = values.size() - 1;
+        out.p50_ms = values[std::min(last, values.size() * 50 / 100)];
+        out.p90_ms = values[std::min(last, values.size() * 90 / 100)];
+        out.p99_ms = values[std::min(last, values.size() * 99 / 100)];
+        out.max_ms = values.back();
+        return out;
+    }
+
+    ZombieBatch makeBatch(int normal, int poleVaulter, int bucketHead, int zomboni, int gargantuar)
+    {
+        ZombieBatch batch;
+        batch.normal = normal;
+        batch.poleVaulter = poleVaulter;
+        batch.bucketHead = bucketHead;
+        batch.zomboni = zomboni;
+        batch.gargantuar = gargantuar;
+        batch.delaySec = 0.0f;
+        return batch;
+    }
+}
+
+// ----------------------------------------------------
+// BenchmarkConfig
+// ----------------------------------------------------
+
+BenchmarkConfig::BenchmarkConfig()
+    : per_row(makeBatch(0, 0, 0, 0, 0))
+    , batch_interval(2.0f)
+    , frames(3600)
+    , dt(1.0f / 60.0f)
+    , seed(1)
+    , quit_when_done(false)
+{
+}
+
+std::vector<std::string> BenchmarkConfig::getPresetNames()
+{
+    return { "gatling", "mix", "horde" };
+}
+
+bool BenchmarkConfig::getPreset(const std::string& name, BenchmarkConfig& out)
+{
+    BenchmarkConfig config;
+    config.name = name;
+
+    if (name == "gatling")
+    {
+        // Bullet-bound: a full lawn of Gatling Peas against steady buckets
+        config.columns = { PlantName::GATLINGPEA };
+        config.per_row = makeBatch(3, 0, 1, 0, 0);
+        config.batch_interval = 2.0f;
+    }
+    else if (name == "mix")
+    {
+        // Sun and three-lane fire, the late-wave day layout
+        config.columns = { PlantName::SUNFLOWER, PlantName::SUNFLOWER, PlantName::THREEPEATER };
+        config.per_row = makeBatch(2, 1, 1, 0, 0);
+        config.batch_interval = 3.0f;
+    }
+    else if (name == "horde")
+    {
+        // Zombie-bound: thin defence, walls up front and every zombie type
+        config.columns = { PlantName::REPEATER, PlantName::REPEATER, PlantName::UNKNOWN, PlantName::UNKNOWN,
+            PlantName::UNKNOWN, PlantName::UNKNOWN, PlantName::UNKNOWN, PlantName::WALLNUT, PlantName::WALLNUT };
+        config.per_row = makeBatch(6, 2, 2, 1, 1);
+        config.batch_interval = 4.0f;
+    }
+    else
+    {
+        return false;
+    }
+
+    out = config;
+    return true;
+}
+
+// ----------------------------------------------------
+// BenchmarkReport
+// ----------------------------------------------------
+
+void BenchmarkReport::reset(size_t expectedFrames)
+{
+    frames.clear();
+    frames.reserve(expectedFrames);
+}
+
+BenchmarkReport::Percentiles BenchmarkReport::getUpdatePercentiles() const
+{
+    std::vector<float> values;
+    values.reserve(frames.size());
+    for (const auto& frame : frames)
+    {
+        values.push_back(frame.update_ms);
+    }
+    return percentiles(values);
+}
+
+BenchmarkReport::Percentiles BenchmarkReport::getFramePercentiles() const
+{
+    std::vector<float> values;
+    values.reserve(frames.size());
+    for (size_t i = 1; i < frames.size(); ++i)
+    {
+        values.push_back(frames[i].frame_ms);
+    }
+    return percentiles(values);
+}
+
+FrameProfiler::Counts BenchmarkReport::getPeakCounts() const
+{
+    FrameProfiler::Counts peak = { 0, 0, 0, 0, 0, 0 };
+    for (const auto& frame : frames)
+    {
+        peak.zombies = std::max(peak.zombies, frame.counts.zombies);
+        peak.plants = std::max(peak.plants, frame.counts.plants);
+        peak.bullets = std::max(peak.bullets, frame.counts.bullets);
+        peak.suns = std::max(peak.suns, frame.counts.suns);
+        peak.coins = std::max(peak.coins, frame.counts.coins);
+        peak.ice_tiles = std::max(peak.ice_tiles, frame.counts.ice_tiles);
+    }
+    return peak;
+}
+
+void BenchmarkReport::setLastRender(uint32_t drawCalls, uint32_t childSorts, float sortMs)
+{
+    if (frames.empty()) return;
+    frames.back().draw_calls = drawCalls;
+    frames.back().child_sorts = childSorts;
+    frames.back().sort_ms = sortMs;
+}
+
+float BenchmarkReport::getAverageDrawCalls() const
+{
+    if (frames.size() < 2) return 0.0f;
+
+    uint64_t total = 0;
+    for (size_t i = 0; i + 1 < frames.size(); ++i)
+    {
+        total += frames[i].draw_calls;
+    }
+    return static_cast<float>(total) / (frames.size() - 1);
+}
+
+uint32_t BenchmarkReport::getMaxDrawCalls() const
+{
+    uint32_t most = 0;
+    for (const auto& frame : frames)
+    {
+        most = std::max(most, frame.draw_calls);
+    }
+    return most;
+}
+
+uint64_t BenchmarkReport::getTotalAllocations() const
+{
+    uint64_t total = 0;
+    for (const auto& frame : frames)
+    {
+        total += frame.allocations;
+    }
+    return total;
+}
+
+uint32_t BenchmarkReport::getMaxAllocations() const
+{
+    uint32_t most = 0;
+    for (const auto& frame : frames)
+    {
+        most = std::max(most, frame.allocations);
+    }
+    return most;
+}
+
+std::string BenchmarkReport::summarize(const BenchmarkConfig& config) const
+{
+    Percentiles update = getUpdatePercentiles();
+    Percentiles frame = getFramePercentiles();
+    FrameProfiler::Counts peak = getPeakCounts();
+    uint64_t allocations = getTotalAllocations();
+
+    uint32_t childSorts = 0;
+    float sortMs = 0.0f;
+    float maxSortMs = 0.0f;
+    for (const auto& f : frames)
+    {
+        childSorts += f.child_sorts;
+        sortMs += f.sort_ms;
+        maxSortMs = std::max(maxSortMs, f.sort_ms);
+    }
+
+    // Allocations are only counted in PVZ_BENCHMARK builds
+    char allocs[128];
+    if (AllocationCounter::isEnabled())
+    {
+        std::snprintf(allocs, sizeof(allocs), "total %llu  per frame avg %.1f  max %u",
+            static_cast<unsigned long long>(allocations),
+            frames.empty() ? 0.0 : static_cast<double>(allocations) / frames.size(), getMaxAllocations());
+    }
+    else
+    {
+        std::snprintf(allocs, sizeof(allocs), "n/a");
+    }
+
+    char text[1024];
+    std::snprintf(text, sizeof(text),
+        "benchmark %s: %d frames at dt %.4f, seed %llu\n"
+        "update ms  p50 %.3f  p90 %.3f  p99 %.3f  max %.3f\n"
+        "frame ms   p50 %.3f  p90 %.3f  p99 %.3f  max %.3f\n"
+        "peak       zombies %d  plants %d  bullets %d  suns %d  coins %d  ice %d\n"
+        "allocs     %s\n"
+        "render     draw calls avg %.1f  max %u  child sorts %u  sort ms total %.3f  max %.3f",
+        config.name.c_str(), static_cast<int>(frames.size()), config.dt, static_cast<unsigned long long>(config.seed),
+        update.p50_ms, update.p90_ms, update.p99_ms, update.max_ms,
+        frame.p50_ms, frame.p90_ms, frame.p99_ms, frame.max_ms,
+        peak.zombies, peak.plants, peak.bullets, peak.suns, peak.coins, peak.ice_tiles,
+        allocs,
+        getAverageDrawCalls(), getMaxDrawCalls(), childSorts, sortMs, maxSortMs);
+    return text;
+}
+
+bool BenchmarkReport::writeCsv(const std::string& path, const BenchmarkConfig& config) const
+{
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) return false;
+
+    std::string summary = summarize(config);
+    size_t lineStart = 0;
+    while (lineStart < summary.size())
+    {
+        size_t lineEnd = summary.find('\n', lineStart);
+        if (lineEnd == std::string::npos) lineEnd = summary.size();
+        std::fprintf(file, "# %s\n", summary.substr(lineStart, lineEnd - lineStart).c_str());
+        lineStart = lineEnd + 1;
+    }
+
+    std::fprintf(file, "frame,update_ms,frame_ms,allocations,zombies,plants,bullets,suns,coins,ice_tiles,draw_calls,child_sorts,sort_ms\n");
+    const bool countsAllocations = AllocationCounter::isEnabled();
+    for (size_t i = 0; i < frames.size(); ++i)
+    {
+        const Frame& frame = frames[i];
+        char allocations[16];
+        if (countsAllocations) std::snprintf(allocations, sizeof(allocations), "%u", frame.allocations);
+        else std::snprintf(allocations, sizeof(allocations), "n/a");
+
+        std::fprintf(file, "%d,%.4f,%.4f,%s,%d,%d,%d,%d,%d,%d,%u,%u,%.4f\n", static_cast<int>(i),
+            frame.update_ms, frame.frame_ms, allocations,
+            frame.counts.zombies, frame.counts.plants, frame.counts.bullets,
+            frame.counts.suns, frame.counts.coins, frame.counts.ice_tiles,
+            frame.draw_calls, frame.child_sorts, frame.sort_ms);
+    }
+
+    return std::fclose(file) == 0;
+}
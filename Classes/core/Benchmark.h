@@ -0,0 +1,94 @@
+#pragma once
+
+#include "FrameProfiler.h"
+#include "GameTypes.h"
+#include "WavePlanner.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Scripted load for GameWorld's benchmark mode.
+ * The lawn is planted from a column pattern, the same batch of zombies enters every row at a
+ * fixed interval, and the level runs a fixed number of frames at a fixed delta.
+ */
+struct BenchmarkConfig
+{
+    std::string name;
+    std::vector<PlantName> columns;     // Plant of each column from the house, in every row; repeats if shorter than MAX_COL (UNKNOWN leaves the cell empty)
+    ZombieBatch per_row;                // Zombies each batch sends into every row (delaySec is ignored)
+    float batch_interval;               // Seconds between batches; the first one enters at 0
+    uint32_t frames;                    // Frames to run
+    float dt;                           // Delta of every frame
+    uint64_t seed;                      // Level seed, fixed so runs are comparable
+    bool quit_when_done;                // End the application once the report is written
+
+    BenchmarkConfig();
+
+    /** @brief Built-in load by name; false if there is none */
+    static bool getPreset(const std::string& name, BenchmarkConfig& out);
+
+    static std::vector<std::string> getPresetNames();
+};
+
+/**
+ * @brief Frame times, entity counts and allocations of one benchmark run.
+ * GameWorld feeds it one frame at a time.
+ */
+class BenchmarkReport
+{
+public:
+    struct Frame
+    {
+        float update_ms;                // Scheduler pass: game logic and actions
+        float frame_ms;                 // Wall time since the previous frame, rendering included (0 for the first)
+        uint32_t allocations;           // operator new calls during the scheduler pass
+        FrameProfiler::Counts counts;   // Entities alive at the end of the frame
+        uint32_t draw_calls;            // Renderer draw calls for this frame, filled in by setLastRender (0 until then)
+        uint32_t child_sorts;           // Child lists re-sorted while drawing it
+        float sort_ms;                  // Time spent in those sorts
+    };
+
+    struct Percentiles
+    {
+        float p50_ms;
+        float p90_ms;
+        float p99_ms;
+        float max_ms;
+    };
+
+    /** @brief Drops recorded frames and reserves room for a run */
+    void reset(size_t expectedFrames);
+
+    void addFrame(const Frame& frame) { frames.push_back(frame); }
+
+    /** @brief Render numbers of the last added frame, known once it has been drawn */
+    void setLastRender(uint32_t drawCalls, uint32_t childSorts, float sortMs);
+
+    size_t getFrameCount() const { return frames.size(); }
+
+    Percentiles getUpdatePercentiles() const;
+    Percentiles getFramePercentiles() const;
+
+    /** @brief Highest count of each entity kind over the run */
+    FrameProfiler::Counts getPeakCounts() const;
+
+    /** @brief Draw calls per drawn frame (every frame but the last), average and highest */
+    float getAverageDrawCalls() const;
+    uint32_t getMaxDrawCalls() const;
+
+    uint64_t getTotalAllocations() const;
+    uint32_t getMaxAllocations() const;
+
+    /** @brief Human-readable result, several lines */
+    std::string summarize(const BenchmarkConfig& config) const;
+
+    /**
+     * @brief Writes the summary as "# " comment lines, then one CSV row per frame.
+     * @return false if the file cannot be written
+     */
+    bool writeCsv(const std::string& path, const BenchmarkConfig& config) const;
+
+private:
+    std::vector<Frame> frames;
+};
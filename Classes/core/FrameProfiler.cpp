@@ -0,0 +1,187 @@
+#include "FrameProfiler.h"
+#include <algorithm>
+#include <cstdio>
+#include <new>
+
+const int FrameProfiler::PHASE_COUNT;
+const int FrameProfiler::HISTORY;
+
+FrameProfiler* FrameProfiler::instance = nullptr;
+
+FrameProfiler* FrameProfiler::getInstance()
+{
+    if (!instance)
+    {
+        instance = new (std::nothrow) FrameProfiler();
+    }
+    return instance;
+}
+
+FrameProfiler::FrameProfiler()
+    : seed(0)
+    , published(0)
+{
+    current = Sample();
+}
+
+// ----------------------------------------------------
+// Scope
+// ----------------------------------------------------
+
+FrameProfiler::Scope::Scope(ProfilePhase phase)
+    : phase(phase)
+    , start(std::chrono::steady_clock::now())
+{
+}
+
+FrameProfiler::Scope::~Scope()
+{
+    std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    FrameProfiler::getInstance()->addTime(phase, elapsed.count());
+}
+
+// ----------------------------------------------------
+// Recording
+// ----------------------------------------------------
+
+void FrameProfiler::addTime(ProfilePhase phase, float ms)
+{
+    current.phase_ms[static_cast<int>(phase)] += ms;
+}
+
+void FrameProfiler::endFrame(const Counts& counts)
+{
+    uint64_t frame = published.load(std::memory_order_relaxed);
+
+    current.frame = frame;
+    current.counts = counts;
+    current.total_ms = 0.0f;
+    for (int i = 0; i < PHASE_COUNT; ++i)
+    {
+        current.total_ms += current.phase_ms[i];
+    }
+
+    ring[frame % HISTORY] = current;
+    published.store(frame + 1, std::memory_order_release);
+
+    current = Sample();
+}
+
+void FrameProfiler::reset()
+{
+    current = Sample();
+    published.store(0, std::memory_order_release);
+}
+
+// ----------------------------------------------------
+// Reading
+// ----------------------------------------------------
+
+void FrameProfiler::snapshot(std::vector<Sample>& out) const
+{
+    out.clear();
+
+    uint64_t end = published.load(std::memory_order_acquire);
+    uint64_t begin = end > static_cast<uint64_t>(HISTORY) ? end - HISTORY : 0;
+    for (uint64_t frame = begin; frame < end; ++frame)
+    {
+        out.push_back(ring[frame % HISTORY]);
+    }
+
+    // The writer may already be filling the slot of frame `after`, which held frame
+    // after - HISTORY; drop every frame whose slot was or may be reused while copying
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t after = published.load(std::memory_order_relaxed);
+    uint64_t oldestIntact = after + 1 > static_cast<uint64_t>(HISTORY) ? after + 1 - HISTORY : 0;
+    if (oldestIntact > begin)
+    {
+        size_t torn = static_cast<size_t>(std::min<uint64_t>(oldestIntact - begin, out.size()));
+        out.erase(out.begin(), out.begin() + torn);
+    }
+}
+
+void FrameProfiler::summarize(const std::vector<Sample>& samples, Summary out[PHASE_COUNT + 1])
+{
+    std::vector<float> values;
+    values.reserve(samples.size());
+
+    for (int phase = 0; phase <= PHASE_COUNT; ++phase)
+    {
+        values.clear();
+        for (const auto& sample : samples)
+        {
+            values.push_back(phase < PHASE_COUNT ? sample.phase_ms[phase] : sample.total_ms);
+        }
+
+        Summary& summary = out[phase];
+        if (values.empty())
+        {
+            summary.min_ms = summary.avg_ms = summary.p99_ms = 0.0f;
+            continue;
+        }
+
+        std::sort(values.begin(), values.end());
+        float sum = 0.0f;
+        for (float value : values)
+        {
+            sum += value;
+        }
+        summary.min_ms = values.front();
+        summary.avg_ms = sum / values.size();
+        summary.p99_ms = values[std::min(values.size() - 1, values.size() * 99 / 100)];
+    }
+}
+
+bool FrameProfiler::dumpCsv(const std::string& path) const
+{
+    std::vector<Sample> samples;
+    snapshot(samples);
+
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) return false;
+
+    std::fprintf(file, "# seed=%llu\n", static_cast<unsigned long long>(seed));
+    std::fprintf(file, "frame");
+    for (int phase = 0; phase < PHASE_COUNT; ++phase)
+    {
+        std::fprintf(file, ",%s_ms", getPhaseName(static_cast<ProfilePhase>(phase)));
+    }
+    std::fprintf(file, ",total_ms,zombies,plants,bullets,suns,coins,ice_tiles\n");
+
+    for (const auto& sample : samples)
+    {
+        std::fprintf(file, "%llu", static_cast<unsigned long long>(sample.frame));
+        for (int phase = 0; phase < PHASE_COUNT; ++phase)
+        {
+            std::fprintf(file, ",%.4f", sample.phase_ms[phase]);
+        }
+        std::fprintf(file, ",%.4f,%d,%d,%d,%d,%d,%d\n", sample.total_ms,
+            sample.counts.zombies, sample.counts.plants, sample.counts.bullets,
+            sample.counts.suns, sample.counts.coins, sample.counts.ice_tiles);
+    }
+
+    return std::fclose(file) == 0;
+}
+
+const char* FrameProfiler::getPhaseName(ProfilePhase phase)
+{
+    switch (phase)
+    {
+        case ProfilePhase::SPAWN:            return "spawn";
+        case ProfilePhase::LANE_INDEX:       return "lane_index";
+        case ProfilePhase::TIMERS:           return "timers";
+        case ProfilePhase::SEED_PACKETS:     return "seed_packets";
+        case ProfilePhase::PLANTS:           return "plants";
+        case ProfilePhase::BULLETS:          return "bullets";
+        case ProfilePhase::ZOMBIES:          return "zombies";
+        case ProfilePhase::SUNS:             return "suns";
+        case ProfilePhase::REMOVE_PLANTS:    return "remove_plants";
+        case ProfilePhase::REMOVE_ZOMBIES:   return "remove_zombies";
+        case ProfilePhase::REMOVE_BULLETS:   return "remove_bullets";
+        case ProfilePhase::REMOVE_SUNS:      return "remove_suns";
+        case ProfilePhase::REMOVE_ICE_TILES: return "remove_ice_tiles";
+        case ProfilePhase::REMOVE_COINS:     return "remove_coins";
+        case ProfilePhase::ZOMBIE_LANES:     return "zombie_lanes";
+        default:                             return "unknown";
+    }
+}
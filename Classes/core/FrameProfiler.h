@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Timed phases of GameWorld::update, in the order they run.
+ */
+enum class ProfilePhase
+{
+    SPAWN,              // Wave batches and sky suns
+    LANE_INDEX,         // LaneIndex rebuild
+    TIMERS,             // Timer wheel: lifetimes, cooldowns, ice melt
+    SEED_PACKETS,       // Cooldown shading and affordability
+    PLANTS,
+    BULLETS,
+    ZOMBIES,
+    SUNS,
+    REMOVE_PLANTS,
+    REMOVE_ZOMBIES,
+    REMOVE_BULLETS,
+    REMOVE_SUNS,
+    REMOVE_ICE_TILES,
+    REMOVE_COINS,
+    ZOMBIE_LANES,       // Zombie movement, bites and sprite write-back
+    COUNT
+};
+
+/**
+ * @brief Per-phase frame timer for GameWorld.
+ *
+ * GameWorld wraps each phase of its update in a Scope and closes the frame with endFrame(),
+ * which publishes the frame's phase times and entity counts into a fixed ring of the last
+ * HISTORY frames. The ring has a single writer (the game thread) and lock-free readers:
+ * snapshot() copies whatever was fully published and drops slots overwritten while copying.
+ * The overlay and the CSV file name live in GameWorld.
+ */
+class FrameProfiler
+{
+public:
+    static const int PHASE_COUNT = static_cast<int>(ProfilePhase::COUNT);
+    static const int HISTORY = 600;             // Ten seconds at 60 fps
+
+    /** @brief Entities alive at the end of a frame */
+    struct Counts
+    {
+        int zombies;
+        int plants;
+        int bullets;
+        int suns;
+        int coins;
+        int ice_tiles;
+    };
+
+    /** @brief One published frame */
+    struct Sample
+    {
+        uint64_t frame;
+        float phase_ms[PHASE_COUNT];
+        float total_ms;                 // Sum of the phases
+        Counts counts;
+    };
+
+    /** @brief Statistics of one phase over a snapshot */
+    struct Summary
+    {
+        float min_ms;
+        float avg_ms;
+        float p99_ms;
+    };
+
+    /** @brief Adds the lifetime of the scope to a phase of the current frame */
+    class Scope
+    {
+    public:
+        explicit Scope(ProfilePhase phase);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ProfilePhase phase;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    /** @brief Access the global profiler. */
+    static FrameProfiler* getInstance();
+
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+    /** @brief Adds time to a phase of the current frame */
+    void addTime(ProfilePhase phase, float ms);
+
+    /** @brief Publishes the current frame into the ring and starts the next one */
+    void endFrame(const Counts& counts);
+
+    /** @brief Drops the history, e.g. at level start */
+    void reset();
+
+    /** @brief Level seed written into every dump, so a run can be replayed */
+    void setSeed(uint64_t levelSeed) { seed = levelSeed; }
+    uint64_t getSeed() const { return seed; }
+
+    /**
+     * @brief Copies the published frames, oldest first.
+     * Safe to call from any thread while the game thread keeps publishing.
+     */
+    void snapshot(std::vector<Sample>& out) const;
+
+    /** @brief min/avg/p99 of every phase (index PHASE_COUNT is the frame total) */
+    static void summarize(const std::vector<Sample>& samples, Summary out[PHASE_COUNT + 1]);
+
+    /**
+     * @brief Writes a snapshot as CSV, one row per frame, after a "# seed=N" comment line.
+     * @return false if the file cannot be written
+     */
+    bool dumpCsv(const std::string& path) const;
+
+    static const char* getPhaseName(ProfilePhase phase);
+
+private:
+    FrameProfiler();
+    static FrameProfiler* instance;
+
+    uint64_t seed;
+    Sample current;
+    Sample ring[HISTORY];
+    std::atomic<uint64_t> published;    // Frames written so far; slot is frame % HISTORY
+};
@@ -1,21 +1,19 @@
 #pragma once
 #include "cocos2d.h"
+#include "GameTypes.h"
 #include <string>
 #include <functional>
+#include <vector>
 
 /**
  * @section Grid Configuration
  * Defines the dimensions and positioning of the gameplay grid.
  */
  // Individual grid cell dimensions (Width, Height)
-const cocos2d::Size CELLSIZE = cocos2d::Size(130, 120);
+const cocos2d::Size CELLSIZE = cocos2d::Size(GRID_CELL_WIDTH, GRID_CELL_HEIGHT);
 
 // World coordinates for the bottom-left corner of the grid
-const cocos2d::Vec2 GRID_ORIGIN = cocos2d::Vec2(10, 10);
-
-// Grid constraints
-const int MAX_ROW = 5;
-const int MAX_COL = 9;
+const cocos2d::Vec2 GRID_ORIGIN = cocos2d::Vec2(GRID_ORIGIN_X, GRID_ORIGIN_Y);
 
 /**
  * @section Rendering Z-Order
@@ -31,40 +29,6 @@ const int ICE_LAYER = 1;
 const int UI_LAYER = 10;        // Layer for labels, HUD, and interface elements
 const int WIN_LOSE_LAYER = 11;  // Top-most layer for endgame screens
 
-/**
- * @enum PlantCategory
- * @brief Categorizes plants based on their primary gameplay function.
- */
-enum class PlantCategory
-{
-    SUN_PRODUCING,   // Produces sun currency (e.g., Sunflower)
-    ATTACKING,       // Engages enemies via projectiles or contact (e.g., PeaShooter)
-    BOMB             // Explosive plants with area-of-effect damage (e.g., CherryBomb)
-};
-
-/**
- * @enum PlantName
- * @brief Unique identifiers for every plant species in the game.
- */
-enum class PlantName
-{
-    SUNFLOWER,
-    PEASHOOTER,
-    WALLNUT,
-    POTATOMINE,
-    REPEATER,
-    THREEPEATER,
-    CHERRYBOMB,
-    SUNSHROOM,
-    PUFFSHROOM,
-    SPIKEWEED,
-    JALAPENO,
-    TWINSUNFLOWER,
-    GATLINGPEA,
-    SPIKEROCK,
-    UNKNOWN
-};
-
 class SeedPacket;
 
 /**
@@ -83,4 +47,5 @@ struct PlantConfig {
     float cooldown;             // Time in seconds before the plant can be used again
     int sunCost;                // Amount of sun required to deploy the plant
     SeedPacketFactory factory;  // Factory method to create the specific seed packet instance
+    std::vector<std::string> assets;    // Textures the planted plant loads, preloaded before the level
 };
\ No newline at end of file
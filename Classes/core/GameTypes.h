@@ -0,0 +1,53 @@
+#pragma once
+
+/**
+ * @file GameTypes.h
+ * @brief Engine-independent game definitions.
+ * Everything here is plain C++ so that code outside the cocos2d scene graph
+ * (e.g. the headless simulator) can share it with the game.
+ */
+
+/**
+ * @section Grid Geometry
+ */
+const int MAX_ROW = 5;
+const int MAX_COL = 9;
+
+const float GRID_CELL_WIDTH = 130.0f;
+const float GRID_CELL_HEIGHT = 120.0f;
+const float GRID_ORIGIN_X = 10.0f;
+const float GRID_ORIGIN_Y = 10.0f;
+
+/**
+ * @enum PlantCategory
+ * @brief Categorizes plants based on their primary gameplay function.
+ */
+enum class PlantCategory
+{
+    SUN_PRODUCING,   // Produces sun currency (e.g., Sunflower)
+    ATTACKING,       // Engages enemies via projectiles or contact (e.g., PeaShooter)
+    BOMB             // Explosive plants with area-of-effect damage (e.g., CherryBomb)
+};
+
+/**
+ * @enum PlantName
+ * @brief Unique identifiers for every plant species in the game.
+ */
+enum class PlantName
+{
+    SUNFLOWER,
+    PEASHOOTER,
+    WALLNUT,
+    POTATOMINE,
+    REPEATER,
+    THREEPEATER,
+    CHERRYBOMB,
+    SUNSHROOM,
+    PUFFSHROOM,
+    SPIKEWEED,
+    JALAPENO,
+    TWINSUNFLOWER,
+    GATLINGPEA,
+    SPIKEROCK,
+    UNKNOWN
+};
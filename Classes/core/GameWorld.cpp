@@ -1,4 +1,5 @@
 ﻿#include "GameWorld.h"
+#include "Log.h"
 #include "BackGround.h"
 #include "Plant.h"
 #include "SunProducingPlant.h"
@@ -9,6 +10,15 @@
 #include "Zombie.h"
 #include "Shovel.h"
 #include "Bullet.h"
+#include "BulletPool.h"
+#include "ZombiePool.h"
+#include "AnimationLibrary.h"
+#include "SoundManager.h"
+#include "FrameProfiler.h"
+#include "RandomService.h"
+#include "Replay.h"
+#include "Benchmark.h"
+#include "AllocationCounter.h"
 #include "SeedPacket.h"
 #include "Sun.h"
 #include "PoleVaulter.h"
@@ -26,25 +36,89 @@
 #include "NormalZombie.h"
 #include "UpgradedPlant.h"
 #include <algorithm>
+#include <climits>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
+#include <ctime>
 #include "audio/include/AudioEngine.h"
 #include "base/ccUtils.h"
 #include "PlayerProfile.h"
+#include "WavePlanner.h"
 #include "map"
 
-// CCRANDOM
-#include "base/ccRandom.h"
-
 USING_NS_CC;
 
-GameWorld* GameWorld::create(bool isNightMode, const std::vector<PlantName>& plantNames)
+namespace
+{
+    /** @brief Inserts a plant so the list stays in the row-major order of plant_grid */
+    template <typename T>
+    void insertInGridOrder(std::vector<PlacedPlant<T>>& list, T* plant, int row, int col)
+    {
+        PlacedPlant<T> placed = { plant, row, col };
+        auto it = std::upper_bound(list.begin(), list.end(), placed,
+            [](const PlacedPlant<T>& a, const PlacedPlant<T>& b) {
+                return a.row < b.row || (a.row == b.row && a.col < b.col);
+            });
+        list.insert(it, placed);
+    }
+
+    /** @brief Plant an upgrade goes on top of, or UNKNOWN for plants that need none */
+    PlantName getUpgradeBase(PlantName name)
+    {
+        switch (name)
+        {
+            case PlantName::TWINSUNFLOWER: return PlantName::SUNFLOWER;
+            case PlantName::GATLINGPEA: return PlantName::REPEATER;
+            case PlantName::SPIKEROCK: return PlantName::SPIKEWEED;
+            default: return PlantName::UNKNOWN;
+        }
+    }
+
+    template <typename T>
+    void eraseByPlant(std::vector<PlacedPlant<T>>& list, T* plant)
+    {
+        list.erase(std::remove_if(list.begin(), list.end(), [plant](const PlacedPlant<T>& placed) {
+            return placed.plant == plant;
+        }), list.end());
+    }
+}
+
+GameWorld* GameWorld::create(bool isNightMode, const std::vector<PlantName>& plantNames, uint64_t seed)
 {
     GameWorld* instance = new (std::nothrow) GameWorld();
     if (instance)
     {
         instance->is_night_mode = isNightMode;
         instance->initial_plant_names = plantNames;
+        instance->level_seed = seed;
+        if (instance->init())
+        {
+            instance->autorelease();
+            return instance;
+        }
+        delete instance;
+    }
+    return nullptr;
+}
+
+Scene* GameWorld::createScene(bool is_night_mode, const std::vector<PlantName>& plantNames, uint64_t seed)
+{
+    return GameWorld::create(is_night_mode, plantNames, seed);
+}
+
+Scene* GameWorld::createReplayScene(std::shared_ptr<Replay> replay, uint32_t seekFrame)
+{
+    GameWorld* instance = new (std::nothrow) GameWorld();
+    if (instance)
+    {
+        instance->is_night_mode = replay->header.night_mode;
+        for (int name : replay->header.plant_names)
+        {
+            instance->initial_plant_names.push_back(static_cast<PlantName>(name));
+        }
+        instance->playback = replay;
+        instance->replay_seek_target = seekFrame;
         if (instance->init())
         {
             instance->autorelease();
@@ -55,9 +129,27 @@ GameWorld* GameWorld::create(bool isNightMode, const std::vector<PlantName>& pla
     return nullptr;
 }
 
-Scene* GameWorld::createScene(bool is_night_mode, const std::vector<PlantName>& plantNames)
+Scene* GameWorld::createBenchmarkScene(const BenchmarkConfig& config)
 {
-    return GameWorld::create(is_night_mode, plantNames);
+    GameWorld* instance = new (std::nothrow) GameWorld();
+    if (instance)
+    {
+        instance->is_night_mode = false;
+        instance->benchmark_mode = true;
+        instance->benchmark_config = config;
+        if (instance->init())
+        {
+            instance->autorelease();
+            return instance;
+        }
+        delete instance;
+    }
+    return nullptr;
+}
+
+std::string GameWorld::getLastReplayPath()
+{
+    return FileUtils::getInstance()->getWritablePath() + "replays/last.pvzr";
 }
 
 GameWorld::~GameWorld()
@@ -67,6 +159,21 @@ GameWorld::~GameWorld()
         cocos2d::AudioEngine::stop(background_music_id);
     }
 
+    AnimationLibrary::getInstance()->logStats();
+    SoundManager::getInstance()->logStats();
+    ZombiePool::getInstance()->logStats();
+
+    if (playback || benchmark_mode)
+    {
+        _eventDispatcher->removeEventListener(step_listener);
+        Director::getInstance()->getScheduler()->setTimeScale(1.0f);
+        SoundManager::getInstance()->setMuted(false);
+    }
+    else
+    {
+        saveRecording();
+    }
+
     // Clean up pause menu resources
     if (pause_menu_layer)
     {
@@ -78,6 +185,9 @@ GameWorld::~GameWorld()
     // Reset game state
     is_paused = false;
     speed_level = 0;
+
+    // Release zombies and plants now, while zombie_lanes and population they point into still exist
+    this->removeAllChildren();
 }
 
 // Print useful error message instead of segfaulting when files are not there.
@@ -106,6 +216,7 @@ void GameWorld::initSeedPackets() {
         SeedPacket* packet = SeedPacket::createFromConfig(initial_plant_names[i]);
         if (packet) {
             packet->setPosition(Vec2(baseX + i * spacing, baseY));
+            packet->setTimers(&timers);
             this->addChild(packet, SEEDPACKET_LAYER);
             seed_packets.push_back(packet);
         }
@@ -125,6 +236,9 @@ bool GameWorld::init()
     cocos2d::AudioEngine::stopAll();
     background_music_id = cocos2d::AudioEngine::INVALID_AUDIO_ID;
 
+    timers.reset();
+    ice_coverage.reset(&timers);
+
     // Initialize plant grid (all cells empty at start)
     for (int row = 0; row < MAX_ROW; ++row)
     {
@@ -142,10 +256,52 @@ bool GameWorld::init()
     sun_count = 200; // Initial sun count
     sun_count_label = nullptr;
 
-    // Initialize timed batch spawning (Version D)
-    current_wave = 0; // legacy
-    next_batch_time_sec = 8.0f; // First batch around 8 seconds
+    // Pre-warm the projectile pool so early waves never allocate bullets.
+    // Bullets left over from the previous scene are dropped and freed with it.
+    BulletPool::getInstance()->clear();
+    BulletPool::getInstance()->resetStats();
+    BulletPool::getInstance()->prewarm(BULLET_POOL_PEAS, BULLET_POOL_PUFFS);
+
+    // Slice every zombie sheet the wave logic can spawn before the first batch arrives.
+    // The library outlives the scene, so restarts and later levels hit the cache.
+    AnimationLibrary::getInstance()->resetStats();
+    NormalZombie::preloadAnimations();
+    FlagZombie::preloadAnimations();
+    PoleVaulter::preloadAnimations();
+    BucketHeadZombie::preloadAnimations();
+    Zomboni::preloadAnimations();
+    Gargantuar::preloadAnimations();
+    Imp::preloadAnimations();
+
+    // Effects still queued or playing from the previous level are not ours to cap
+    SoundManager::getInstance()->reset();
+    SoundManager::getInstance()->resetStats();
+    FrameProfiler::getInstance()->reset();
+
+    // Every random decision of this level comes from the seed's streams
+    uint64_t seed;
+    if (playback) seed = playback->header.seed;
+    else if (benchmark_mode) seed = benchmark_config.seed;
+    else if (level_seed != 0) seed = level_seed;
+    else seed = RandomService::freshSeed();
+    RandomService::getInstance()->beginLevel(seed);
+    FrameProfiler::getInstance()->setSeed(RandomService::getInstance()->getSeed());
+    CCLOG("GameWorld: level seed %llu", static_cast<unsigned long long>(RandomService::getInstance()->getSeed()));
+
+    // Plan every wave of the level up front from the seed
+    wave_schedule.build(WavePlanner(is_night_mode), RandomService::getInstance()->get(RandomStreamId::WAVES));
     final_wave_triggered = false;
+    LOG_INFO(GENERAL, "GameWorld: %d scheduled zombies (normal %d, pole %d, bucket %d, zomboni %d, gargantuar %d), "
+        "at most %d within 10s", wave_schedule.getTotal(), wave_schedule.getTotal(WaveZombie::NORMAL),
+        wave_schedule.getTotal(WaveZombie::POLE_VAULTER), wave_schedule.getTotal(WaveZombie::BUCKET_HEAD),
+        wave_schedule.getTotal(WaveZombie::ZOMBONI), wave_schedule.getTotal(WaveZombie::GARGANTUAR),
+        wave_schedule.getPeakSpawns(10.0f));
+
+    // SelectCardsScene pre-warms the zombie pool for this seed during its countdown;
+    // whatever it did not get to (or a replay/benchmark start) is created here, before the first frame
+    ZombiePool::getInstance()->resetStats();
+    ZombiePool::getInstance()->plan(wave_schedule);
+    ZombiePool::getInstance()->prewarm(INT_MAX);
     game_started = true;
 
     // Initialize sun spawning system
@@ -167,10 +323,22 @@ bool GameWorld::init()
     }
     this->addChild(backGround, BACKGROUND_LAYER);
 
+    // Lawn entities live in per-category layers, not in the scene's own child list
+    world_layers.build(this);
+
+    // A replay rebuilds the recorded level, whatever the profile says today
+    recording.header.seed = RandomService::getInstance()->getSeed();
+    recording.header.night_mode = is_night_mode;
+    // A benchmark's load must not be cleared by rakes and mowers
+    recording.header.rake_enabled = playback ? playback->header.rake_enabled
+        : !benchmark_mode && PlayerProfile::getInstance()->isRakeEnabled();
+    recording.header.mower_enabled = playback ? playback->header.mower_enabled
+        : !benchmark_mode && PlayerProfile::getInstance()->isMowerEnabled();
+
     // Spawn Rake if enabled (random row, right end)
-    if (PlayerProfile::getInstance()->isRakeEnabled())
+    if (recording.header.rake_enabled)
     {
-        int rakeRow = rand() % MAX_ROW;
+        int rakeRow = RandomService::getInstance()->get(RandomStreamId::WAVES).below(MAX_ROW);
         auto rake = Rake::create();
         if (rake)
         {
@@ -183,7 +351,7 @@ bool GameWorld::init()
     }
 
     // Spawn Mowers per row at far left if enabled
-    if (PlayerProfile::getInstance()->isMowerEnabled())
+    if (recording.header.mower_enabled)
     {
         for (int r = 0; r < MAX_ROW; ++r)
         {
@@ -339,7 +507,7 @@ bool GameWorld::init()
 
     // debug mode
     bool debug = true;
-    if (debug) {
+    if (debug && !benchmark_mode) {
         {
             auto debugZombie = Gargantuar::createZombie();
             if (debugZombie)
@@ -349,8 +517,8 @@ bool GameWorld::init()
                 float y = GRID_ORIGIN.y + row * CELLSIZE.height + CELLSIZE.height * ZOMBIE_Y_OFFSET;
                 float x = visibleSize.width - 200;
                 debugZombie->setPosition(Vec2(x, y));
-                this->addChild(debugZombie, ENEMY_LAYER);
-                zombies_in_row[row].push_back(debugZombie);
+                world_layers.add(WorldLayer::ZOMBIES, debugZombie);
+                enlistZombie(debugZombie, row);
                 CCLOG("DEBUG: Spawned test zombie at row %d", row);
             }
         }
@@ -359,25 +527,25 @@ bool GameWorld::init()
             auto debugCoin0 = Coin::create(Coin::CoinType::SILVER);
             if (debugCoin0) {
                 debugCoin0->setPosition(Vec2(300, 300));
-                this->addChild(debugCoin0, SUN_LAYER);
-                coins.push_back(debugCoin0);
+                addCoin(debugCoin0);
             }
             auto debugCoin1 = Coin::create(Coin::CoinType::GOLD);
             if (debugCoin1) {
                 debugCoin1->setPosition(Vec2(500, 300));
-                this->addChild(debugCoin1, SUN_LAYER);
-                coins.push_back(debugCoin1);
+                addCoin(debugCoin1);
             }
             auto debugCoin2 = Coin::create(Coin::CoinType::DIAMOND);
             if (debugCoin2) {
                 debugCoin2->setPosition(Vec2(800, 300));
-                this->addChild(debugCoin2, SUN_LAYER);
-                coins.push_back(debugCoin2);
+                addCoin(debugCoin2);
             }
         }
     }
     // Setup user interaction
     setupUserInteraction();
+    setupProfilerOverlay();
+    setupReplay();
+    setupBenchmark();
 
 
     // Enable update loop
@@ -394,49 +562,25 @@ void GameWorld::setupUserInteraction()
     auto unifiedListener = EventListenerTouchOneByOne::create();
     unifiedListener->setSwallowTouches(true);
 
+    // Touches are resolved into gameplay inputs here; the helpers they call are what a replay
+    // calls for the recorded inputs (see applyInput)
     unifiedListener->onTouchBegan = [this](Touch* touch, Event* event) {
-        // Don't process touches when game is paused
-        if (is_paused) return false;
+        // Don't process touches when game is paused or a replay is driving the inputs
+        if (is_paused || playback) return false;
 
         Vec2 pos = this->convertToNodeSpace(touch->getLocation());
 
-        // Check if touched any sun (highest priority)
-        for (auto sun : suns)
+        // Check if touched any sun or coin (highest priority)
+        if (collectAt(pos))
         {
-            if (sun && sun->isCollectible())
-            {
-                if (sun->getBoundingBox().containsPoint(pos))
-                {
-                    sun->collect([this](int sunvalue) {
-                        sun_count += sunvalue;
-                        updateSunDisplay();
-                        });
-                    cocos2d::AudioEngine::play2d("sun_pickup_sound.mp3", false);
-                    return true;
-                }
-            }
-        }
-
-        for (auto coin : coins) {
-            if (coin && coin->isCollectible()) {
-                if (coin->getBoundingBox().containsPoint(pos)) {
-                    coin->collect([this](int coinvalue) {
-                        PlayerProfile::getInstance()->addCoins(coinvalue);
-                        updateMoneyBankDisplay();
-                        });
-
-                    return true;
-                }
-            }
+            recordInput(ReplayInputType::COLLECT, 0, pos);
+            return true;
         }
 
         // Check if touched shovel
         if (shovel && shovel->containsPoint(pos)) {
-            // Play button click sound
-            cocos2d::AudioEngine::play2d("buttonclick.mp3", false);
-
-            shovel_selected = true;
-            shovel->setDragging(true);
+            selectShovel();
+            recordInput(ReplayInputType::SELECT_SHOVEL);
             return true;
         }
 
@@ -445,36 +589,9 @@ void GameWorld::setupUserInteraction()
         {
             if (seed_packets[i] && seed_packets[i]->getBoundingBox().containsPoint(pos))
             {
-                SeedPacket* packet = seed_packets[i];
-
-                // Check if ready and enough sun
-                if (packet->isReady() && sun_count >= packet->getSunCost())
-                {
-                    // Play button click sound
-                    int audioId = cocos2d::AudioEngine::play2d("planting.mp3", false);
-
-                    plant_selected = true;
-                    selected_seedpacket_index = i;
-
-                    // Create preview plant
-                    preview_plant = packet->createPreviewPlant();
-                    if (preview_plant)
-                    {
-                        preview_plant->setPosition(touch->getLocation());
-                        this->addChild(preview_plant, UI_LAYER);
-                    }
-
-                    CCLOG("Seed packet %d selected", static_cast<int>(i));
-                    return true;
-                }
-                else
-                {
-                    // Play buzzer sound for invalid action
-                    cocos2d::AudioEngine::play2d("buzzer.mp3", false);
-
-                    CCLOG("Seed packet not ready or not enough sun!");
-                    return true;
-                }
+                selectSeedPacket(static_cast<int>(i), touch->getLocation());
+                recordInput(ReplayInputType::SELECT_PACKET, static_cast<int>(i), touch->getLocation());
+                return true;
             }
         }
 
@@ -504,69 +621,165 @@ void GameWorld::setupUserInteraction()
         if (shovel_selected)
         {
             Vec2 shovelTipPos = shovel ? shovel->getPosition() : pos;
-            bool removed = this->tryRemovePlantAtPosition(shovelTipPos);
-
-            if (removed)
-            {
-                int audioId = cocos2d::AudioEngine::play2d("planted.mp3", false, 0.3f);
-                CCLOG("Plant removed!");
-            }
-            else
-            {
-                // Play buzzer sound for invalid removal
-                cocos2d::AudioEngine::play2d("buzzer.mp3", false);
-                CCLOG("No plant!");
-            }
-
-            shovel_selected = false;
-            if (shovel) shovel->resetPosition();
+            removePlantWithShovel(shovelTipPos);
+            recordInput(ReplayInputType::REMOVE_PLANT, 0, shovelTipPos);
             return;
         }
 
         // Handle planting
         if (plant_selected)
         {
-            SeedPacket* selectedPacket = nullptr;
-            if (selected_seedpacket_index >= 0 && selected_seedpacket_index < static_cast<int>(seed_packets.size()))
-            {
-                selectedPacket = seed_packets[selected_seedpacket_index];
-            }
+            plantSelectedPacket(pos);
+            recordInput(ReplayInputType::PLANT, 0, pos);
+        }
+        };
 
-            if (selectedPacket)
-            {
-                bool planted = this->tryPlantAtPosition(pos, selectedPacket);
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(unifiedListener, this);
+}
 
-                if (planted)
-                {
-                    CCLOG("Plant placed!");
-                    // Deduct sun
-                    sun_count -= selectedPacket->getSunCost();
+// ----------------------------------------------------
+// Gameplay inputs
+// ----------------------------------------------------
+
+bool GameWorld::collectAt(const Vec2& pos)
+{
+    for (auto sun : suns)
+    {
+        if (sun && sun->isCollectible())
+        {
+            if (sun->getBoundingBox().containsPoint(pos))
+            {
+                sun->collect([this](int sunvalue) {
+                    sun_count += sunvalue;
                     updateSunDisplay();
-                    int audioId = cocos2d::AudioEngine::play2d("planted.mp3", false);
-                    // Start cooldown
-                    selectedPacket->startCooldown();
-                }
-                else
-                {
-                    // Play buzzer sound for invalid planting
-                    cocos2d::AudioEngine::play2d("buzzer.mp3", false);
-                    CCLOG("Cannot plant!");
-                }
+                    });
+                SoundManager::getInstance()->post("sun_pickup_sound.mp3");
+                return true;
             }
+        }
+    }
 
-            // Remove preview plant
-            if (preview_plant)
-            {
-                this->removeChild(preview_plant);
-                preview_plant = nullptr;
+    for (auto coin : coins) {
+        if (coin && coin->isCollectible()) {
+            if (coin->getBoundingBox().containsPoint(pos)) {
+                coin->collect([this](int coinvalue) {
+                    // Replays must not pay out the recorded coins a second time
+                    if (!playback)
+                    {
+                        PlayerProfile::getInstance()->addCoins(coinvalue);
+                    }
+                    updateMoneyBankDisplay();
+                    });
+
+                return true;
             }
+        }
+    }
+
+    return false;
+}
 
-            plant_selected = false;
-            selected_seedpacket_index = -1;
+void GameWorld::selectShovel()
+{
+    // Play button click sound (posted, so a replay fast-forward stays silent)
+    SoundManager::getInstance()->post("buttonclick.mp3");
+
+    shovel_selected = true;
+    if (shovel) shovel->setDragging(true);
+}
+
+void GameWorld::selectSeedPacket(int index, const Vec2& previewPos)
+{
+    if (index < 0 || index >= static_cast<int>(seed_packets.size()) || !seed_packets[index]) return;
+    SeedPacket* packet = seed_packets[index];
+
+    // Check if ready and enough sun
+    if (packet->isReady() && sun_count >= packet->getSunCost())
+    {
+        // Play button click sound
+        SoundManager::getInstance()->post("planting.mp3");
+
+        plant_selected = true;
+        selected_seedpacket_index = index;
+
+        // Create preview plant
+        preview_plant = packet->createPreviewPlant();
+        if (preview_plant)
+        {
+            preview_plant->setPosition(previewPos);
+            this->addChild(preview_plant, UI_LAYER);
         }
-        };
 
-    _eventDispatcher->addEventListenerWithSceneGraphPriority(unifiedListener, this);
+        LOG_DEBUG(GENERAL, "Seed packet %d selected", index);
+    }
+    else
+    {
+        // Play buzzer sound for invalid action
+        SoundManager::getInstance()->post("buzzer.mp3");
+
+        LOG_DEBUG(GENERAL, "Seed packet not ready or not enough sun!");
+    }
+}
+
+void GameWorld::removePlantWithShovel(const Vec2& shovelTipPos)
+{
+    bool removed = this->tryRemovePlantAtPosition(shovelTipPos);
+
+    if (removed)
+    {
+        SoundManager::getInstance()->post("planted.mp3", SoundPriority::NORMAL, 0.3f);
+        LOG_DEBUG(GENERAL, "Plant removed!");
+    }
+    else
+    {
+        // Play buzzer sound for invalid removal
+        SoundManager::getInstance()->post("buzzer.mp3");
+        LOG_DEBUG(GENERAL, "No plant!");
+    }
+
+    shovel_selected = false;
+    if (shovel) shovel->resetPosition();
+}
+
+void GameWorld::plantSelectedPacket(const Vec2& pos)
+{
+    SeedPacket* selectedPacket = nullptr;
+    if (selected_seedpacket_index >= 0 && selected_seedpacket_index < static_cast<int>(seed_packets.size()))
+    {
+        selectedPacket = seed_packets[selected_seedpacket_index];
+    }
+
+    if (selectedPacket)
+    {
+        bool planted = this->tryPlantAtPosition(pos, selectedPacket);
+
+        if (planted)
+        {
+            LOG_DEBUG(GENERAL, "Plant placed!");
+            // Deduct sun
+            sun_count -= selectedPacket->getSunCost();
+            updateSunDisplay();
+            SoundManager::getInstance()->post("planted.mp3");
+            // Start cooldown
+            selectedPacket->startCooldown();
+        }
+        else
+        {
+            // Play buzzer sound for invalid planting
+            SoundManager::getInstance()->post("buzzer.mp3");
+            LOG_DEBUG(GENERAL, "Cannot plant!");
+        }
+    }
+
+    // Remove preview plant
+    if (preview_plant)
+    {
+        this->removeChild(preview_plant);
+        preview_plant = nullptr;
+    }
+
+    plant_selected = false;
+    selected_seedpacket_index = -1;
 }
 
 bool GameWorld::tryPlantAtPosition(const Vec2& globalPos, SeedPacket* seedPacket)
@@ -577,7 +790,7 @@ bool GameWorld::tryPlantAtPosition(const Vec2& globalPos, SeedPacket* seedPacket
 
     if (hasIceAt(row, col))
     {
-        CCLOG("cannot plant on ice!");
+        LOG_DEBUG(GENERAL, "cannot plant on ice!");
         return false;
     }
 
@@ -596,7 +809,11 @@ bool GameWorld::tryPlantAtPosition(const Vec2& globalPos, SeedPacket* seedPacket
         // First remove the base plant
         Plant* basePlant = plant_grid[row][col];
         if (basePlant) {
-            this->removeChild(basePlant);
+            if (basePlant->isDead()) population.cancelPlantDeath(basePlant);
+            else population.onPlantRemoved(row);
+            basePlant->leavePopulation();
+            unlistPlant(basePlant);
+            basePlant->removeFromParent();
             plant_grid[row][col] = nullptr;
         }
 
@@ -604,8 +821,9 @@ bool GameWorld::tryPlantAtPosition(const Vec2& globalPos, SeedPacket* seedPacket
         Plant* plant = seedPacket->plantAt(globalPos);
         if (plant)
         {
-            this->addChild(plant, PLANT_LAYER);
+            world_layers.add(WorldLayer::PLANTS, plant);
             plant_grid[row][col] = plant;
+            listPlant(plant, row, col);
             return true;
         }
 
@@ -620,8 +838,9 @@ bool GameWorld::tryPlantAtPosition(const Vec2& globalPos, SeedPacket* seedPacket
     Plant* plant = seedPacket->plantAt(globalPos);
     if (plant)
     {
-        this->addChild(plant, PLANT_LAYER);
+        world_layers.add(WorldLayer::PLANTS, plant);
         plant_grid[row][col] = plant;
+        listPlant(plant, row, col);
         return true;
     }
 
@@ -656,179 +875,810 @@ bool GameWorld::tryRemovePlantAtPosition(const Vec2& globalPos)
 
 void GameWorld::update(float delta)
 {
+    // Replays and benchmarks advance only from stepReplay()/stepBenchmark();
+    // the scheduler's own pass runs at time scale 0
+    if ((playback || benchmark_mode) && !manual_stepping)
+        return;
+    beginReplayFrame(delta);
+
     if (!game_started || is_paused || is_gameover)
+    {
+        // Zombies keep walking and shots keep flying behind the lose screen
+        advanceBullets(delta);
+        updateZombieLanes(delta);
         return;
+    }
+
+    // Update unified time base
+    elapsed_time += delta;
+
+    // Update progress bar based on elapsed time
+    float progressPercent = (elapsed_time / WavePlanner::TOTAL_GAME_TIME) * 100.0f;
+    if (progressPercent > 100.0f) progressPercent = 100.0f;
+
+    if (progress_bar) {
+        progress_bar->setPercent(progressPercent);
+
+        // Update flag icon position to follow progress bar growth
+        if (flag_icon_right) {
+            float progressBarWidth = progress_bar->getContentSize().width;
+            float currentProgress = progressPercent / 100.0f; // Convert to 0.0 - 1.0
+            float progressBarLeftX = progress_bar->getPositionX() + progressBarWidth / 2;
+            float flagX = progressBarLeftX - progressBarWidth * currentProgress;
+            flag_icon_right->setPosition(Vec2(flagX, progress_bar->getPositionY() + 5));
+        }
+    }
+
+    {
+        FrameProfiler::Scope scope(ProfilePhase::SPAWN);
+
+        if (benchmark_mode)
+        {
+            // Scripted load: the same batch enters every row at a fixed interval
+            benchmark_spawn_timer -= delta;
+            if (benchmark_spawn_timer <= 0.0f)
+            {
+                benchmark_spawn_timer += benchmark_config.batch_interval;
+                const ZombieBatch& batch = benchmark_config.per_row;
+                for (int row = 0; row < MAX_ROW; ++row)
+                {
+                    for (int i = 0; i < batch.normal; ++i) spawnZombieAtRow(WaveZombie::NORMAL, row);
+                    for (int i = 0; i < batch.poleVaulter; ++i) spawnZombieAtRow(WaveZombie::POLE_VAULTER, row);
+                    for (int i = 0; i < batch.bucketHead; ++i) spawnZombieAtRow(WaveZombie::BUCKET_HEAD, row);
+                    for (int i = 0; i < batch.zomboni; ++i) spawnZombieAtRow(WaveZombie::ZOMBONI, row);
+                    for (int i = 0; i < batch.gargantuar; ++i) spawnZombieAtRow(WaveZombie::GARGANTUAR, row);
+                }
+            }
+        }
+        else
+        {
+            releaseScheduledSpawns();
+        }
+
+
+        if (!is_night_mode && !benchmark_mode)
+        {
+            // Sun spawning system (every 5 seconds)
+            sun_spawn_timer += delta;
+            if (sun_spawn_timer >= 5.0f)
+            {
+                spawnSunFromSky();
+                sun_spawn_timer = 0.0f;
+            }
+        }
+    }
+
+    // Index zombies once for every collision consumer of this frame
+    {
+        FrameProfiler::Scope scope(ProfilePhase::LANE_INDEX);
+        lane_index.rebuild(zombies_in_row);
+    }
+
+    // Every entity kind is ticked exactly once per frame, here and in this order; none of them
+    // is scheduled on its own: timers, seed packets, plants, bullets, zombies (contact here,
+    // movement in updateZombieLanes at the end), suns. Lifetimes and cooldowns (sun, coin, ice,
+    // seed packet, potato mine arming) are deadlines on the timer wheel, not per-frame counters.
+    {
+        FrameProfiler::Scope scope(ProfilePhase::TIMERS);
+        timers.advance(delta);
+    }
+    {
+        FrameProfiler::Scope scope(ProfilePhase::SEED_PACKETS);
+        updateSeedPackets(delta);
+    }
+
+    // Update Plants (Timers, then firing logic)
+    {
+        FrameProfiler::Scope scope(ProfilePhase::PLANTS);
+        updatePlants(delta);
+    }
+
+    // Update Bullets (Movement and Collision)
+    {
+        FrameProfiler::Scope scope(ProfilePhase::BULLETS);
+        updateBullets(delta);
+    }
+
+    // Update Zombies (Collision with plants, mowers and the house)
+    {
+        FrameProfiler::Scope scope(ProfilePhase::ZOMBIES);
+        updateZombies(delta);
+    }
+
+    // Update Suns (Falling from the sky)
+    {
+        FrameProfiler::Scope scope(ProfilePhase::SUNS);
+        updateSuns(delta);
+    }
+    maybePlayZombieGroan(delta);
+
+    // Cleanup
+    {
+        FrameProfiler::Scope scope(ProfilePhase::REMOVE_PLANTS);
+        removeDeadPlants();
+    }
+    {
+        FrameProfiler::Scope scope(ProfilePhase::REMOVE_ZOMBIES);
+        removeDeadZombies();
+    }
+    {
+        FrameProfiler::Scope scope(ProfilePhase::REMOVE_BULLETS);
+        removeInactiveBullets();
+    }
+    {
+        FrameProfiler::Scope scope(ProfilePhase::REMOVE_SUNS);
+        removeExpiredSuns();
+    }
+    {
+        FrameProfiler::Scope scope(ProfilePhase::REMOVE_ICE_TILES);
+        removeExpiredIceTiles();
+    }
+    {
+        FrameProfiler::Scope scope(ProfilePhase::REMOVE_COINS);
+        removeExpiredCoins();
+    }
+
+    // Clean up off-screen Mowers
+    {
+        auto vs = Director::getInstance()->getVisibleSize();
+        for (int r = 0; r < MAX_ROW; ++r) {
+            auto mower = mower_per_row[r];
+            if (mower && mower->getPositionX() > vs.width + 100.0f) {
+                mower->removeFromParent();
+                mower_per_row[r] = nullptr;
+            }
+        }
+    }
+
+    // Victory condition: Final wave has been triggered, all sub-batches have been scheduled, and no "alive" zombies on the field
+    // Container doesn't need to be empty, allows dead/dying zombies with animations
+    if (!win_shown && final_wave_triggered && final_wave_spawning_done && !population.hasLiveZombies())
+    {
+        showWinTrophy();
+    }
+
+    // Zombie movement and bites, after the rest of the frame as with per-sprite updates
+    {
+        FrameProfiler::Scope scope(ProfilePhase::ZOMBIE_LANES);
+        updateZombieLanes(delta);
+    }
+
+    // Start this frame's sound effects, merged and capped; last, so the lane bites are included
+    SoundManager::getInstance()->flush();
+
+    endProfiledFrame(delta);
+}
+
+// ----------------------------------------------------
+// Replay
+// ----------------------------------------------------
+
+void GameWorld::setupReplay()
+{
+    for (int i = 0; i < static_cast<int>(initial_plant_names.size()); ++i)
+    {
+        recording.header.plant_names.push_back(static_cast<int>(initial_plant_names[i]));
+    }
+
+    if (playback)
+    {
+        CCLOG("Replay: %u frames (%.1f s), %d inputs, seed %llu", playback->getFrameCount(), playback->getDuration(),
+            static_cast<int>(playback->getInputs().size()), static_cast<unsigned long long>(playback->header.seed));
+
+        // Recorded frames are stepped right before the scheduler's own pass of each real frame
+        step_listener = _eventDispatcher->addCustomEventListener(Director::EVENT_BEFORE_UPDATE,
+            [this](EventCustom* event) { stepReplay(); });
+    }
+
+    // F5 plays the last recording; during a replay LEFT/RIGHT seek ten seconds back/forward
+    auto keyListener = EventListenerKeyboard::create();
+    keyListener->onKeyPressed = [this](EventKeyboard::KeyCode keyCode, Event* event) {
+        if (keyCode == EventKeyboard::KeyCode::KEY_F5)
+        {
+            auto replay = std::make_shared<Replay>();
+            if (!replay->load(getLastReplayPath()))
+            {
+                CCLOG("Replay: cannot load %s", getLastReplayPath().c_str());
+                return;
+            }
+            Director::getInstance()->replaceScene(GameWorld::createReplayScene(replay));
+        }
+        else if (playback && keyCode == EventKeyboard::KeyCode::KEY_RIGHT_ARROW)
+        {
+            seekReplay(frame_index + REPLAY_SEEK_FRAMES);
+        }
+        else if (playback && keyCode == EventKeyboard::KeyCode::KEY_LEFT_ARROW)
+        {
+            seekReplay(frame_index > REPLAY_SEEK_FRAMES ? frame_index - REPLAY_SEEK_FRAMES : 0);
+        }
+    };
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(keyListener, this);
+}
+
+void GameWorld::recordInput(ReplayInputType type, int index, const Vec2& pos)
+{
+    if (playback) return;
+
+    ReplayInput input;
+    input.frame = frame_index;
+    input.type = type;
+    input.index = index;
+    input.x = pos.x;
+    input.y = pos.y;
+    recording.addInput(input);
+}
+
+void GameWorld::applyInput(const ReplayInput& input)
+{
+    Vec2 pos(input.x, input.y);
+    switch (input.type)
+    {
+        case ReplayInputType::COLLECT:
+            collectAt(pos);
+            break;
+        case ReplayInputType::SELECT_SHOVEL:
+            selectShovel();
+            break;
+        case ReplayInputType::SELECT_PACKET:
+            selectSeedPacket(input.index, pos);
+            break;
+        case ReplayInputType::REMOVE_PLANT:
+            removePlantWithShovel(pos);
+            break;
+        case ReplayInputType::PLANT:
+            plantSelectedPacket(pos);
+            break;
+        case ReplayInputType::TOGGLE_SPEED:
+            // The recorded deltas already run at the recorded speed
+            break;
+        default:
+            CCLOG("Replay: unknown input type %d", static_cast<int>(input.type));
+            break;
+    }
+}
+
+void GameWorld::beginReplayFrame(float delta)
+{
+    // Inputs of a frame reached the touch handlers before its update; replay them first
+    if (playback)
+    {
+        const auto& inputs = playback->getInputs();
+        while (next_replay_input < inputs.size() && inputs[next_replay_input].frame <= frame_index)
+        {
+            applyInput(inputs[next_replay_input++]);
+        }
+    }
+
+    if (frame_index % Replay::KEYFRAME_INTERVAL == 0)
+    {
+        ReplayKeyframe keyframe = captureKeyframe();
+        if (!playback)
+        {
+            recording.addKeyframe(keyframe);
+        }
+        else if (const ReplayKeyframe* expected = playback->findKeyframe(frame_index))
+        {
+            std::string difference = Replay::compare(*expected, keyframe);
+            if (!difference.empty() && !replay_diverged)
+            {
+                replay_diverged = true;
+                CCLOG("Replay: diverged by frame %u: %s", frame_index, difference.c_str());
+            }
+        }
+    }
+
+    if (!playback)
+    {
+        recording.addFrame(delta);
+    }
+    ++frame_index;
+}
+
+ReplayKeyframe GameWorld::captureKeyframe() const
+{
+    ReplayKeyframe keyframe;
+    keyframe.frame = frame_index;
+    keyframe.elapsed_time = elapsed_time;
+    keyframe.sun_count = sun_count;
+    keyframe.zombies = zombie_lanes.getCount();
+    keyframe.plants = static_cast<int32_t>(sun_producers.size() + attackers.size() + bombs.size());
+    keyframe.bullets = static_cast<int32_t>(bullets.size());
+    for (int i = 0; i < static_cast<int>(RandomStreamId::COUNT) && i < 4; ++i)
+    {
+        keyframe.rng_counters[i] = RandomService::getInstance()->get(static_cast<RandomStreamId>(i)).getCounter();
+    }
+
+    // FNV-1a over zombie positions and occupied cells
+    uint32_t hash = 2166136261u;
+    auto mix = [&hash](uint32_t value) {
+        for (int i = 0; i < 4; ++i)
+        {
+            hash ^= (value >> (8 * i)) & 0xFF;
+            hash *= 16777619u;
+        }
+    };
+    for (int row = 0; row < MAX_ROW; ++row)
+    {
+        const auto& lane = zombie_lanes.getRow(row);
+        for (size_t i = 0; i < lane.size(); ++i)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &lane.x[i], sizeof(bits));
+            mix(bits);
+            std::memcpy(&bits, &lane.y[i], sizeof(bits));
+            mix(bits);
+        }
+        for (int col = 0; col < MAX_COL; ++col)
+        {
+            if (plant_grid[row][col]) mix(static_cast<uint32_t>(row * MAX_COL + col));
+        }
+    }
+    keyframe.state_hash = hash;
+    return keyframe;
+}
+
+void GameWorld::stepReplay()
+{
+    // Not while a transition away from this scene is running
+    if (Director::getInstance()->getRunningScene() != this) return;
+
+    auto scheduler = Director::getInstance()->getScheduler();
+    const uint32_t frameCount = playback->getFrameCount();
+    bool seeking = frame_index < replay_seek_target;
+    int steps = seeking ? REPLAY_SEEK_STEPS : replay_speed;
+
+    // Nothing is drawn or heard until the seek target is reached, starting with this batch
+    this->setVisible(!seeking);
+    SoundManager::getInstance()->setMuted(seeking);
+
+    scheduler->setTimeScale(1.0f);
+    for (int i = 0; i < steps && frame_index < frameCount; ++i)
+    {
+        if (seeking && frame_index >= replay_seek_target) break;
+
+        manual_stepping = true;
+        scheduler->update(playback->getDelta(frame_index));
+        manual_stepping = false;
+    }
+    scheduler->setTimeScale(0.0f);
+
+    // Back to normal once this batch reached the target
+    seeking = frame_index < replay_seek_target && frame_index < frameCount;
+    this->setVisible(!seeking);
+    SoundManager::getInstance()->setMuted(seeking);
+
+    if (frame_index == frameCount && !replay_finished)
+    {
+        replay_finished = true;
+        CCLOG("Replay: finished at frame %u%s", frame_index, replay_diverged ? " (diverged)" : "");
+    }
+}
+
+void GameWorld::seekReplay(uint32_t frame)
+{
+    frame = std::min(frame, playback->getFrameCount());
+    if (frame >= frame_index)
+    {
+        replay_seek_target = frame;
+        return;
+    }
+
+    // The scene cannot be rewound: rebuild the level and fast-forward from its first frame
+    Director::getInstance()->replaceScene(GameWorld::createReplayScene(playback, frame));
+}
+
+void GameWorld::saveRecording()
+{
+    if (recording.getFrameCount() == 0) return;
+
+    std::string directory = FileUtils::getInstance()->getWritablePath() + "replays/";
+    FileUtils::getInstance()->createDirectory(directory);
+
+    std::string archive = directory + StringUtils::format("replay_%ld.pvzr", static_cast<long>(time(nullptr)));
+    if (recording.save(archive) && recording.save(getLastReplayPath()))
+    {
+        CCLOG("Replay: saved %u frames to %s", recording.getFrameCount(), archive.c_str());
+    }
+    else
+    {
+        CCLOG("Replay: cannot write %s", archive.c_str());
+    }
+}
+
+// ----------------------------------------------------
+// Benchmark
+// ----------------------------------------------------
+
+void GameWorld::setupBenchmark()
+{
+    if (!benchmark_mode) return;
+
+    CCLOG("Benchmark %s: %u frames at dt %.4f", benchmark_config.name.c_str(), benchmark_config.frames, benchmark_config.dt);
+    plantBenchmarkGrid();
+    benchmark_report.reset(benchmark_config.frames);
+    benchmark_render_mark = world_layers.getRenderStats();
+    benchmark_spawn_timer = 0.0f;
+
+    // Frames are stepped with the fixed delta right before the scheduler's own pass, as in replays
+    step_listener = _eventDispatcher->addCustomEventListener(Director::EVENT_BEFORE_UPDATE,
+        [this](EventCustom* event) { stepBenchmark(); });
+}
+
+void GameWorld::plantBenchmarkGrid()
+{
+    const auto& columns = benchmark_config.columns;
+    if (columns.empty()) return;
+
+    for (int row = 0; row < MAX_ROW; ++row)
+    {
+        for (int col = 0; col < MAX_COL; ++col)
+        {
+            PlantName name = columns[col % columns.size()];
+            if (name == PlantName::UNKNOWN) continue;
+
+            Vec2 pos(GRID_ORIGIN.x + (col + 0.5f) * CELLSIZE.width, GRID_ORIGIN.y + (row + 0.5f) * CELLSIZE.height);
+
+            // Upgrades go on top of their base plant, as in play
+            PlantName base = getUpgradeBase(name);
+            if (base != PlantName::UNKNOWN)
+            {
+                SeedPacket* basePacket = SeedPacket::createFromConfig(base);
+                if (basePacket) tryPlantAtPosition(pos, basePacket);
+            }
+
+            SeedPacket* packet = SeedPacket::createFromConfig(name);
+            if (!packet || !tryPlantAtPosition(pos, packet))
+            {
+                CCLOG("Benchmark: cannot plant %d at row %d col %d", static_cast<int>(name), row, col);
+            }
+        }
+    }
+}
+
+void GameWorld::stepBenchmark()
+{
+    // Not while a transition away from this scene is running
+    if (Director::getInstance()->getRunningScene() != this || benchmark_done) return;
+
+    auto stepStart = std::chrono::steady_clock::now();
+
+    // The previous step's frame has been drawn since; its render numbers are in now
+    if (benchmark_report.getFrameCount() > 0)
+    {
+        const WorldLayers::RenderStats& render = world_layers.getRenderStats();
+        benchmark_report.setLastRender(WorldLayers::getDrawCalls(),
+            render.child_sorts - benchmark_render_mark.child_sorts,
+            static_cast<float>(render.sort_ms - benchmark_render_mark.sort_ms));
+        benchmark_render_mark = render;
+    }
+
+    BenchmarkReport::Frame frame;
+    frame.draw_calls = 0;
+    frame.child_sorts = 0;
+    frame.sort_ms = 0.0f;
+    std::chrono::duration<float, std::milli> sinceLastStep = stepStart - benchmark_last_step;
+    frame.frame_ms = benchmark_report.getFrameCount() > 0 ? sinceLastStep.count() : 0.0f;
+    benchmark_last_step = stepStart;
+
+    auto scheduler = Director::getInstance()->getScheduler();
+    uint64_t allocationsBefore = AllocationCounter::getAllocations();
+    scheduler->setTimeScale(1.0f);
+    manual_stepping = true;
+    scheduler->update(benchmark_config.dt);
+    manual_stepping = false;
+    scheduler->setTimeScale(0.0f);
+
+    std::chrono::duration<float, std::milli> updateTime = std::chrono::steady_clock::now() - stepStart;
+    frame.update_ms = updateTime.count();
+    frame.allocations = static_cast<uint32_t>(AllocationCounter::getAllocations() - allocationsBefore);
+    frame.counts = countEntities();
+    benchmark_report.addFrame(frame);
+
+    if (benchmark_report.getFrameCount() >= benchmark_config.frames)
+    {
+        finishBenchmark();
+    }
+}
+
+void GameWorld::finishBenchmark()
+{
+    benchmark_done = true;
+
+    // log() rather than CCLOG: release builds are the ones worth measuring
+    std::string summary = benchmark_report.summarize(benchmark_config);
+    log("%s", summary.c_str());
+
+    std::string path = FileUtils::getInstance()->getWritablePath()
+        + StringUtils::format("benchmark_%s_%ld", benchmark_config.name.c_str(), static_cast<long>(time(nullptr)));
+    if (benchmark_report.writeCsv(path + ".csv", benchmark_config)
+        && FrameProfiler::getInstance()->dumpCsv(path + "_phases.csv"))
+    {
+        log("Benchmark: wrote %s.csv and %s_phases.csv", path.c_str(), path.c_str());
+    }
+    else
+    {
+        log("Benchmark: cannot write %s.csv", path.c_str());
+    }
+
+    if (benchmark_config.quit_when_done)
+    {
+        Director::getInstance()->end();
+        return;
+    }
+
+    // Leave the result on screen until the player leaves through the pause menu
+    if (profiler_label)
+    {
+        profiler_label->setString(summary);
+        profiler_label->setVisible(true);
+    }
+}
+
+// ----------------------------------------------------
+// Frame profiler
+// ----------------------------------------------------
+
+void GameWorld::setupProfilerOverlay()
+{
+    auto visibleSize = Director::getInstance()->getVisibleSize();
+    auto origin = Director::getInstance()->getVisibleOrigin();
+
+    profiler_label = Label::createWithSystemFont("", "Courier New", 14);
+    profiler_label->setAnchorPoint(Vec2(0.0f, 1.0f));
+    profiler_label->setPosition(Vec2(origin.x + 10, origin.y + visibleSize.height - 90));
+    profiler_label->setTextColor(Color4B::WHITE);
+    profiler_label->enableOutline(Color4B::BLACK, 1);
+    profiler_label->setVisible(false);
+    this->addChild(profiler_label, WIN_LOSE_LAYER + 1);
+
+    // F3 toggles the overlay, F4 writes the recorded frames to a CSV file
+    auto keyListener = EventListenerKeyboard::create();
+    keyListener->onKeyPressed = [this](EventKeyboard::KeyCode keyCode, Event* event) {
+        if (keyCode == EventKeyboard::KeyCode::KEY_F3)
+        {
+            profiler_label->setVisible(!profiler_label->isVisible());
+            profiler_refresh_timer = PROFILER_REFRESH_INTERVAL;
+        }
+        else if (keyCode == EventKeyboard::KeyCode::KEY_F4)
+        {
+            dumpProfilerCsv();
+        }
+    };
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(keyListener, this);
+}
+
+FrameProfiler::Counts GameWorld::countEntities() const
+{
+    FrameProfiler::Counts counts;
+    counts.zombies = zombie_lanes.getCount();
+    counts.plants = static_cast<int>(sun_producers.size() + attackers.size() + bombs.size());
+    counts.bullets = static_cast<int>(bullets.size());
+    counts.suns = static_cast<int>(suns.size());
+    counts.coins = static_cast<int>(coins.size());
+    counts.ice_tiles = ice_coverage.getCount();
+    return counts;
+}
+
+void GameWorld::endProfiledFrame(float delta)
+{
+    FrameProfiler::Counts counts = countEntities();
+    FrameProfiler::getInstance()->endFrame(counts);
+
+    if (!profiler_label || !profiler_label->isVisible()) return;
 
-    // Update unified time base
-    elapsed_time += delta;
+    // Sorting the history for p99 every frame would show up in the numbers it reports
+    profiler_refresh_timer += delta;
+    if (profiler_refresh_timer < PROFILER_REFRESH_INTERVAL) return;
+    profiler_refresh_timer = 0.0f;
 
-    // Update progress bar based on elapsed time
-    float progressPercent = (elapsed_time / TOTAL_GAME_TIME) * 100.0f;
-    if (progressPercent > 100.0f) progressPercent = 100.0f;
+    std::vector<FrameProfiler::Sample> samples;
+    FrameProfiler::getInstance()->snapshot(samples);
+    FrameProfiler::Summary summary[FrameProfiler::PHASE_COUNT + 1];
+    FrameProfiler::summarize(samples, summary);
 
-    if (progress_bar) {
-        progress_bar->setPercent(progressPercent);
+    std::string text = StringUtils::format("%-16s %7s %7s %7s\n", "phase (ms)", "min", "avg", "p99");
+    for (int phase = 0; phase <= FrameProfiler::PHASE_COUNT; ++phase)
+    {
+        const char* name = phase < FrameProfiler::PHASE_COUNT
+            ? FrameProfiler::getPhaseName(static_cast<ProfilePhase>(phase)) : "total";
+        text += StringUtils::format("%-16s %7.3f %7.3f %7.3f\n", name,
+            summary[phase].min_ms, summary[phase].avg_ms, summary[phase].p99_ms);
+    }
+    text += StringUtils::format("frames %d  zombies %d  plants %d  bullets %d  suns %d  coins %d  ice %d\n",
+        static_cast<int>(samples.size()), counts.zombies, counts.plants, counts.bullets,
+        counts.suns, counts.coins, counts.ice_tiles);
+    const WorldLayers::RenderStats& render = world_layers.getRenderStats();
+    text += StringUtils::format("draw calls %u  batches %d  child sorts %u (%.3f ms total)\n",
+        WorldLayers::getDrawCalls(), world_layers.getBatchCount(), render.child_sorts, render.sort_ms);
+    text += StringUtils::format("seed %llu", static_cast<unsigned long long>(FrameProfiler::getInstance()->getSeed()));
+    profiler_label->setString(text);
+}
 
-        // Update flag icon position to follow progress bar growth
-        if (flag_icon_right) {
-            float progressBarWidth = progress_bar->getContentSize().width;
-            float currentProgress = progressPercent / 100.0f; // Convert to 0.0 - 1.0
-            float progressBarLeftX = progress_bar->getPositionX() + progressBarWidth / 2;
-            float flagX = progressBarLeftX - progressBarWidth * currentProgress;
-            flag_icon_right->setPosition(Vec2(flagX, progress_bar->getPositionY() + 5));
-        }
+void GameWorld::sortAllChildren()
+{
+    if (!_reorderChildDirty)
+    {
+        Scene::sortAllChildren();
+        return;
     }
 
+    auto start = std::chrono::steady_clock::now();
+    Scene::sortAllChildren();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    world_layers.recordSort(elapsed.count());
+}
 
-    float t = elapsed_time / TOTAL_GAME_TIME;
-    if (t > 1.0f) t = 1.0f;
-
-    if (!final_wave_triggered && t >= 0.999f)
+void GameWorld::dumpProfilerCsv()
+{
+    std::string path = FileUtils::getInstance()->getWritablePath()
+        + StringUtils::format("frame_profile_%ld.csv", static_cast<long>(time(nullptr)));
+    if (FrameProfiler::getInstance()->dumpCsv(path))
     {
-        final_wave_triggered = true;
-        spawnFinalWave();
-        next_batch_time_sec = 1e9f; // Stop regular batches
+        CCLOG("FrameProfiler: wrote %s", path.c_str());
     }
-    else if (!final_wave_triggered && elapsed_time >= next_batch_time_sec)
+    else
     {
-        spawnTimedBatch(t);
+        CCLOG("FrameProfiler: cannot write %s", path.c_str());
     }
+}
 
+void GameWorld::updateZombieLanes(float delta)
+{
+    zombie_lanes.integrate(delta);
 
-    if (!is_night_mode)
+    // Per-zombie hooks; a tick may add an entry (thrown imp), so re-read the size
+    for (int row = 0; row < MAX_ROW; ++row)
     {
-        // Sun spawning system (every 5 seconds)
-        sun_spawn_timer += delta;
-        if (sun_spawn_timer >= 5.0f)
+        auto& lane = zombie_lanes.getRow(row);
+        for (size_t i = 0; i < lane.size(); ++i)
         {
-            spawnSunFromSky();
-            sun_spawn_timer = 0.0f;
+            if (lane.flags[i] & ZombieLanes::TICKS)
+            {
+                lane.zombie[i]->updateLaneTick(delta);
+            }
         }
     }
 
-    // Update Plants (Firing logic)
-    updatePlants(delta);
-
-    // Update Bullets (Movement and Collision)
-    updateBullets(delta);
-
-    // Update Zombies (Movement and Eating)
-    updateZombies(delta);
+    zombie_lanes.advanceTimers(delta);
 
-    // Update Suns (Movement and lifetime)
-    updateSuns(delta);
-    maybePlayZombieGroan(delta);
-
-    // Coin system update
-    updateCoins(delta);
-
-
-    //Update IceTile
-    updateIceTiles(delta);
-
-    // Cleanup
-    removeDeadPlants();
-    removeDeadZombies();
-    removeInactiveBullets();
-    removeExpiredSuns();
-    removeExpiredIceTiles();
-    removeExpiredCoins();
-
-    // Clean up off-screen Mowers
+    for (int row = 0; row < MAX_ROW; ++row)
     {
-        auto vs = Director::getInstance()->getVisibleSize();
-        for (int r = 0; r < MAX_ROW; ++r) {
-            auto mower = mower_per_row[r];
-            if (mower && mower->getPositionX() > vs.width + 100.0f) {
-                mower->removeFromParent();
-                mower_per_row[r] = nullptr;
+        auto& lane = zombie_lanes.getRow(row);
+        for (size_t i = 0; i < lane.size(); ++i)
+        {
+            if (lane.due[i])
+            {
+                lane.zombie[i]->bite();
             }
         }
     }
 
-    // Victory condition: Final wave has been triggered, all sub-batches have been scheduled, and no "alive" zombies on the field
-    // Container doesn't need to be empty, allows dead/dying zombies with animations
-    if (!win_shown && final_wave_triggered && final_wave_spawning_done)
+    // Write positions back once per frame. Anything that moved the sprite since the last
+    // write-back (the pole vault's MoveBy, Zomboni's crush) is adopted into the store.
+    for (int row = 0; row < MAX_ROW; ++row)
     {
-        bool anyAlive = false;
-        for (int r = 0; r < MAX_ROW && !anyAlive; ++r)
+        auto& lane = zombie_lanes.getRow(row);
+        const size_t size = lane.size();
+        float* x = lane.x.data();
+        float* y = lane.y.data();
+        float* shownX = lane.shown_x.data();
+        float* shownY = lane.shown_y.data();
+        Zombie* const* zombie = lane.zombie.data();
+
+        for (size_t i = 0; i < size; ++i)
         {
-            for (auto* z : zombies_in_row[r])
+            const Vec2& position = zombie[i]->getPosition();
+            float newX = x[i] + position.x - shownX[i];
+            float newY = y[i] + position.y - shownY[i];
+            if (newX != position.x || newY != position.y)
             {
-                if (z && !z->isDead()) { anyAlive = true; break; }
+                zombie[i]->setPosition(newX, newY);
             }
+            x[i] = shownX[i] = newX;
+            y[i] = shownY[i] = newY;
         }
-        if (!anyAlive)
-        {
-            showWinTrophy();
-        }
+    }
+}
+
+void GameWorld::updateSeedPackets(float delta)
+{
+    for (auto packet : seed_packets)
+    {
+        packet->updateState(sun_count);
     }
 }
 
 void GameWorld::updatePlants(float delta)
 {
-    for (int row = 0; row < MAX_ROW; ++row)
+    // Every plant is in exactly one category list, kept in grid order by listPlant.
+    // A plant's timers only feed its own action, so each one ticks right before it acts.
+
+    // Sun-producing plants (e.g., Sunflower)
+    for (const auto& placed : sun_producers)
     {
-        for (int col = 0; col < MAX_COL; ++col)
-        {
-            Plant* plant = plant_grid[row][col];
-            if (plant && !plant->isDead())
-            {
-                PlantCategory category = plant->getCategory();
+        placed.plant->update(delta);
+        if (placed.plant->isDead()) continue;
 
-                switch (category)
-                {
-                    case PlantCategory::SUN_PRODUCING:
-                    {
-                        // Sun-producing plants (e.g., Sunflower)
-                        SunProducingPlant* sunPlant = dynamic_cast<SunProducingPlant*>(plant);
-                        for (auto& sun : sunPlant->produceSun()) {
-                            if (sun)
-                            {
-                                this->addChild(sun, SUN_LAYER);
-                                suns.push_back(sun);
-                                CCLOG("Sun-producing plant produced sun at position (%.2f, %.2f)",
-                                    sun->getPositionX(), sun->getPositionY());
-                            }
-                        }
-                        break;
-                    }
+        for (auto& sun : placed.plant->produceSun()) {
+            if (sun)
+            {
+                addSun(sun);
+                LOG_DEBUG(ECONOMY, "Sun-producing plant produced sun at position (%.2f, %.2f)",
+                    sun->getPositionX(), sun->getPositionY());
+            }
+        }
+    }
 
-                    case PlantCategory::ATTACKING:
-                    {
-                        // Attacking plants (e.g., PeaShooter, Repeater, ThreePeater, Wallnut)
-                        // Pass all zombies to plant, let plant decide which rows to check
-                        AttackingPlant* attackPlant = dynamic_cast<AttackingPlant*>(plant);
-
-                        std::vector<Bullet*> newBullets = attackPlant->checkAndAttack(zombies_in_row, row);
-
-                        // Add all created bullets to scene and container
-                        for (Bullet* bullet : newBullets)
-                        {
-                            if (bullet)
-                            {
-                                this->addChild(bullet, BULLET_LAYER);
-                                bullets.push_back(bullet);
-                            }
-                        }
-                        break;
-                    }
+    // Attacking plants (e.g., PeaShooter, Repeater, ThreePeater)
+    // Pass the zombie index to the plant, let plant decide which rows to check
+    for (const auto& placed : attackers)
+    {
+        placed.plant->update(delta);
+        if (placed.plant->isDead()) continue;
 
-                    case PlantCategory::BOMB:
-                    {
-                        // Bomb plants (e.g., CherryBomb)
-                        BombPlant* bombPlant = dynamic_cast<BombPlant*>(plant);
-                        bombPlant->explode(zombies_in_row, row, col);
-                        break;
-                    }
+        std::vector<Bullet*> newBullets = placed.plant->checkAndAttack(lane_index, placed.row);
 
-                    default:
-                        CCLOG("Unknown plant category!");
-                        break;
-                }
+        // Add all created bullets to scene and container
+        for (Bullet* bullet : newBullets)
+        {
+            if (bullet)
+            {
+                // Recycled bullets are normally still attached to their batch
+                world_layers.addBatched(WorldLayer::BULLETS, bullet);
+                bullets.push_back(bullet);
             }
         }
     }
+
+    // Bomb plants (e.g., CherryBomb)
+    for (const auto& placed : bombs)
+    {
+        placed.plant->update(delta);
+        if (placed.plant->isDead()) continue;
+
+        placed.plant->explode(lane_index, placed.row, placed.col);
+    }
+}
+
+void GameWorld::listPlant(Plant* plant, int row, int col)
+{
+    population.onPlantPlaced(row);
+    plant->joinPopulation(&population, row, col);
+    plant->joinTimers(&timers);
+
+    switch (plant->getCategory())
+    {
+        case PlantCategory::SUN_PRODUCING:
+            insertInGridOrder(sun_producers, plant->asSunProducer(), row, col);
+            break;
+        case PlantCategory::ATTACKING:
+            insertInGridOrder(attackers, plant->asAttacker(), row, col);
+            break;
+        case PlantCategory::BOMB:
+            insertInGridOrder(bombs, plant->asBomb(), row, col);
+            break;
+        default:
+            LOG_ERROR(GENERAL, "Unknown plant category!");
+            break;
+    }
+}
+
+void GameWorld::unlistPlant(Plant* plant)
+{
+    switch (plant->getCategory())
+    {
+        case PlantCategory::SUN_PRODUCING:
+            eraseByPlant(sun_producers, plant->asSunProducer());
+            break;
+        case PlantCategory::ATTACKING:
+            eraseByPlant(attackers, plant->asAttacker());
+            break;
+        case PlantCategory::BOMB:
+            eraseByPlant(bombs, plant->asBomb());
+            break;
+        default:
+            break;
+    }
 }
 
 void GameWorld::updateBullets(float delta)
@@ -843,58 +1693,52 @@ void GameWorld::updateBullets(float delta)
             // Check if bullet is within valid row bounds
             if (row >= 0 && row < MAX_ROW)
             {
-                // CRITICAL FIX: Use iterator to avoid invalidation during iteration
-                // Iterate zombies in this row using iterator (safe for concurrent modification)
-                auto& zombiesInThisRow = zombies_in_row[row];
-                for (auto it = zombiesInThisRow.begin(); it != zombiesInThisRow.end(); ++it)
+                // Binary search the sorted row, then sweep the zombies within 60px on the X axis
+                Zombie* zombie = lane_index.findFirstHit(row, bullet->getBoundingBox(), 60.0f);
+                if (zombie)
                 {
-                    Zombie* zombie = *it;
-                    // Check pointer validity and skip dead/dying zombies
-                    if (zombie && !zombie->isDead())
+                    // Hit!
+                    zombie->takeDamage(static_cast<float>(bullet->getDamage()));
+                    bullet->deactivate();
+
+                    // Use virtual function to determine sound effect instead of dynamic_cast.
+                    // Hits of one frame are merged per clip by SoundManager
+                    if (!zombie->playsMetalHitSound())
+                    {
+                        SoundManager::getInstance()->post("bullet_hit.mp3", SoundPriority::LOW);
+                    }
+                    else 
                     {
-                        // Optimization: Simple x-axis check first before full bounding box
-                        float bulletX = bullet->getPositionX();
-                        float zombieX = zombie->getPositionX();
-
-                        // Check if bullet is close enough to zombie on X axis (assuming bullet moves right)
-                        if (bulletX < zombieX + 60 && bulletX > zombieX - 60)
-                        {
-                            if (bullet->getBoundingBox().intersectsRect(zombie->getBoundingBox()))
-                            {
-                                // Hit!
-                                zombie->takeDamage(static_cast<float>(bullet->getDamage()));
-                                bullet->deactivate();
-
-                                // Use virtual function to determine sound effect instead of dynamic_cast
-                                if (!zombie->playsMetalHitSound())
-                                {
-                                    cocos2d::AudioEngine::play2d("bullet_hit.mp3");
-                                }
-                                else 
-                                {
-                                    int r = cocos2d::random(1, 3);
-                                    switch (r) {
-                                        case 1:
-                                            cocos2d::AudioEngine::play2d("hittingiron1.mp3");
-                                            break;
-                                        case 2:
-                                            cocos2d::AudioEngine::play2d("hittingiron2.mp3");
-                                            break;
-                                        case 3:
-                                            cocos2d::AudioEngine::play2d("hittingiron3.mp3");
-                                            break;
-                                        default:
-                                            break;
-                                    }
-                                }
-                                break; // Bullet hits one zombie and disappears
-                            }
+                        int r = RandomService::getInstance()->get(RandomStreamId::COSMETIC).range(1, 3);
+                        switch (r) {
+                            case 1:
+                                SoundManager::getInstance()->post("hittingiron1.mp3", SoundPriority::LOW);
+                                break;
+                            case 2:
+                                SoundManager::getInstance()->post("hittingiron2.mp3", SoundPriority::LOW);
+                                break;
+                            case 3:
+                                SoundManager::getInstance()->post("hittingiron3.mp3", SoundPriority::LOW);
+                                break;
+                            default:
+                                break;
                         }
                     }
                 }
             }
         }
     }
+
+    // Movement after the hit test, as when bullets still ran their own scheduled update
+    advanceBullets(delta);
+}
+
+void GameWorld::advanceBullets(float delta)
+{
+    for (auto bullet : bullets)
+    {
+        if (bullet) bullet->update(delta);
+    }
 }
 
 void GameWorld::updateZombies(float delta)
@@ -910,6 +1754,39 @@ void GameWorld::updateZombies(float delta)
             }
         }
 
+        // Rake collision: check on this row
+        if (rake_per_row[row])
+        {
+            auto rake = rake_per_row[row];
+            std::vector<Zombie*> touching;
+            lane_index.queryOverlapping(row, rake->getBoundingBox(), touching);
+            if (!touching.empty())
+            {
+                Zombie* zombie = touching.front();
+                zombie->takeDamage(5000); // massive damage
+                rake->trigger(zombie);
+                rake_per_row[row] = nullptr; // one-time
+            }
+        }
+
+        // Mower collision (row-based)
+        if (mower_per_row[row])
+        {
+            auto mower = mower_per_row[row];
+            std::vector<Zombie*> touching;
+            lane_index.queryOverlapping(row, mower->getBoundingBox(), touching);
+            for (auto zombie : touching)
+            {
+                if (!mower->isMoving()) {
+                    mower->start();
+                } else {
+                    // kill zombies that the mower drives through
+                    SoundManager::getInstance()->post("limbs-pop.mp3", SoundPriority::NORMAL);
+                    zombie->takeDamage(99999);
+                }
+            }
+        }
+
         // CRITICAL FIX: Use iterator to avoid invalidation during iteration
         auto& zombiesInThisRow = zombies_in_row[row];
         for (auto it = zombiesInThisRow.begin(); it != zombiesInThisRow.end(); ++it)
@@ -918,42 +1795,17 @@ void GameWorld::updateZombies(float delta)
             // Check pointer validity and skip dead/dying zombies
             if (zombie && !zombie->isDead())
             {
-                    // Rake collision: check on this row
-                if (rake_per_row[row])
-                {
-                    auto rake = rake_per_row[row];
-                    Rect zbb = zombie->getBoundingBox();
-                    Rect rbb = rake->getBoundingBox();
-                    if (zbb.intersectsRect(rbb))
-                    {
-                        zombie->takeDamage(5000); // massive damage
-                        rake->trigger(zombie);
-                        rake_per_row[row] = nullptr; // one-time
-                    }
-                }
-
-                // Mower collision (row-based)
-                if (mower_per_row[row])
-                {
-                    auto mower = mower_per_row[row];
-                    Rect zbb = zombie->getBoundingBox();
-                    Rect mbb = mower->getBoundingBox();
-                    if (zbb.intersectsRect(mbb))
-                    {
-                        if (!mower->isMoving()) {
-                            mower->start();
-                        } else {
-                            // kill zombies that the mower drives through
-                            cocos2d::AudioEngine::play2d("limbs-pop.mp3", false, 1.0f);
-                            zombie->takeDamage(99999);
-                        }
-                    }
-                }
-
                 // Check if zombie reached the left edge of screen
                 float zombieX = zombie->getPositionX();
                 if (zombieX <= 0 && !is_gameover)
                 {
+                    // A benchmark keeps its load running instead of ending the level
+                    if (benchmark_mode)
+                    {
+                        zombie->takeDamage(99999);
+                        continue;
+                    }
+
                     // Game over!
                     showGameOver();
                     return;
@@ -967,78 +1819,58 @@ void GameWorld::updateZombies(float delta)
 
 void GameWorld::removeDeadPlants()
 {
-    for (int row = 0; row < MAX_ROW; ++row)
+    population.takePlantDeaths(plant_deaths);
+    for (const auto& death : plant_deaths)
     {
-        for (int col = 0; col < MAX_COL; ++col)
-        {
-            Plant* plant = plant_grid[row][col];
-            if (plant != nullptr && plant->isDead())
-            {
-                this->removeChild(plant);
-                plant_grid[row][col] = nullptr;
-            }
-        }
+        Plant* plant = death.plant;
+        if (plant_grid[death.row][death.col] != plant) continue;
+
+        unlistPlant(plant);
+        plant->removeFromParent();
+        plant_grid[death.row][death.col] = nullptr;
     }
 }
 
 void GameWorld::removeDeadZombies()
 {
-    for (int row = 0; row < MAX_ROW; ++row)
+    // Only zombies whose death animation finished are queued (isDead() just turned true)
+    population.takeZombieDeaths(zombie_deaths);
+    for (const auto& death : zombie_deaths)
     {
-        auto& zombiesInThisRow = zombies_in_row[row];
-        auto it = zombiesInThisRow.begin();
-        while (it != zombiesInThisRow.end())
-        {
-            Zombie* zombie = *it;
-            
-            // CRITICAL FIX: Only remove truly dead zombies (death animation finished)
-            // isDead() returns true only when _isDead == true && _isDying == false
-            if (zombie && zombie->isDead())
-            {
-                spawnCoinAfterZombieDeath(zombie);
-                // Safe removal sequence to prevent dangling pointers and double deletion:
-                // 1. Get pointer before erasing (iterator will be invalidated after erase)
-                Zombie* deadZombie = zombie;
-                
-                // 2. Remove from container FIRST (prevents phantom collision in other systems)
-                // This ensures no other code can access this zombie pointer
-                it = zombiesInThisRow.erase(it);
-                
-                // 3. Remove from scene (zombie has already finished death animation)
-                // Double-check pointer is still valid and has correct parent
-                if (deadZombie && deadZombie->getParent() == this)
-                {
-                    // removeChild will handle cleanup and release
-                    this->removeChild(deadZombie, true); // true = cleanup
-                }
-            }
-            else
-            {
-                ++it;
-            }
-        }
+        Zombie* deadZombie = death.zombie;
+        auto& zombiesInThisRow = zombies_in_row[death.row];
+        auto it = std::find(zombiesInThisRow.begin(), zombiesInThisRow.end(), deadZombie);
+        if (it == zombiesInThisRow.end()) continue;
+
+        spawnCoinAfterZombieDeath(deadZombie);
+
+        // Remove from the containers FIRST (prevents phantom collision in other systems)
+        zombiesInThisRow.erase(it);
+        deadZombie->leaveLanes();
+
+        // Then from the scene; pooled types go back to their free list for the next spawn
+        ZombiePool::getInstance()->release(deadZombie);
     }
 }
 
 void GameWorld::removeInactiveBullets()
 {
-    auto it = bullets.begin();
-    while (it != bullets.end())
+    // Order of the container does not matter: swap the dead bullet with the last one and pop
+    size_t i = 0;
+    while (i < bullets.size())
     {
-        if ((*it) && !(*it)->isActive())
-        {
-            // Safe removal sequence:
-            // 1. Get pointer
-            Bullet* b = *it;
-            // 2. Remove from container (iterator valid, pointer valid)
-            it = bullets.erase(it);
-            // 3. Remove from scene (might trigger destructor)
-            if (b) b->removeFromParent();
-        }
-        else
+        Bullet* b = bullets[i];
+        if (b && b->isActive())
         {
-            ++it;
+            ++i;
+            continue;
         }
+
+        bullets[i] = bullets.back();
+        bullets.pop_back();
+
+        // Keep the hidden bullet in the scene graph for reuse instead of removing it
+        if (b) BulletPool::getInstance()->release(b);
     }
 }
 
@@ -1050,15 +1882,6 @@ void GameWorld::updateMoneyBankDisplay()
     }
 }
 
-void GameWorld::updateCoins(float delta)
-{
-    for (auto coin : coins) {
-        if (coin) {
-            coin->update(delta);
-        }
-    }
-}
-
 void GameWorld::removeExpiredCoins()
 {
     coins.erase(
@@ -1101,161 +1924,40 @@ void GameWorld::updateSuns(float delta)
     }
 }
 
-int GameWorld::randRange(int a, int b)
+void GameWorld::releaseScheduledSpawns()
 {
-    if (b < a) std::swap(a,b);
-    return a + (rand() % (b - a + 1));
-}
+    if (!final_wave_triggered && elapsed_time >= wave_schedule.getFinalWaveTime())
+    {
+        final_wave_triggered = true;
+        showFinalWaveBanner();
+    }
 
-int GameWorld::applyNightFactor(int baseCount, bool allowZero)
-{
-    if (!is_night_mode) return baseCount;
-    if (baseCount <= 0) return 0;
-    float scaled = baseCount * 0.75f; // Reduce overall at night
-    int c = static_cast<int>(std::round(scaled));
-    if (!allowZero) c = std::max(1, c);
-    return std::max(0, c);
+    while (const WaveSpawn* spawn = wave_schedule.popDue(elapsed_time))
+    {
+        spawnZombieAtRow(spawn->type, spawn->row);
+    }
+
+    if (final_wave_triggered && !final_wave_spawning_done && elapsed_time >= wave_schedule.getSpawningDoneTime())
+    {
+        final_wave_spawning_done = true;
+    }
 }
 
-void GameWorld::spawnSubBatch(int normalCnt, int poleCnt, int bucketHeadCnt, int zamboniCnt, int gargantuarCnt, float delaySec)
+void GameWorld::spawnZombieAtRow(WaveZombie type, int row)
 {
-    this->runAction(Sequence::create(
-        DelayTime::create(delaySec),
-        CallFunc::create([=]() {
-            auto visibleSize = Director::getInstance()->getVisibleSize();
-            auto spawnAtRow = [&](cocos2d::Node* z, int row){
-                const float ZOMBIE_Y_OFFSET = 0.7f;
-                float y = GRID_ORIGIN.y + row * CELLSIZE.height + CELLSIZE.height * ZOMBIE_Y_OFFSET;
-                float x = visibleSize.width + 10;
-                z->setPosition(Vec2(x, y));
-                this->addChild(z, ENEMY_LAYER);
-                zombies_in_row[row].push_back(static_cast<Zombie*>(z));
-            };
-
-            for (int i = 0; i < normalCnt; ++i) {
-                if (auto z = NormalZombie::createZombie()) {
-                    int row = rand() % MAX_ROW;
-                    spawnAtRow(z, row);
-                }
-            }
-            for (int i = 0; i < poleCnt; ++i) {
-                if (auto z = PoleVaulter::createZombie()) {
-                    int row = rand() % MAX_ROW;
-                    spawnAtRow(z, row);
-                }
-            }
-            for (int i = 0; i < bucketHeadCnt; ++i) {
-                if (auto z = BucketHeadZombie::createZombie()) {
-                    int row = rand() % MAX_ROW;
-                    spawnAtRow(z, row);
-                }
-            }
-            for (int i = 0; i < zamboniCnt; ++i) {
-                if (auto z = Zomboni::createZombie()) {
-                    int row = rand() % MAX_ROW;
-                    spawnAtRow(z, row);
-                }
-            }
-            for (int i = 0; i < gargantuarCnt; ++i) {
-                if (auto z = Gargantuar::createZombie()) {
-                    int row = rand() % MAX_ROW;
-                    spawnAtRow(z, row);
-                }
-            }
-        }),
-        nullptr));
-}
-
-void GameWorld::spawnTimedBatch(float normalizedTime)
-{
-    // Phase division
-    bool p0 = normalizedTime <= 0.25f;
-    bool p1 = (normalizedTime > 0.25f && normalizedTime <= 0.60f);
-    bool p2 = (normalizedTime > 0.60f && normalizedTime < 0.999f);
-
-    // Phase parameters
-    int normalMin=1, normalMax=2;
-    float poleProb = 0.0f;
-    float bucketHeadProb = 0.0f; // New bucket head probability
-    float zamboniProb = 0.0f;
-    float gargantuarProb = 0.0f;
-    float intervalSec = 10.0f;
-    int subBatches = randRange(3,4);
-    float subDelay = 0.9f;
-
-    if (p0) {
-        normalMin = 1; normalMax = 2;
-        poleProb = 0.0f;
-        zamboniProb = 0.0f;
-        gargantuarProb = 0.0f;
-        intervalSec = 10.0f;
-    } else if (p1) {
-        normalMin = 3; normalMax = 5;
-        poleProb = 0.12f;         // Reduce pole vaulter probability
-        bucketHeadProb = 0.12f;   // New bucket head probability
-        zamboniProb = 0.10f;      // Reduce zamboni probability
-        gargantuarProb = 0.03f;   // Small probability for gargantuar
-        intervalSec = 10.0f;
-    } else if (p2) {
-        normalMin = 3; normalMax = 5;
-        poleProb = 0.20f;         // Reduce pole vaulter probability
-        bucketHeadProb = 0.25f;   // Increase bucket head probability
-        zamboniProb = 0.25f;      // Reduce zamboni probability
-        gargantuarProb = 0.08f;   // Slightly increase gargantuar probability
-        intervalSec = 12.0f;
-    }
-
-    // Adjust probability at night
-    float probScale = is_night_mode ? 0.8f : 1.0f;
-    poleProb *= probScale;
-    bucketHeadProb *= probScale;
-    zamboniProb *= probScale;
-    gargantuarProb *= probScale;
-
-    // Generate count for this batch
-    int normalCnt = randRange(normalMin, normalMax);
-    normalCnt = applyNightFactor(normalCnt, false);
-
-    int poleCnt = 0;
-    if (CCRANDOM_0_1() < poleProb) poleCnt = 1;
-
-    int zamboniCnt = 0;
-    if (CCRANDOM_0_1() < zamboniProb) zamboniCnt = 1;
-
-    int bucketHeadCnt = 0;
-    if (CCRANDOM_0_1() < bucketHeadProb) bucketHeadCnt = 1;
-
-    int gargantuarCnt = 0;
-    if (CCRANDOM_0_1() < gargantuarProb) gargantuarCnt = 1; // Maximum 1 gargantuar in regular phases
-
-    // Distribute to sub-batches
-    int nRemain = normalCnt, pRemain = poleCnt, bRemain = bucketHeadCnt, zRemain = zamboniCnt, gRemain = gargantuarCnt;
-    float startDelay = 0.0f;
-
-    auto takePortion = [](int& remain, int slotsLeft){
-        if (remain <= 0) return 0;
-        int base = remain / slotsLeft;
-        int extra = remain % slotsLeft;
-        int take = base + (extra > 0 ? 1 : 0);
-        remain -= take;
-        return take;
-    };
-
-    for (int i = 0; i < subBatches; ++i) {
-        int slotsLeft = subBatches - i;
-        int nThis = takePortion(nRemain, slotsLeft);
-        int pThis = takePortion(pRemain, slotsLeft);
-        int bThis = takePortion(bRemain, slotsLeft);
-        int zThis = takePortion(zRemain, slotsLeft);
-        int gThis = takePortion(gRemain, slotsLeft);
-        spawnSubBatch(nThis, pThis, bThis, zThis, gThis, startDelay + i * subDelay);
-    }
+    Zombie* z = ZombiePool::getInstance()->acquire(type);
+    if (!z) return;
 
-    // Next batch time
-    next_batch_time_sec = elapsed_time + intervalSec;
+    const float ZOMBIE_Y_OFFSET = 0.7f;
+    auto visibleSize = Director::getInstance()->getVisibleSize();
+    float y = GRID_ORIGIN.y + row * CELLSIZE.height + CELLSIZE.height * ZOMBIE_Y_OFFSET;
+    float x = visibleSize.width + 10;
+    z->setPosition(Vec2(x, y));
+    world_layers.add(WorldLayer::ZOMBIES, z);
+    enlistZombie(z, row);
 }
 
-void GameWorld::spawnFinalWave()
+void GameWorld::showFinalWaveBanner()
 {
     // Banner (subtitle displays for 4 seconds)
     auto visibleSize = Director::getInstance()->getVisibleSize();
@@ -1269,50 +1971,7 @@ void GameWorld::spawnFinalWave()
             FadeIn::create(0.2f), DelayTime::create(4.0f), FadeOut::create(0.3f),
             CallFunc::create([banner](){ banner->removeFromParent(); }), nullptr));
     }
-
-    float baseDelay = 4.0f; // Start spawning after subtitle plays for 4 seconds
-
-    // Adjust count at night
-    int gCount = applyNightFactor(2, false); // Two gargantuars (keep at least 1 at night)
-
-    // Configuration for several sub-batches
-    int normal2 = applyNightFactor(randRange(3,5), false);
-    int pole2 = (CCRANDOM_0_1() < (is_night_mode ? 0.18f : 0.28f)) ? 1 : 0;
-
-    int zambo3 = applyNightFactor(1, true); // May be 0 (reduced at night)
-    int normal3 = applyNightFactor(randRange(2,3), false);
-
-    int normal4 = applyNightFactor(randRange(3,4), false);
-    int pole4 = (CCRANDOM_0_1() < (is_night_mode ? 0.16f : 0.24f)) ? 1 : 0;
-
-    int zambo5 = applyNightFactor(1, true);
-    int normal5 = applyNightFactor(randRange(2,3), false);
-
-    // Flag zombie
-    auto z = FlagZombie::createZombie();
-    const float ZOMBIE_Y_OFFSET = 0.7f;
-    float y = GRID_ORIGIN.y + 3 * CELLSIZE.height + CELLSIZE.height * ZOMBIE_Y_OFFSET;
-    float x = visibleSize.width + 10;
-    z->setPosition(Vec2(x, y));
-    this->addChild(z, ENEMY_LAYER);
-    zombies_in_row[3].push_back(z);
-    // Add bucket head zombies in final wave
-    int bucket2 = (CCRANDOM_0_1() < (is_night_mode ? 0.25f : 0.35f)) ? 1 : 0;
-    int bucket4 = (CCRANDOM_0_1() < (is_night_mode ? 0.20f : 0.30f)) ? 1 : 0;
-
-    // Sub-batches: 0s gargantuar, 1.2s normal+pole+bucket, 2.4s zamboni+normal, 3.6s normal+pole+bucket, 4.8s zamboni+normal (all delayed by 4 seconds)
-    spawnSubBatch(0, 0, 0, 0, gCount, baseDelay + 0.0f);
     AudioEngine::play2d("zombies.mp3");
-    spawnSubBatch(normal2, pole2, bucket2, 0, 0, baseDelay + 1.2f);
-    spawnSubBatch(normal3, 0, 0, zambo3, 0, baseDelay + 2.4f);
-    spawnSubBatch(normal4, pole4, bucket4, 0, 0, baseDelay + 3.6f);
-    spawnSubBatch(normal5, 0, 0, zambo5, 0, baseDelay + 4.8f);
-
-    // After the last batch is scheduled, mark final wave as all released (delay a little more to ensure scheduling is complete)
-    this->runAction(Sequence::create(
-        DelayTime::create(baseDelay + 5.0f),
-        CallFunc::create([this](){ final_wave_spawning_done = true; }),
-        nullptr));
 }
 
 void GameWorld::showGameOver()
@@ -1439,6 +2098,25 @@ void GameWorld::showWinTrophy()
 }
 
 void GameWorld::toggleSpeedMode(Ref* sender)
+{
+    // During a replay the recorded deltas already carry the recorded speed; the button
+    // picks how many recorded frames run per real frame instead
+    if (playback)
+    {
+        speed_level = (speed_level + 1) % 3;
+        replay_speed = REPLAY_SPEEDS[speed_level];
+        if (speed_toggle_button)
+        {
+            speed_toggle_button->setSelectedIndex(speed_level);
+        }
+        return;
+    }
+
+    cycleSpeed();
+    recordInput(ReplayInputType::TOGGLE_SPEED);
+}
+
+void GameWorld::cycleSpeed()
 {
     speed_level = (speed_level + 1) % 3;
 
@@ -1542,7 +2220,8 @@ void GameWorld::resumeGame(Ref* sender)
     is_paused = false;
     Director::getInstance()->resume();
 
-    if (speed_level > 0)
+    // A replay keeps its speed in replay_speed and steps the scheduler itself
+    if (speed_level > 0 && !playback)
     {
         float timeScale = speed_level == 1 ? 2.0f : 3.0f;
         Director::getInstance()->getScheduler()->setTimeScale(timeScale);
@@ -1624,34 +2303,18 @@ void GameWorld::decreaseMusicVolume(Ref* sender)
 void GameWorld::spawnSunFromSky()
 {
     auto visibleSize = Director::getInstance()->getVisibleSize();
-    int targetCol = rand() % MAX_COL;
+    int targetCol = RandomService::getInstance()->get(RandomStreamId::SKY_SUN).below(MAX_COL);
     float startY = 700.0f;
     Sun* sun = Sun::createFromSky(targetCol, startY);
     if (sun)
     {
-        this->addChild(sun, SUN_LAYER);
-        suns.push_back(sun);
+        addSun(sun);
     }
 }
 
 void GameWorld::maybePlayZombieGroan(float delta)
 {
-    bool hasZombie = false;
-    for (int row = 0; row < MAX_ROW && !hasZombie; ++row)
-    {
-        auto& zombiesInThisRow = zombies_in_row[row];
-        for (auto it = zombiesInThisRow.begin(); it != zombiesInThisRow.end() && !hasZombie; ++it)
-        {
-            Zombie* zombie = *it;
-            if (zombie && !zombie->isDead())
-            {
-                hasZombie = true;
-                break;
-            }
-        }
-    }
-
-    if (!hasZombie)
+    if (!population.hasLiveZombies())
     {
         zombie_groan_timer = 1.0f;
         return;
@@ -1660,9 +2323,9 @@ void GameWorld::maybePlayZombieGroan(float delta)
     zombie_groan_timer -= delta;
     if (zombie_groan_timer <= 0.0f)
     {
-        if (CCRANDOM_0_1() < 0.05f)
+        if (RandomService::getInstance()->get(RandomStreamId::COSMETIC).unit() < 0.05f)
         {
-            cocos2d::AudioEngine::play2d("zombie_groan.mp3", false);
+            SoundManager::getInstance()->post("zombie_groan.mp3", SoundPriority::LOW);
         }
         zombie_groan_timer = 10.0f;
     }
@@ -1692,70 +2355,73 @@ void GameWorld::removeExpiredSuns()
 
 void GameWorld::addZombie(Zombie* z)
 {
+   world_layers.add(WorldLayer::ZOMBIES, z);
    float y = z->getPositionY();
    int row = static_cast<int>((y - CELLSIZE.height * 0.7f - GRID_ORIGIN.y) / CELLSIZE.height);
-   zombies_in_row[row].push_back(z);
+   enlistZombie(z, row);
 }
 
-void GameWorld::addIceTile(IceTile* ice)
+void GameWorld::addSun(Sun* sun)
+{
+    world_layers.add(WorldLayer::SUNS, sun);
+    suns.push_back(sun);
+    sun->startLifetime(&timers);
+}
+
+void GameWorld::addCoin(Coin* coin)
+{
+    world_layers.addBatched(WorldLayer::SUNS, coin);
+    coins.push_back(coin);
+    coin->startLifetime(&timers);
+}
+
+void GameWorld::enlistZombie(Zombie* z, int row)
 {
-    this->addChild(ice, ICE_LAYER);
-    ice_tiles.push_back(ice);
+    zombies_in_row[row].push_back(z);
+    z->joinLanes(&zombie_lanes, row);
+    population.onZombieSpawned(row);
+    z->joinPopulation(&population, row);
+    z->onEnterLawn();
 }
 
-void GameWorld::updateIceTiles(float delta)
+void GameWorld::addIceTile(IceTile* ice)
 {
-    for (auto ice : ice_tiles)
+    world_layers.addBatched(WorldLayer::ICE, ice);
+
+    // A slice is laid on the Zomboni's own row; it covers a cell only once it is over the lawn
+    Vec2 pos = ice->getPosition();
+    int row = static_cast<int>((pos.y - GRID_ORIGIN.y) / CELLSIZE.height);
+    row = std::max(0, std::min(MAX_ROW - 1, row));
+    int col = -1;
+    if (pos.x >= GRID_ORIGIN.x)
     {
-        ice->update(delta);
+        col = static_cast<int>((pos.x - GRID_ORIGIN.x) / CELLSIZE.width);
+        if (col >= MAX_COL) col = -1;
     }
+
+    ice_coverage.add(ice, row, col, ice->getLifetime());
 }
 
 void GameWorld::removeExpiredIceTiles()
 {
-    ice_tiles.erase(
-        std::remove_if(ice_tiles.begin(), ice_tiles.end(),
-            [](IceTile* ice)
-            {
-                if (!ice) return true;
-
-                if (ice->isExpired())
-                {
-                    ice->removeFromParent();
-                    return true;
-                }
-                return false;
-            }),
-        ice_tiles.end()
-    );
+    ice_coverage.takeMelted(melted_ice);
+    for (auto ice : melted_ice)
+    {
+        ice->removeFromParent();
+    }
+    melted_ice.clear();
 }
 
 bool GameWorld::hasIceAt(int row,int col) const
 {
-    for (auto ice : ice_tiles)
-    {
-        if (!ice) continue;
-        if (ice->isExpired()) continue;
-        
-        int iceRow, iceCol;
-        if (!getGridCoordinates(ice->getPosition(), iceRow, iceCol))
-            continue;
-
-        if (iceRow== row && iceCol==col)
-        {
-            return true;
-        }
-    }
-    return false;
+    if (row < 0 || row >= MAX_ROW || col < 0 || col >= MAX_COL) return false;
+    return ice_coverage.isCovered(row, col);
 }
 
 void GameWorld::removeIceInRow(int row)
 {
-    for (auto& ice : ice_tiles) {
-        if (ice && ice->getRow() == row) {
-            ice->markAsExpired();
-        }
-    }
+    if (row < 0 || row >= MAX_ROW) return;
+    ice_coverage.clearRow(row);
 }
 
 void GameWorld::spawnCoinAfterZombieDeath(Zombie* zombie)
@@ -1765,31 +2431,28 @@ void GameWorld::spawnCoinAfterZombieDeath(Zombie* zombie)
     
     // Use virtual function to get coin drop bonus instead of dynamic_cast
     float possibilityBonus = zombie->getCoinDropBonus();
-    float r = CCRANDOM_0_1();
+    float r = RandomService::getInstance()->get(RandomStreamId::LOOT).unit();
 
     float silver = 0.4f, gold = 0.2f, diamond = 0.05f;
     if (r <= possibilityBonus * diamond) {
         auto coin = Coin::create(Coin::CoinType::DIAMOND);
         if (coin) {
             coin->setPosition(zombie->getPosition());
-            this->addChild(coin, SUN_LAYER);
-            coins.push_back(coin);
+            addCoin(coin);
         }
     }
     else if (r <= possibilityBonus * gold) {
         auto coin = Coin::create(Coin::CoinType::GOLD);
         if (coin) {
             coin->setPosition(zombie->getPosition());
-            this->addChild(coin, SUN_LAYER);
-            coins.push_back(coin);
+            addCoin(coin);
         }
     }
     else if (r <= possibilityBonus * silver) {
         auto coin = Coin::create(Coin::CoinType::SILVER);
         if (coin) {
             coin->setPosition(zombie->getPosition());
-            this->addChild(coin, SUN_LAYER);
-            coins.push_back(coin);
+            addCoin(coin);
         }
     }
 
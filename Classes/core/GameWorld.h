@@ -2,8 +2,20 @@
 #define __GAMEWORLD_H__
 
 #include "GameDefs.h"
+#include "LaneIndex.h"
+#include "ZombieLanes.h"
+#include "PopulationTracker.h"
+#include "TimerWheel.h"
+#include "IceCoverage.h"
+#include "WorldLayers.h"
+#include "WaveSchedule.h"
+#include "Replay.h"
+#include "Benchmark.h"
 #include "ui/CocosGUI.h"
 #include "cocos2d.h"
+#include <chrono>
+#include <memory>
+#include <string>
 #include <vector>
 
 // Forward declarations to improve compilation time
@@ -21,11 +33,38 @@ class Coin;
 class Rake;
 class Mower;
 
+/** @brief A live plant of one category and the cell it occupies */
+template <typename T>
+struct PlacedPlant
+{
+    T* plant;
+    int row;
+    int col;
+};
+
 class GameWorld : public cocos2d::Scene
 {
 public:
-    static cocos2d::Scene* createScene(bool isNightMode = false, const std::vector<PlantName>& plantNames = std::vector<PlantName>());
-    static GameWorld* create(bool isNightMode = false, const std::vector<PlantName>& plantNames = std::vector<PlantName>());
+    /**
+     * @param seed Level seed, e.g. the one SelectCardsScene planned its zombie pool with; 0 draws a fresh one
+     */
+    static cocos2d::Scene* createScene(bool isNightMode = false, const std::vector<PlantName>& plantNames = std::vector<PlantName>(), uint64_t seed = 0);
+    static GameWorld* create(bool isNightMode = false, const std::vector<PlantName>& plantNames = std::vector<PlantName>(), uint64_t seed = 0);
+
+    /**
+     * @brief Plays a recorded session back instead of taking touch input.
+     * @param seekFrame Frame to fast-forward to with rendering and sound off (0 plays from the start)
+     */
+    static cocos2d::Scene* createReplayScene(std::shared_ptr<Replay> replay, uint32_t seekFrame = 0);
+
+    /**
+     * @brief Runs a scripted load for a fixed number of frames at a fixed delta, then writes
+     * frame-time percentiles, peak entity counts and allocation counts to the writable path.
+     */
+    static cocos2d::Scene* createBenchmarkScene(const BenchmarkConfig& config);
+
+    /** @brief Where the most recent session was saved */
+    static std::string getLastReplayPath();
 
     virtual bool init() override;
     virtual ~GameWorld();
@@ -82,12 +121,15 @@ private:
     /** @brief Main game loop logic */
     virtual void update(float delta) override;
 
-    // Phased Batch Generation (Wave System)
-    void spawnTimedBatch(float normalizedTime);
-    void spawnFinalWave();
-    void spawnSubBatch(int normalCnt, int poleCnt, int bucketHeadCnt, int zamboniCnt, int gargantuarCnt, float delaySec);
-    int randRange(int a, int b);
-    int applyNightFactor(int baseCount, bool allowZero = false);
+    /** @brief Times re-sorts of the scene's own child list into the render stats */
+    virtual void sortAllChildren() override;
+
+    // Wave System: the level's spawns are planned at init and released from update()
+    /** @brief Releases every scheduled zombie that is due and starts the final wave on time */
+    void releaseScheduledSpawns();
+    void spawnZombieAtRow(WaveZombie type, int row);
+    /** @brief Banner and sounds of the final wave; its zombies come from the schedule */
+    void showFinalWaveBanner();
 
     /** @brief Victory sequence when all waves are cleared */
     void showWinTrophy();
@@ -112,13 +154,57 @@ private:
 
     // Component update functions
     void updateZombies(float delta);
+    void updateZombieLanes(float delta);
+    void updateSeedPackets(float delta);
     void updatePlants(float delta);
     void updateBullets(float delta);
+    void advanceBullets(float delta);
     void updateMoneyBankDisplay();
-    void updateCoins(float delta);
     void updateSunDisplay();
     void updateSuns(float delta);
-    void updateIceTiles(float delta);
+
+    // Put suns and coins on the lawn and start their lifetime
+    void addSun(Sun* sun);
+    void addCoin(Coin* coin);
+
+    // Adds a zombie to zombies_in_row and the lane store
+    void enlistZombie(Zombie* z, int row);
+
+    // Keep the per-category plant lists in step with plant_grid
+    void listPlant(Plant* plant, int row, int col);
+    void unlistPlant(Plant* plant);
+
+    // Gameplay inputs, called by the touch handlers and by replays
+    bool collectAt(const cocos2d::Vec2& pos);
+    void selectShovel();
+    void selectSeedPacket(int index, const cocos2d::Vec2& previewPos);
+    void removePlantWithShovel(const cocos2d::Vec2& shovelTipPos);
+    void plantSelectedPacket(const cocos2d::Vec2& pos);
+    void cycleSpeed();
+
+    // Replay recording and playback
+    void setupReplay();
+    void recordInput(ReplayInputType type, int index = 0, const cocos2d::Vec2& pos = cocos2d::Vec2::ZERO);
+    void applyInput(const ReplayInput& input);
+    void beginReplayFrame(float delta);
+    ReplayKeyframe captureKeyframe() const;
+    void stepReplay();
+    void seekReplay(uint32_t frame);
+    void saveRecording();
+
+    // Benchmark mode
+    void setupBenchmark();
+    void plantBenchmarkGrid();
+    void stepBenchmark();
+    void finishBenchmark();
+
+    /** @brief Entities alive right now, as the profiler and the benchmark count them */
+    FrameProfiler::Counts countEntities() const;
+
+    // Frame profiler overlay (F3) and CSV dump (F4)
+    void setupProfilerOverlay();
+    void endProfiledFrame(float delta);
+    void dumpProfilerCsv();
 
     // Garbage collection for dead objects
     void removeDeadZombies();
@@ -139,6 +225,11 @@ private:
     // Grid Storage: directly stores Plant pointers for O(1) access
     Plant* plant_grid[MAX_ROW][MAX_COL];
 
+    // Live plants by category in grid order, so updatePlants needs no grid walk or RTTI
+    std::vector<PlacedPlant<SunProducingPlant>> sun_producers;
+    std::vector<PlacedPlant<AttackingPlant>> attackers;
+    std::vector<PlacedPlant<BombPlant>> bombs;
+
     // Interaction State
     bool plant_selected;
     int selected_seedpacket_index;
@@ -158,7 +249,6 @@ private:
     cocos2d::ui::LoadingBar* progress_bar;
     cocos2d::Sprite* progress_bar_full;
     float elapsed_time = 0.0f;
-    const float TOTAL_GAME_TIME = 300.0f;
 
     // Resource System
     int sun_count;
@@ -166,10 +256,18 @@ private:
     cocos2d::Label* money_count_label;
 
     // Object Containers
+    WorldLayers world_layers;                   // Per-category nodes the lawn entities are drawn from
     std::vector<Zombie*> zombies_in_row[MAX_ROW];
+    LaneIndex lane_index;                       // Sorted per-row view of zombies_in_row, rebuilt every frame
+    ZombieLanes zombie_lanes;                   // Per-row movement and attack timers of every zombie
+    PopulationTracker population;               // Live counters and this frame's deaths
+    std::vector<PopulationTracker::ZombieDeath> zombie_deaths;  // Drain buffers, reused every frame
+    std::vector<PopulationTracker::PlantDeath> plant_deaths;
     std::vector<Bullet*> bullets;
     std::vector<Sun*> suns;
-    std::vector<IceTile*> ice_tiles;
+    TimerWheel timers;                          // Game-time lifetimes, cooldowns and ice melt
+    IceCoverage ice_coverage;                   // Iced cells and the melt schedule of every ice slice
+    std::vector<IceTile*> melted_ice;           // Slices to take off the lawn this frame
     std::vector<Coin*> coins;
 
     // Map Utilities
@@ -177,8 +275,7 @@ private:
     Mower* mower_per_row[MAX_ROW];
 
     // Wave/Batch Spawning State
-    int current_wave;
-    float next_batch_time_sec;
+    WaveSchedule wave_schedule;                 // Every zombie of the level, planned from the seed at init
     bool final_wave_triggered{ false };
 
     // Win/Lose Flow State
@@ -190,6 +287,7 @@ private:
     float sun_spawn_timer;
     int background_music_id{ -1 };
     bool is_night_mode{ false };
+    uint64_t level_seed{ 0 };                   // Seed passed to create(), 0 for a fresh one
 
     // Speed Control
     int speed_level{ 0 };
@@ -205,10 +303,48 @@ private:
     float music_volume{ 1.0f };
     bool is_gameover{ false };
     bool game_started{ false };
+
+    // Frame Profiler
+    cocos2d::Label* profiler_label{ nullptr };
+    float profiler_refresh_timer{ 0.0f };
+
+    // Replay
+    Replay recording;                           // This session, saved when the scene goes away
+    std::shared_ptr<Replay> playback;           // Session being replayed, or null
+    uint32_t frame_index{ 0 };                  // Updates run so far, the time base of replays
+    size_t next_replay_input{ 0 };
+    uint32_t replay_seek_target{ 0 };
+    int replay_speed{ 1 };                      // Recorded frames per real frame
+    bool manual_stepping{ false };
+    bool replay_diverged{ false };
+    bool replay_finished{ false };
+    cocos2d::EventListenerCustom* step_listener{ nullptr };   // Replay or benchmark stepping
+
+    // Benchmark
+    bool benchmark_mode{ false };
+    BenchmarkConfig benchmark_config;
+    BenchmarkReport benchmark_report;
+    float benchmark_spawn_timer{ 0.0f };
+    bool benchmark_done{ false };
+    std::chrono::steady_clock::time_point benchmark_last_step;
+    WorldLayers::RenderStats benchmark_render_mark;     // Render totals when the last frame was recorded
 };
 
 // Global Wave Constants
 const float FIRST_WAVE_TIME = 60.0f;
 const float MIN_WAVE_INTERVAL = 10.0f;
 
+// Projectile pool sizes pre-warmed at level start
+const int BULLET_POOL_PEAS = 64;
+const int BULLET_POOL_PUFFS = 16;
+
+// Seconds between frame profiler overlay refreshes
+const float PROFILER_REFRESH_INTERVAL = 0.5f;
+
+// Replay playback: frames per real frame for each speed button state, while seeking,
+// and the frames one seek key press moves
+const int REPLAY_SPEEDS[3] = { 1, 4, 16 };
+const int REPLAY_SEEK_STEPS = 240;
+const uint32_t REPLAY_SEEK_FRAMES = 600;
+
 #endif // __GAMEWORLD_H__
\ No newline at end of file
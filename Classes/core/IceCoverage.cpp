@@ -0,0 +1,105 @@
+#include "IceCoverage.h"
+
+IceCoverage::IceCoverage()
+    : timers(nullptr)
+{
+    reset(nullptr);
+}
+
+IceCoverage::~IceCoverage()
+{
+    reset(nullptr);
+}
+
+void IceCoverage::reset(TimerWheel* newTimers)
+{
+    if (timers)
+    {
+        for (auto& slice : slices)
+        {
+            timers->cancel(slice.melt);
+        }
+    }
+    timers = newTimers;
+
+    for (int row = 0; row < MAX_ROW; ++row)
+    {
+        for (int col = 0; col < MAX_COL; ++col)
+        {
+            coverage[row][col] = 0;
+        }
+        row_head[row] = -1;
+    }
+    count = 0;
+
+    slices.clear();
+    free_slices.clear();
+    melted.clear();
+}
+
+void IceCoverage::add(IceTile* tile, int row, int col, float lifetime)
+{
+    int index;
+    if (!free_slices.empty())
+    {
+        index = free_slices.back();
+        free_slices.pop_back();
+    }
+    else
+    {
+        slices.push_back(Slice());
+        index = static_cast<int>(slices.size()) - 1;
+    }
+
+    Slice& slice = slices[index];
+    slice.tile = tile;
+    slice.row = row;
+    slice.col = col;
+    slice.prev = -1;
+    slice.next = row_head[row];
+    if (slice.next >= 0) slices[slice.next].prev = index;
+    row_head[row] = index;
+
+    if (col >= 0) ++coverage[row][col];
+    ++count;
+
+    if (timers) slice.melt = timers->schedule(lifetime, this, index);
+}
+
+void IceCoverage::release(int index)
+{
+    Slice& slice = slices[index];
+
+    if (slice.prev >= 0) slices[slice.prev].next = slice.next;
+    else row_head[slice.row] = slice.next;
+    if (slice.next >= 0) slices[slice.next].prev = slice.prev;
+
+    if (slice.col >= 0) --coverage[slice.row][slice.col];
+
+    melted.push_back(slice.tile);
+    slice.tile = nullptr;
+    free_slices.push_back(index);
+    --count;
+}
+
+void IceCoverage::onTimer(int tag)
+{
+    slices[tag].melt = TimerWheel::Handle();
+    release(tag);
+}
+
+void IceCoverage::clearRow(int row)
+{
+    while (row_head[row] >= 0)
+    {
+        int index = row_head[row];
+        if (timers) timers->cancel(slices[index].melt);
+        release(index);
+    }
+}
+
+void IceCoverage::takeMelted(std::vector<IceTile*>& out)
+{
+    out.clear();
+    out.swap(melted);
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "GameTypes.h"
+#include "TimerWheel.h"
+#include <vector>
+
+class IceTile;
+
+/**
+ * @brief Which lawn cells are iced, and which Zomboni trail slices have melted.
+ *
+ * Every slice bumps a counter on the cell it lies on, so "is this cell iced" is one read no matter
+ * how many Zombonis have driven through. Slices are also linked into a list per row, which is all
+ * a Jalapeno has to walk, and melt on their own through a TimerWheel deadline.
+ */
+class IceCoverage : public TimerListener
+{
+public:
+    IceCoverage();
+    virtual ~IceCoverage();
+
+    /** @brief Forgets every slice and schedules new melts on timers, e.g. at level start */
+    void reset(TimerWheel* timers);
+
+    /**
+     * @brief Starts tracking a slice until it melts
+     * @param row Lawn row the slice lies in
+     * @param col Cell it covers, or -1 while still off the lawn (tracked, covers nothing)
+     * @param lifetime Seconds until the slice melts on its own
+     */
+    void add(IceTile* tile, int row, int col, float lifetime);
+
+    /** @brief Melts the whole row at once */
+    void clearRow(int row);
+
+    /** @brief Moves the slices melted since the last call into out (cleared first) */
+    void takeMelted(std::vector<IceTile*>& out);
+
+    bool isCovered(int row, int col) const { return coverage[row][col] > 0; }
+
+    int getCount() const { return count; }
+
+    virtual void onTimer(int tag) override;
+
+private:
+    struct Slice
+    {
+        IceTile* tile;
+        int row;
+        int col;
+        int prev;               // Neighbours in the row list, -1 at the ends
+        int next;
+        TimerWheel::Handle melt;
+    };
+
+    void release(int index);
+
+    TimerWheel* timers;
+    int coverage[MAX_ROW][MAX_COL];
+    int row_head[MAX_ROW];
+    int count;
+
+    std::vector<Slice> slices;
+    std::vector<int> free_slices;
+    std::vector<IceTile*> melted;
+};
@@ -0,0 +1,118 @@
+#include "LaneIndex.h"
+#include "Zombie.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+LaneIndex::LaneIndex()
+{
+    clear();
+}
+
+void LaneIndex::clear()
+{
+    for (int row = 0; row < MAX_ROW; ++row)
+    {
+        rows[row].clear();
+        max_left[row] = 0.0f;
+        max_right[row] = 0.0f;
+    }
+}
+
+void LaneIndex::rebuild(const std::vector<Zombie*> zombiesInRow[MAX_ROW])
+{
+    for (int row = 0; row < MAX_ROW; ++row)
+    {
+        auto& entries = rows[row];
+        entries.clear();
+        max_left[row] = 0.0f;
+        max_right[row] = 0.0f;
+
+        for (auto zombie : zombiesInRow[row])
+        {
+            if (!zombie || zombie->isDead()) continue;
+
+            Entry e;
+            e.zombie = zombie;
+            e.x = zombie->getPositionX();
+            e.box = zombie->getBoundingBox();
+            max_left[row] = std::max(max_left[row], e.x - e.box.getMinX());
+            max_right[row] = std::max(max_right[row], e.box.getMaxX() - e.x);
+            entries.push_back(e);
+        }
+
+        std::sort(entries.begin(), entries.end(),
+            [](const Entry& a, const Entry& b) { return a.x < b.x; });
+    }
+}
+
+size_t LaneIndex::lowerBound(int row, float value) const
+{
+    const auto& entries = rows[row];
+    auto it = std::lower_bound(entries.begin(), entries.end(), value,
+        [](const Entry& e, float v) { return e.x < v; });
+    return static_cast<size_t>(it - entries.begin());
+}
+
+Zombie* LaneIndex::findFirstHit(int row, const Rect& box, float reach) const
+{
+    if (row < 0 || row >= MAX_ROW) return nullptr;
+
+    const auto& entries = rows[row];
+    float center = box.getMidX();
+    for (size_t i = lowerBound(row, center - reach); i < entries.size(); ++i)
+    {
+        const Entry& e = entries[i];
+        if (e.x >= center + reach) break;
+        if (e.x <= center - reach) continue;
+        if (!e.zombie->isDead() && box.intersectsRect(e.box)) return e.zombie;
+    }
+    return nullptr;
+}
+
+bool LaneIndex::hasZombieAhead(int row, float fromX, float toX) const
+{
+    if (row < 0 || row >= MAX_ROW) return false;
+
+    const auto& entries = rows[row];
+    for (size_t i = lowerBound(row, fromX); i < entries.size(); ++i)
+    {
+        const Entry& e = entries[i];
+        if (e.x > toX) break;
+        if (e.x > fromX && !e.zombie->isDead()) return true;
+    }
+    return false;
+}
+
+void LaneIndex::queryRange(int minRow, int maxRow, float minX, float maxX, std::vector<Zombie*>& out) const
+{
+    minRow = std::max(0, minRow);
+    maxRow = std::min(MAX_ROW - 1, maxRow);
+
+    for (int row = minRow; row <= maxRow; ++row)
+    {
+        const auto& entries = rows[row];
+        for (size_t i = lowerBound(row, minX); i < entries.size(); ++i)
+        {
+            const Entry& e = entries[i];
+            if (e.x > maxX) break;
+            if (!e.zombie->isDead()) out.push_back(e.zombie);
+        }
+    }
+}
+
+void LaneIndex::queryOverlapping(int row, const Rect& rect, std::vector<Zombie*>& out) const
+{
+    if (row < 0 || row >= MAX_ROW) return;
+
+    // Any box overlapping rect has its x within rect widened by the row's largest extents
+    const auto& entries = rows[row];
+    float lo = rect.getMinX() - max_right[row];
+    float hi = rect.getMaxX() + max_left[row];
+    for (size_t i = lowerBound(row, lo); i < entries.size(); ++i)
+    {
+        const Entry& e = entries[i];
+        if (e.x > hi) break;
+        if (!e.zombie->isDead() && rect.intersectsRect(e.box)) out.push_back(e.zombie);
+    }
+}
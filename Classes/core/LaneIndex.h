@@ -0,0 +1,77 @@
+#pragma once
+
+#include "GameTypes.h"
+#include "cocos2d.h"
+#include <cfloat>
+#include <vector>
+
+class Zombie;
+
+/**
+ * @brief Per-row spatial index of the zombies on the lawn.
+ *
+ * Rebuilt once per frame by GameWorld before plants, bullets and mowers run.
+ * Each row keeps its zombies sorted by x together with a cached bounding box, so
+ * collision consumers do a binary search plus a short sweep instead of testing every
+ * zombie in the row. Liveness (Zombie::isDead) is checked at query time, so zombies
+ * killed earlier in the same frame are skipped.
+ *
+ * Pointers stay valid until GameWorld removes dead zombies at the end of the frame.
+ */
+class LaneIndex
+{
+public:
+    /** @struct Entry */
+    struct Entry
+    {
+        Zombie* zombie;
+        float x;                    // Position x at rebuild time (sort key)
+        cocos2d::Rect box;          // Bounding box at rebuild time
+    };
+
+    LaneIndex();
+
+    /** @brief Rebuild every row from GameWorld's zombie containers */
+    void rebuild(const std::vector<Zombie*> zombiesInRow[MAX_ROW]);
+
+    /** @brief Drop all entries */
+    void clear();
+
+    /** @brief Entries of one row, sorted by x */
+    const std::vector<Entry>& getRow(int row) const { return rows[row]; }
+
+    /**
+     * @brief Leftmost live zombie of a row hit by a box.
+     * @param row Row to search
+     * @param box Box of the projectile
+     * @param reach Maximum horizontal distance between the box center and the zombie position
+     * @return nullptr if nothing is hit
+     */
+    Zombie* findFirstHit(int row, const cocos2d::Rect& box, float reach) const;
+
+    /**
+     * @brief True if a live zombie stands in (fromX, toX] in a row.
+     * Used by shooters, which only fire at zombies to their right.
+     */
+    bool hasZombieAhead(int row, float fromX, float toX = FLT_MAX) const;
+
+    /**
+     * @brief Area query on zombie positions: rows [minRow, maxRow] x [minX, maxX].
+     * Rows are clamped to the lawn. Results are appended to out.
+     */
+    void queryRange(int minRow, int maxRow, float minX, float maxX, std::vector<Zombie*>& out) const;
+
+    /**
+     * @brief Live zombies of a row whose bounding box intersects rect.
+     * Results are appended to out.
+     */
+    void queryOverlapping(int row, const cocos2d::Rect& rect, std::vector<Zombie*>& out) const;
+
+private:
+    /** @brief Index of the first entry with x >= value */
+    size_t lowerBound(int row, float value) const;
+
+    std::vector<Entry> rows[MAX_ROW];
+    float max_left[MAX_ROW];        // Largest (x - box.minX) in the row
+    float max_right[MAX_ROW];       // Largest (box.maxX - x) in the row
+};
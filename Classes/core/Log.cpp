@@ -0,0 +1,298 @@
+#include "Log.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace
+{
+    void writeToStderr(const char* line)
+    {
+        std::fputs(line, stderr);
+        std::fputc('\n', stderr);
+    }
+
+    struct Writer
+    {
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::thread thread;
+        bool running = false;
+        bool stopping = false;
+
+        char ring[Log::RING_SIZE][Log::LINE_LENGTH];
+        size_t head = 0;        // Next line to write
+        size_t tail = 0;        // Next free slot
+        uint64_t dropped = 0;
+
+        Log::Sink sink = writeToStderr;
+    };
+
+    Writer& writer()
+    {
+        static Writer instance;
+        return instance;
+    }
+
+    std::atomic<bool> enabled[static_cast<int>(LogCategory::COUNT)] = {
+        { true }, { true }, { true }, { true }, { true }, { true }
+    };
+
+    std::atomic<uint32_t> rate_limit(20);
+
+    const char* levelTag(LogLevel level)
+    {
+        switch (level)
+        {
+            case LogLevel::TRACE: return "T";
+            case LogLevel::DEBUG: return "D";
+            case LogLevel::INFO:  return "I";
+            case LogLevel::WARN:  return "W";
+            case LogLevel::ERROR: return "E";
+            default:              return "?";
+        }
+    }
+
+    uint64_t nowMs()
+    {
+        using namespace std::chrono;
+        return static_cast<uint64_t>(duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
+    }
+
+    void runWriter()
+    {
+        Writer& w = writer();
+        char line[Log::LINE_LENGTH];
+
+        std::unique_lock<std::mutex> lock(w.mutex);
+        for (;;)
+        {
+            w.wake.wait(lock, [&w]() { return w.head != w.tail || w.stopping; });
+
+            // Hand lines to the sink one at a time, outside the lock
+            while (w.head != w.tail)
+            {
+                std::memcpy(line, w.ring[w.head % Log::RING_SIZE], sizeof(line));
+                ++w.head;
+                Log::Sink sink = w.sink;
+                lock.unlock();
+                sink(line);
+                lock.lock();
+            }
+
+            if (w.stopping) return;
+        }
+    }
+}
+
+static_assert(sizeof(enabled) / sizeof(enabled[0]) == static_cast<size_t>(LogCategory::COUNT),
+    "every log category needs an enable flag");
+
+// ----------------------------------------------------
+// Rate limit
+// ----------------------------------------------------
+
+bool Log::RateLimit::allow()
+{
+    uint64_t now = nowMs();
+    if (now - window_start_ms >= 1000)
+    {
+        window_start_ms = now;
+        count = 0;
+    }
+
+    if (count < rate_limit.load(std::memory_order_relaxed))
+    {
+        ++count;
+        return true;
+    }
+
+    ++suppressed;
+    return false;
+}
+
+uint32_t Log::RateLimit::takeSuppressed()
+{
+    uint32_t result = suppressed;
+    suppressed = 0;
+    return result;
+}
+
+// ----------------------------------------------------
+// Configuration
+// ----------------------------------------------------
+
+void Log::setSink(Sink sink)
+{
+    Writer& w = writer();
+    std::lock_guard<std::mutex> lock(w.mutex);
+    w.sink = sink ? sink : writeToStderr;
+}
+
+bool Log::isEnabled(LogCategory category)
+{
+    return enabled[static_cast<int>(category)].load(std::memory_order_relaxed);
+}
+
+void Log::setEnabled(LogCategory category, bool on)
+{
+    enabled[static_cast<int>(category)].store(on, std::memory_order_relaxed);
+}
+
+void Log::configure(const char* spec)
+{
+    if (!spec) return;
+
+    std::string text(spec);
+    size_t start = 0;
+    while (start <= text.size())
+    {
+        size_t end = text.find(',', start);
+        if (end == std::string::npos) end = text.size();
+        std::string name = text.substr(start, end - start);
+        start = end + 1;
+
+        bool on = true;
+        if (!name.empty() && name[0] == '-')
+        {
+            on = false;
+            name.erase(0, 1);
+        }
+        if (name.empty()) continue;
+
+        if (name == "all" || name == "none")
+        {
+            for (int i = 0; i < static_cast<int>(LogCategory::COUNT); ++i)
+            {
+                setEnabled(static_cast<LogCategory>(i), name == "all");
+            }
+            continue;
+        }
+
+        bool known = false;
+        for (int i = 0; i < static_cast<int>(LogCategory::COUNT); ++i)
+        {
+            if (name == getCategoryName(static_cast<LogCategory>(i)))
+            {
+                setEnabled(static_cast<LogCategory>(i), on);
+                known = true;
+            }
+        }
+        if (!known)
+        {
+            std::fprintf(stderr, "Log: unknown category '%s'\n", name.c_str());
+        }
+    }
+}
+
+void Log::setRateLimit(uint32_t linesPerSecond)
+{
+    rate_limit.store(linesPerSecond, std::memory_order_relaxed);
+}
+
+uint32_t Log::getRateLimit()
+{
+    return rate_limit.load(std::memory_order_relaxed);
+}
+
+uint64_t Log::getDropped()
+{
+    Writer& w = writer();
+    std::lock_guard<std::mutex> lock(w.mutex);
+    return w.dropped;
+}
+
+const char* Log::getCategoryName(LogCategory category)
+{
+    switch (category)
+    {
+        case LogCategory::GENERAL:   return "general";
+        case LogCategory::LIFECYCLE: return "lifecycle";
+        case LogCategory::COMBAT:    return "combat";
+        case LogCategory::ECONOMY:   return "economy";
+        case LogCategory::ZOMBIES:   return "zombies";
+        case LogCategory::ASSETS:    return "assets";
+        default:                     return "unknown";
+    }
+}
+
+// ----------------------------------------------------
+// Writer
+// ----------------------------------------------------
+
+void Log::start()
+{
+    Writer& w = writer();
+    std::lock_guard<std::mutex> lock(w.mutex);
+    if (w.running) return;
+
+    w.stopping = false;
+    w.running = true;
+    w.thread = std::thread(runWriter);
+}
+
+void Log::stop()
+{
+    Writer& w = writer();
+    {
+        std::lock_guard<std::mutex> lock(w.mutex);
+        if (!w.running) return;
+        w.stopping = true;
+    }
+    w.wake.notify_one();
+    w.thread.join();
+
+    std::lock_guard<std::mutex> lock(w.mutex);
+    w.running = false;
+    if (w.dropped > 0)
+    {
+        char line[64];
+        std::snprintf(line, sizeof(line), "[W][general] log ring overflowed, %llu lines dropped",
+            static_cast<unsigned long long>(w.dropped));
+        w.sink(line);
+    }
+}
+
+void Log::write(LogLevel level, LogCategory category, RateLimit& site, const char* format, ...)
+{
+    char line[LINE_LENGTH];
+    int length = std::snprintf(line, sizeof(line), "[%s][%s] ", levelTag(level), getCategoryName(category));
+    if (length < 0) return;
+
+    va_list args;
+    va_start(args, format);
+    int body = std::vsnprintf(line + length, sizeof(line) - length, format, args);
+    va_end(args);
+    if (body > 0) length = std::min<int>(length + body, LINE_LENGTH - 1);
+
+    uint32_t suppressed = site.takeSuppressed();
+    if (suppressed > 0 && length < LINE_LENGTH - 1)
+    {
+        std::snprintf(line + length, sizeof(line) - length, " (+%u suppressed)", suppressed);
+    }
+
+    Writer& w = writer();
+    std::unique_lock<std::mutex> lock(w.mutex);
+    if (!w.running)
+    {
+        w.sink(line);
+        return;
+    }
+
+    if (w.tail - w.head >= static_cast<size_t>(RING_SIZE))
+    {
+        ++w.dropped;
+        return;
+    }
+
+    std::memcpy(w.ring[w.tail % RING_SIZE], line, sizeof(line));
+    ++w.tail;
+    lock.unlock();
+    w.wake.notify_one();
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Severity of a log line. Lines below PVZ_LOG_LEVEL are compiled out.
+ */
+enum class LogLevel
+{
+    TRACE = 0,      // Per-object and per-hit noise: constructors, damage, every shot
+    DEBUG = 1,      // Gameplay events: plant placed, sun produced, animation state
+    INFO = 2,       // Level, replay and benchmark milestones
+    WARN = 3,
+    ERROR = 4
+};
+
+/**
+ * @brief What a log line is about; each category can be switched on and off at runtime.
+ */
+enum class LogCategory
+{
+    GENERAL,
+    LIFECYCLE,      // Entity construction and destruction
+    COMBAT,         // Shots, hits, explosions
+    ECONOMY,        // Sun, coins, seed packets
+    ZOMBIES,        // Zombie behaviour and animation state
+    ASSETS,         // Textures and animations that fail to load
+    COUNT
+};
+
+// Debug builds keep DEBUG and above, release builds WARN and above; define PVZ_LOG_LEVEL to override
+#ifndef PVZ_LOG_LEVEL
+#if defined(COCOS2D_DEBUG) && COCOS2D_DEBUG > 0
+#define PVZ_LOG_LEVEL 1
+#else
+#define PVZ_LOG_LEVEL 3
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PVZ_LOG_FORMAT(fmt, args) __attribute__((format(printf, fmt, args)))
+#else
+#define PVZ_LOG_FORMAT(fmt, args)
+#endif
+
+/**
+ * @brief Logging facade: compile-time level stripping, runtime category flags, per-call-site
+ * rate limiting and a background writer.
+ *
+ * Call sites use LOG_TRACE(COMBAT, "fmt", ...) and friends. A line is formatted on the calling
+ * thread into a fixed ring slot; the writer thread hands it to the sink, so the game thread never
+ * waits on the console. When the ring is full the line is dropped and counted. Before start()
+ * and after stop() lines go to the sink directly. AppDelegate points the sink at cocos2d::log.
+ */
+class Log
+{
+public:
+    typedef void (*Sink)(const char* line);
+
+    /** @brief Lets a call site through at most getRateLimit() times per second */
+    class RateLimit
+    {
+    public:
+        RateLimit() : window_start_ms(0), count(0), suppressed(0) {}
+
+        bool allow();
+
+        /** @brief Lines refused since the last one let through, and resets the count */
+        uint32_t takeSuppressed();
+
+    private:
+        uint64_t window_start_ms;
+        uint32_t count;
+        uint32_t suppressed;
+    };
+
+    static const int RING_SIZE = 512;       // Lines waiting for the writer
+    static const int LINE_LENGTH = 256;     // Longer lines are cut
+
+    /** @brief Where finished lines go; stderr until set */
+    static void setSink(Sink sink);
+
+    /** @brief Starts the writer thread */
+    static void start();
+
+    /** @brief Writes what is queued and stops the writer thread */
+    static void stop();
+
+    static bool isEnabled(LogCategory category);
+    static void setEnabled(LogCategory category, bool enabled);
+
+    /**
+     * @brief Applies a comma-separated list such as "none,combat" or "-lifecycle".
+     * "all" and "none" set every category; a name enables it, "-name" disables it.
+     */
+    static void configure(const char* spec);
+
+    /** @brief Lines per second and call site before lines are suppressed */
+    static void setRateLimit(uint32_t linesPerSecond);
+    static uint32_t getRateLimit();
+
+    /** @brief Lines lost to a full ring since start */
+    static uint64_t getDropped();
+
+    static const char* getCategoryName(LogCategory category);
+
+    static void write(LogLevel level, LogCategory category, RateLimit& site, const char* format, ...) PVZ_LOG_FORMAT(4, 5);
+};
+
+#define PVZ_LOG_AT(level, category, ...) \
+    do \
+    { \
+        if (Log::isEnabled(LogCategory::category)) \
+        { \
+            static Log::RateLimit pvzLogSite; \
+            if (pvzLogSite.allow()) Log::write(level, LogCategory::category, pvzLogSite, __VA_ARGS__); \
+        } \
+    } while (0)
+
+#define PVZ_LOG_STRIPPED do { } while (0)
+
+#if PVZ_LOG_LEVEL <= 0
+#define LOG_TRACE(category, ...) PVZ_LOG_AT(LogLevel::TRACE, category, __VA_ARGS__)
+#else
+#define LOG_TRACE(category, ...) PVZ_LOG_STRIPPED
+#endif
+
+#if PVZ_LOG_LEVEL <= 1
+#define LOG_DEBUG(category, ...) PVZ_LOG_AT(LogLevel::DEBUG, category, __VA_ARGS__)
+#else
+#define LOG_DEBUG(category, ...) PVZ_LOG_STRIPPED
+#endif
+
+#if PVZ_LOG_LEVEL <= 2
+#define LOG_INFO(category, ...) PVZ_LOG_AT(LogLevel::INFO, category, __VA_ARGS__)
+#else
+#define LOG_INFO(category, ...) PVZ_LOG_STRIPPED
+#endif
+
+#if PVZ_LOG_LEVEL <= 3
+#define LOG_WARN(category, ...) PVZ_LOG_AT(LogLevel::WARN, category, __VA_ARGS__)
+#else
+#define LOG_WARN(category, ...) PVZ_LOG_STRIPPED
+#endif
+
+#define LOG_ERROR(category, ...) PVZ_LOG_AT(LogLevel::ERROR, category, __VA_ARGS__)
@@ -0,0 +1,88 @@
+#include "PopulationTracker.h"
+#include <algorithm>
+
+PopulationTracker::PopulationTracker()
+{
+    reset();
+}
+
+void PopulationTracker::reset()
+{
+    live_zombies = 0;
+    live_plants = 0;
+    for (int row = 0; row < MAX_ROW; ++row)
+    {
+        live_zombies_in_row[row] = 0;
+        live_plants_in_row[row] = 0;
+    }
+    zombie_deaths.clear();
+    plant_deaths.clear();
+}
+
+// ----------------------------------------------------
+// Zombies
+// ----------------------------------------------------
+
+void PopulationTracker::onZombieSpawned(int row)
+{
+    ++live_zombies;
+    ++live_zombies_in_row[row];
+}
+
+void PopulationTracker::onZombieDied(Zombie* zombie, int row)
+{
+    --live_zombies;
+    --live_zombies_in_row[row];
+
+    ZombieDeath death;
+    death.zombie = zombie;
+    death.row = row;
+    zombie_deaths.push_back(death);
+}
+
+void PopulationTracker::takeZombieDeaths(std::vector<ZombieDeath>& out)
+{
+    out.clear();
+    out.swap(zombie_deaths);
+}
+
+// ----------------------------------------------------
+// Plants
+// ----------------------------------------------------
+
+void PopulationTracker::onPlantPlaced(int row)
+{
+    ++live_plants;
+    ++live_plants_in_row[row];
+}
+
+void PopulationTracker::onPlantDied(Plant* plant, int row, int col)
+{
+    --live_plants;
+    --live_plants_in_row[row];
+
+    PlantDeath death;
+    death.plant = plant;
+    death.row = row;
+    death.col = col;
+    plant_deaths.push_back(death);
+}
+
+void PopulationTracker::onPlantRemoved(int row)
+{
+    --live_plants;
+    --live_plants_in_row[row];
+}
+
+void PopulationTracker::takePlantDeaths(std::vector<PlantDeath>& out)
+{
+    out.clear();
+    out.swap(plant_deaths);
+}
+
+void PopulationTracker::cancelPlantDeath(Plant* plant)
+{
+    plant_deaths.erase(std::remove_if(plant_deaths.begin(), plant_deaths.end(), [plant](const PlantDeath& death) {
+        return death.plant == plant;
+    }), plant_deaths.end());
+}
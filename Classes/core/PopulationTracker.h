@@ -0,0 +1,75 @@
+#pragma once
+
+#include "GameTypes.h"
+#include <vector>
+
+class Zombie;
+class Plant;
+
+/**
+ * @brief Live zombie and plant counters and the death queue of the current frame.
+ *
+ * GameWorld reports every zombie and plant it puts on the lawn; the entities report their own
+ * death (a zombie once its death animation has finished, the moment isDead() turns true).
+ * Cleanup drains the queue instead of scanning every row and cell, and "is any zombie alive"
+ * is a counter read.
+ */
+class PopulationTracker
+{
+public:
+    struct ZombieDeath
+    {
+        Zombie* zombie;
+        int row;
+    };
+
+    struct PlantDeath
+    {
+        Plant* plant;
+        int row;
+        int col;
+    };
+
+    PopulationTracker();
+
+    /** @brief Forgets every count and queued death, e.g. at level start */
+    void reset();
+
+    void onZombieSpawned(int row);
+
+    /** @brief Queues the zombie for removal and stops counting it as alive */
+    void onZombieDied(Zombie* zombie, int row);
+
+    void onPlantPlaced(int row);
+
+    /** @brief Queues the plant for removal and stops counting it as alive */
+    void onPlantDied(Plant* plant, int row, int col);
+
+    /** @brief A live plant left the lawn without dying (replaced by its upgrade) */
+    void onPlantRemoved(int row);
+
+    /** @brief Moves the queued zombie deaths into out (cleared first), in the order they happened */
+    void takeZombieDeaths(std::vector<ZombieDeath>& out);
+
+    /** @brief Moves the queued plant deaths into out (cleared first), in the order they happened */
+    void takePlantDeaths(std::vector<PlantDeath>& out);
+
+    /** @brief Drops a queued death of a plant that is being removed some other way */
+    void cancelPlantDeath(Plant* plant);
+
+    int getLiveZombies() const { return live_zombies; }
+    int getLiveZombies(int row) const { return live_zombies_in_row[row]; }
+    bool hasLiveZombies() const { return live_zombies > 0; }
+
+    int getLivePlants() const { return live_plants; }
+    int getLivePlants(int row) const { return live_plants_in_row[row]; }
+
+private:
+    int live_zombies;
+    int live_zombies_in_row[MAX_ROW];
+    int live_plants;
+    int live_plants_in_row[MAX_ROW];
+
+    std::vector<ZombieDeath> zombie_deaths;
+    std::vector<PlantDeath> plant_deaths;
+};
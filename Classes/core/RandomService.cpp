@@ -0,0 +1,49 @@
+#include "RandomService.h"
+#include <chrono>
+#include <new>
+#include <random>
+
+namespace
+{
+    /** @brief SplitMix64 finalizer, used to spread the level seed into stream keys */
+    uint64_t mix(uint64_t z)
+    {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+}
+
+RandomService* RandomService::instance = nullptr;
+
+RandomService* RandomService::getInstance()
+{
+    if (!instance)
+    {
+        instance = new (std::nothrow) RandomService();
+    }
+    return instance;
+}
+
+RandomService::RandomService()
+    : seed(0)
+{
+    beginLevel(freshSeed());
+}
+
+void RandomService::beginLevel(uint64_t levelSeed)
+{
+    seed = levelSeed;
+    for (int i = 0; i < static_cast<int>(RandomStreamId::COUNT); ++i)
+    {
+        streams[i] = RandomStream(mix(levelSeed ^ mix(static_cast<uint64_t>(i) + 1)));
+    }
+}
+
+uint64_t RandomService::freshSeed()
+{
+    std::random_device device;
+    uint64_t entropy = (static_cast<uint64_t>(device()) << 32) ^ device();
+    uint64_t clock = static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    return mix(entropy ^ clock);
+}
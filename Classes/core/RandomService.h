@@ -0,0 +1,93 @@
+#pragma once
+
+#include "WavePlanner.h"
+#include <cstdint>
+
+/**
+ * @brief Named random streams of a level.
+ * Every stream is seeded independently from the level seed, so drawing from one never shifts
+ * the values of another; sounds and other COSMETIC draws cannot change what spawns.
+ */
+enum class RandomStreamId
+{
+    WAVES,      // Zombie batches, spawn rows, rake placement
+    SKY_SUN,    // Where sky suns fall
+    LOOT,       // Coin drops
+    COSMETIC,   // Sound variations and anything else that must not affect gameplay
+    COUNT
+};
+
+/**
+ * @brief Counter-based generator: the n-th value is a SplitMix64 hash of (key, n).
+ * Draws cost one multiply-add and a hash, and the stream position is a plain counter.
+ */
+class RandomStream : public WaveRandom
+{
+public:
+    explicit RandomStream(uint64_t key = 0) : key(key), counter(0) {}
+
+    /** @brief Next raw 64-bit value */
+    uint64_t next()
+    {
+        uint64_t z = key + (++counter) * 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    virtual int range(int a, int b) override
+    {
+        if (b < a) { int t = a; a = b; b = t; }
+        uint64_t span = static_cast<uint64_t>(b - a) + 1;
+        return a + static_cast<int>(next() % span);
+    }
+
+    /** @brief Uniform integer in [0, n) */
+    int below(int n) { return n > 0 ? static_cast<int>(next() % static_cast<uint64_t>(n)) : 0; }
+
+    virtual float unit() override
+    {
+        // 24 random mantissa bits, inclusive of 1.0 like CCRANDOM_0_1()
+        return static_cast<float>(next() >> 40) / static_cast<float>((1 << 24) - 1);
+    }
+
+    /** @brief Values drawn so far */
+    uint64_t getCounter() const { return counter; }
+
+private:
+    uint64_t key;
+    uint64_t counter;
+};
+
+/**
+ * @brief Per-level source of every random decision in the game.
+ * GameWorld calls beginLevel() with a fresh or a fixed seed; the same seed and the same inputs
+ * replay the same level.
+ */
+class RandomService
+{
+public:
+    /** @brief Access the global random service. */
+    static RandomService* getInstance();
+
+    RandomService(const RandomService&) = delete;
+    RandomService& operator=(const RandomService&) = delete;
+
+    /** @brief Reseeds every stream from the level seed */
+    void beginLevel(uint64_t seed);
+
+    /** @brief Seed of the current level */
+    uint64_t getSeed() const { return seed; }
+
+    RandomStream& get(RandomStreamId id) { return streams[static_cast<int>(id)]; }
+
+    /** @brief A seed that differs from run to run (clock and std::random_device) */
+    static uint64_t freshSeed();
+
+private:
+    RandomService();
+    static RandomService* instance;
+
+    uint64_t seed;
+    RandomStream streams[static_cast<int>(RandomStreamId::COUNT)];
+};
@@ -0,0 +1,267 @@
+#include "Replay.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+const int Replay::KEYFRAME_INTERVAL;
+
+namespace
+{
+    const char MAGIC[4] = { 'P', 'V', 'Z', 'R' };
+    const uint8_t VERSION = 1;
+
+    // Per-frame flag bits
+    const uint8_t FRAME_NEW_DELTA = 1;
+
+    class ByteWriter
+    {
+    public:
+        void u8(uint8_t value) { bytes.push_back(value); }
+        void u32(uint32_t value)
+        {
+            for (int i = 0; i < 4; ++i) bytes.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+        void u64(uint64_t value)
+        {
+            for (int i = 0; i < 8; ++i) bytes.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+        void f32(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            u32(bits);
+        }
+
+        std::vector<uint8_t> bytes;
+    };
+
+    class ByteReader
+    {
+    public:
+        explicit ByteReader(const std::vector<uint8_t>& bytes) : bytes(bytes), pos(0), failed(false) {}
+
+        uint8_t u8()
+        {
+            if (pos + 1 > bytes.size()) { failed = true; return 0; }
+            return bytes[pos++];
+        }
+        uint32_t u32()
+        {
+            uint32_t value = 0;
+            for (int i = 0; i < 4; ++i) value |= static_cast<uint32_t>(u8()) << (8 * i);
+            return value;
+        }
+        uint64_t u64()
+        {
+            uint64_t value = 0;
+            for (int i = 0; i < 8; ++i) value |= static_cast<uint64_t>(u8()) << (8 * i);
+            return value;
+        }
+        float f32()
+        {
+            uint32_t bits = u32();
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        /** @brief A count that cannot be larger than the bytes left, so corrupt files fail early */
+        uint32_t count(size_t bytesPerItem)
+        {
+            uint32_t value = u32();
+            if (value > (bytes.size() - std::min(pos, bytes.size())) / bytesPerItem) failed = true;
+            return failed ? 0 : value;
+        }
+
+        bool ok() const { return !failed; }
+
+    private:
+        const std::vector<uint8_t>& bytes;
+        size_t pos;
+        bool failed;
+    };
+}
+
+Replay::Replay()
+{
+    header.seed = 0;
+    header.night_mode = false;
+    header.rake_enabled = false;
+    header.mower_enabled = false;
+}
+
+const ReplayKeyframe* Replay::findKeyframe(uint32_t frame) const
+{
+    auto it = std::lower_bound(keyframes.begin(), keyframes.end(), frame,
+        [](const ReplayKeyframe& keyframe, uint32_t value) { return keyframe.frame < value; });
+    return (it != keyframes.end() && it->frame == frame) ? &*it : nullptr;
+}
+
+float Replay::getDuration() const
+{
+    float duration = 0.0f;
+    for (float delta : deltas)
+    {
+        duration += delta;
+    }
+    return duration;
+}
+
+// ----------------------------------------------------
+// File format
+// ----------------------------------------------------
+
+bool Replay::save(const std::string& path) const
+{
+    ByteWriter out;
+    for (char c : MAGIC) out.u8(static_cast<uint8_t>(c));
+    out.u8(VERSION);
+
+    out.u64(header.seed);
+    out.u8(static_cast<uint8_t>((header.night_mode ? 1 : 0) | (header.rake_enabled ? 2 : 0) | (header.mower_enabled ? 4 : 0)));
+    out.u8(static_cast<uint8_t>(header.plant_names.size()));
+    for (int name : header.plant_names) out.u8(static_cast<uint8_t>(name));
+
+    // Frame deltas barely change under vsync: one byte per frame unless they do
+    out.u32(getFrameCount());
+    float previous = 0.0f;
+    for (float delta : deltas)
+    {
+        bool changed = std::memcmp(&delta, &previous, sizeof(float)) != 0;
+        out.u8(changed ? FRAME_NEW_DELTA : 0);
+        if (changed) out.f32(delta);
+        previous = delta;
+    }
+
+    out.u32(static_cast<uint32_t>(inputs.size()));
+    for (const auto& input : inputs)
+    {
+        out.u32(input.frame);
+        out.u8(static_cast<uint8_t>(input.type));
+        out.u32(static_cast<uint32_t>(input.index));
+        out.f32(input.x);
+        out.f32(input.y);
+    }
+
+    out.u32(static_cast<uint32_t>(keyframes.size()));
+    for (const auto& keyframe : keyframes)
+    {
+        out.u32(keyframe.frame);
+        out.f32(keyframe.elapsed_time);
+        out.u32(static_cast<uint32_t>(keyframe.sun_count));
+        out.u32(static_cast<uint32_t>(keyframe.zombies));
+        out.u32(static_cast<uint32_t>(keyframe.plants));
+        out.u32(static_cast<uint32_t>(keyframe.bullets));
+        for (uint64_t counter : keyframe.rng_counters) out.u64(counter);
+        out.u32(keyframe.state_hash);
+    }
+
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) return false;
+    size_t written = std::fwrite(out.bytes.data(), 1, out.bytes.size(), file);
+    return std::fclose(file) == 0 && written == out.bytes.size();
+}
+
+bool Replay::load(const std::string& path)
+{
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) return false;
+    std::vector<uint8_t> bytes;
+    uint8_t buffer[4096];
+    size_t read;
+    while ((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        bytes.insert(bytes.end(), buffer, buffer + read);
+    }
+    std::fclose(file);
+
+    ByteReader in(bytes);
+    for (char c : MAGIC)
+    {
+        if (in.u8() != static_cast<uint8_t>(c)) return false;
+    }
+    if (in.u8() != VERSION) return false;
+
+    Replay loaded;
+    loaded.header.seed = in.u64();
+    uint8_t flags = in.u8();
+    loaded.header.night_mode = (flags & 1) != 0;
+    loaded.header.rake_enabled = (flags & 2) != 0;
+    loaded.header.mower_enabled = (flags & 4) != 0;
+    uint8_t plantCount = in.u8();
+    for (int i = 0; i < plantCount; ++i) loaded.header.plant_names.push_back(in.u8());
+
+    uint32_t frameCount = in.count(1);
+    loaded.deltas.reserve(frameCount);
+    float delta = 0.0f;
+    for (uint32_t i = 0; i < frameCount && in.ok(); ++i)
+    {
+        if (in.u8() & FRAME_NEW_DELTA) delta = in.f32();
+        loaded.deltas.push_back(delta);
+    }
+
+    uint32_t inputCount = in.count(17);
+    for (uint32_t i = 0; i < inputCount && in.ok(); ++i)
+    {
+        ReplayInput input;
+        input.frame = in.u32();
+        input.type = static_cast<ReplayInputType>(in.u8());
+        input.index = static_cast<int32_t>(in.u32());
+        input.x = in.f32();
+        input.y = in.f32();
+        loaded.inputs.push_back(input);
+    }
+
+    uint32_t keyframeCount = in.count(60);
+    for (uint32_t i = 0; i < keyframeCount && in.ok(); ++i)
+    {
+        ReplayKeyframe keyframe;
+        keyframe.frame = in.u32();
+        keyframe.elapsed_time = in.f32();
+        keyframe.sun_count = static_cast<int32_t>(in.u32());
+        keyframe.zombies = static_cast<int32_t>(in.u32());
+        keyframe.plants = static_cast<int32_t>(in.u32());
+        keyframe.bullets = static_cast<int32_t>(in.u32());
+        for (uint64_t& counter : keyframe.rng_counters) counter = in.u64();
+        keyframe.state_hash = in.u32();
+        loaded.keyframes.push_back(keyframe);
+    }
+
+    if (!in.ok()) return false;
+    *this = loaded;
+    return true;
+}
+
+std::string Replay::compare(const ReplayKeyframe& expected, const ReplayKeyframe& actual)
+{
+    char text[128];
+    if (expected.elapsed_time != actual.elapsed_time)
+    {
+        std::snprintf(text, sizeof(text), "elapsed time %.4f != %.4f", actual.elapsed_time, expected.elapsed_time);
+        return text;
+    }
+    for (int i = 0; i < 4; ++i)
+    {
+        if (expected.rng_counters[i] != actual.rng_counters[i])
+        {
+            std::snprintf(text, sizeof(text), "random stream %d drew %llu values, recorded %llu", i,
+                static_cast<unsigned long long>(actual.rng_counters[i]),
+                static_cast<unsigned long long>(expected.rng_counters[i]));
+            return text;
+        }
+    }
+    if (expected.sun_count != actual.sun_count || expected.zombies != actual.zombies ||
+        expected.plants != actual.plants || expected.bullets != actual.bullets)
+    {
+        std::snprintf(text, sizeof(text), "sun/zombies/plants/bullets %d/%d/%d/%d != %d/%d/%d/%d",
+            actual.sun_count, actual.zombies, actual.plants, actual.bullets,
+            expected.sun_count, expected.zombies, expected.plants, expected.bullets);
+        return text;
+    }
+    if (expected.state_hash != actual.state_hash)
+    {
+        std::snprintf(text, sizeof(text), "state hash %08x != %08x", actual.state_hash, expected.state_hash);
+        return text;
+    }
+    return "";
+}
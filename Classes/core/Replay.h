@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Gameplay inputs a replay records, as resolved by GameWorld's touch handlers.
+ */
+enum class ReplayInputType : uint8_t
+{
+    COLLECT = 1,        // Touch on a sun or coin at (x, y), node space
+    SELECT_SHOVEL,
+    SELECT_PACKET,      // Seed packet index, preview at (x, y)
+    REMOVE_PLANT,       // Shovel released with its tip at (x, y)
+    PLANT,              // Selected packet released at (x, y)
+    TOGGLE_SPEED
+};
+
+/** @brief One input, applied before the update of its frame */
+struct ReplayInput
+{
+    uint32_t frame;
+    ReplayInputType type;
+    int32_t index;
+    float x;
+    float y;
+};
+
+/**
+ * @brief Digest of the game state at the start of a frame.
+ * Recorded every KEYFRAME_INTERVAL frames; playback compares its own digest at the same frame,
+ * so a diverging replay is caught within seconds of where it went wrong.
+ */
+struct ReplayKeyframe
+{
+    uint32_t frame;
+    float elapsed_time;
+    int32_t sun_count;
+    int32_t zombies;
+    int32_t plants;
+    int32_t bullets;
+    uint64_t rng_counters[4];   // Draws taken from each RandomService stream
+    uint32_t state_hash;        // Hash of zombie positions and occupied plant cells
+};
+
+/** @brief Level settings a replay needs to rebuild the same GameWorld */
+struct ReplayHeader
+{
+    uint64_t seed;
+    bool night_mode;
+    bool rake_enabled;
+    bool mower_enabled;
+    std::vector<int> plant_names;   // PlantName values of the chosen seed packets
+};
+
+/**
+ * @brief Recorded session: level settings, the delta of every frame, inputs and keyframes.
+ *
+ * Binary layout (little endian): "PVZR", version byte, header, frame count, one flag byte per
+ * frame (followed by a float delta only when it differs from the previous frame), then the
+ * inputs and the keyframes.
+ */
+class Replay
+{
+public:
+    static const int KEYFRAME_INTERVAL = 300;   // Five seconds at 60 fps
+
+    Replay();
+
+    ReplayHeader header;
+
+    /** @brief Appends a frame with the delta GameWorld::update received */
+    void addFrame(float delta) { deltas.push_back(delta); }
+
+    /** @brief Appends an input; frames must not decrease */
+    void addInput(const ReplayInput& input) { inputs.push_back(input); }
+
+    void addKeyframe(const ReplayKeyframe& keyframe) { keyframes.push_back(keyframe); }
+
+    uint32_t getFrameCount() const { return static_cast<uint32_t>(deltas.size()); }
+    float getDelta(uint32_t frame) const { return deltas[frame]; }
+    const std::vector<ReplayInput>& getInputs() const { return inputs; }
+    const std::vector<ReplayKeyframe>& getKeyframes() const { return keyframes; }
+
+    /** @brief Keyframe recorded at exactly this frame, or nullptr */
+    const ReplayKeyframe* findKeyframe(uint32_t frame) const;
+
+    /** @brief Recorded seconds of play */
+    float getDuration() const;
+
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+
+    /** @brief Describes the first difference between two keyframes, or "" if they match */
+    static std::string compare(const ReplayKeyframe& expected, const ReplayKeyframe& actual);
+
+private:
+    std::vector<float> deltas;
+    std::vector<ReplayInput> inputs;
+    std::vector<ReplayKeyframe> keyframes;
+};
@@ -0,0 +1,156 @@
+#include "SoundManager.h"
+#include "audio/include/AudioEngine.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+const int SoundManager::MAX_VOICES = 16;
+const int SoundManager::MAX_VOICES_PER_CLIP = 3;
+
+SoundManager* SoundManager::instance = nullptr;
+
+SoundManager* SoundManager::getInstance()
+{
+    if (!instance)
+    {
+        instance = new (std::nothrow) SoundManager();
+    }
+    return instance;
+}
+
+SoundManager::SoundManager()
+{
+    // A full lawn of chewing zombies should still sound like one
+    clip_limits["zombie_eating.mp3"] = 4;
+    clip_limits["limbs-pop.mp3"] = 2;
+    muted = false;
+    resetStats();
+}
+
+void SoundManager::resetStats()
+{
+    stats.posted = 0;
+    stats.played = 0;
+    stats.merged = 0;
+    stats.dropped = 0;
+    stats.evicted = 0;
+    stats.peak_voices = 0;
+}
+
+void SoundManager::logStats() const
+{
+    CCLOG("SoundManager: posted=%ld played=%ld merged=%ld dropped=%ld evicted=%ld peakVoices=%d",
+        stats.posted, stats.played, stats.merged, stats.dropped, stats.evicted, stats.peak_voices);
+}
+
+void SoundManager::setClipLimit(const std::string& file, int maxVoices)
+{
+    clip_limits[file] = std::max(1, maxVoices);
+}
+
+void SoundManager::reset()
+{
+    queued.clear();
+    voices.clear();
+}
+
+void SoundManager::post(const std::string& file, SoundPriority priority, float volume)
+{
+    ++stats.posted;
+
+    for (auto& event : queued)
+    {
+        if (event.file == file)
+        {
+            event.priority = std::max(event.priority, priority);
+            event.volume = std::max(event.volume, volume);
+            ++stats.merged;
+            return;
+        }
+    }
+    queued.push_back({ file, priority, volume });
+}
+
+void SoundManager::flush()
+{
+    if (queued.empty()) return;
+    if (muted)
+    {
+        stats.dropped += static_cast<long>(queued.size());
+        queued.clear();
+        return;
+    }
+
+    pruneVoices();
+
+    // Important events claim voices first; posting order breaks ties
+    std::stable_sort(queued.begin(), queued.end(), [](const Event& a, const Event& b) {
+        return a.priority > b.priority;
+    });
+
+    for (const auto& event : queued)
+    {
+        if (countVoices(event.file) >= clipLimit(event.file))
+        {
+            ++stats.dropped;
+            continue;
+        }
+        if (static_cast<int>(voices.size()) >= MAX_VOICES && !evictBelow(event.priority))
+        {
+            ++stats.dropped;
+            continue;
+        }
+
+        int audioId = AudioEngine::play2d(event.file, false, event.volume);
+        if (audioId == AudioEngine::INVALID_AUDIO_ID)
+        {
+            // AudioEngine's own instance limit was hit
+            ++stats.dropped;
+            continue;
+        }
+        voices.push_back({ audioId, event.file, event.priority });
+        ++stats.played;
+    }
+    queued.clear();
+
+    stats.peak_voices = std::max(stats.peak_voices, static_cast<int>(voices.size()));
+}
+
+void SoundManager::pruneVoices()
+{
+    voices.erase(std::remove_if(voices.begin(), voices.end(), [](const Voice& voice) {
+        // Finished and stopped ids are no longer known to AudioEngine
+        return AudioEngine::getState(voice.audio_id) == AudioEngine::AudioState::ERROR;
+    }), voices.end());
+}
+
+int SoundManager::countVoices(const std::string& file) const
+{
+    int count = 0;
+    for (const auto& voice : voices)
+    {
+        if (voice.file == file) ++count;
+    }
+    return count;
+}
+
+int SoundManager::clipLimit(const std::string& file) const
+{
+    auto it = clip_limits.find(file);
+    return it != clip_limits.end() ? it->second : MAX_VOICES_PER_CLIP;
+}
+
+bool SoundManager::evictBelow(SoundPriority priority)
+{
+    for (auto it = voices.begin(); it != voices.end(); ++it)
+    {
+        if (it->priority < priority)
+        {
+            AudioEngine::stop(it->audio_id);
+            voices.erase(it);
+            ++stats.evicted;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "cocos2d.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief How much a sound effect matters when voices run out.
+ * A higher priority event may stop the oldest lower priority voice; equal or lower ones are dropped.
+ */
+enum class SoundPriority
+{
+    LOW,        // Repeated combat noise: hits, bites
+    NORMAL,     // One-off actions: mower kills, plant attacks
+    HIGH        // Events the player must hear: explosions, vaults, mower start
+};
+
+/**
+ * @brief Event layer in front of AudioEngine for gameplay sound effects.
+ *
+ * Gameplay code posts events instead of calling play2d. Events for the same clip posted within
+ * one frame are merged into a single voice, and flush() (once per frame, from GameWorld::update)
+ * starts the survivors by priority while keeping each clip and the whole layer under a voice cap.
+ * Replayed inputs (picking up sun and coins, planting, the shovel) post here too, so a muted
+ * replay fast-forward stays silent. Music and menu clicks still go straight to AudioEngine;
+ * their voices are not counted here.
+ */
+class SoundManager
+{
+public:
+    struct Stats
+    {
+        long posted;        // Events received
+        long played;        // Voices started
+        long merged;        // Events folded into another event of the same frame
+        long dropped;       // Events discarded because a cap was reached
+        long evicted;       // Voices stopped early for a higher priority event
+        int peak_voices;    // Most voices held at once
+    };
+
+    /** @brief Access the global sound layer. */
+    static SoundManager* getInstance();
+
+    SoundManager(const SoundManager&) = delete;
+    SoundManager& operator=(const SoundManager&) = delete;
+
+    /**
+     * @brief Queues a sound effect for the next flush().
+     * @param volume Merged events keep the loudest volume and the highest priority
+     */
+    void post(const std::string& file, SoundPriority priority = SoundPriority::NORMAL, float volume = 1.0f);
+
+    /** @brief Starts this frame's events; call once per frame */
+    void flush();
+
+    /** @brief Forgets queued events and tracked voices, e.g. at level start or after AudioEngine::stopAll */
+    void reset();
+
+    /** @brief While muted, flush() discards the queued events (replay fast-forward) */
+    void setMuted(bool mute) { muted = mute; }
+
+    /** @brief Overrides the per-clip cap (default MAX_VOICES_PER_CLIP) */
+    void setClipLimit(const std::string& file, int maxVoices);
+
+    int getActiveVoiceCount() const { return static_cast<int>(voices.size()); }
+
+    const Stats& getStats() const { return stats; }
+    void resetStats();
+    void logStats() const;
+
+    static const int MAX_VOICES;            // Effect voices across all clips
+    static const int MAX_VOICES_PER_CLIP;   // Effect voices of one clip
+
+private:
+    SoundManager();
+    static SoundManager* instance;
+
+    struct Event
+    {
+        std::string file;
+        SoundPriority priority;
+        float volume;
+    };
+
+    struct Voice
+    {
+        int audio_id;
+        std::string file;
+        SoundPriority priority;
+    };
+
+    /** @brief Drops voices AudioEngine has finished or stopped */
+    void pruneVoices();
+
+    int countVoices(const std::string& file) const;
+    int clipLimit(const std::string& file) const;
+
+    /** @brief Stops the oldest voice below priority; false if there is none */
+    bool evictBelow(SoundPriority priority);
+
+    std::vector<Event> queued;                          // This frame's events, one per clip
+    std::vector<Voice> voices;                          // Oldest first
+    std::unordered_map<std::string, int> clip_limits;
+    Stats stats;
+    bool muted;
+};
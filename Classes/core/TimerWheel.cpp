@@ -0,0 +1,216 @@
+#include "TimerWheel.h"
+#include <cmath>
+
+const float TimerWheel::TICK = 1.0f / 60.0f;
+
+TimerWheel::TimerWheel()
+{
+    reset();
+}
+
+void TimerWheel::reset()
+{
+    for (int bucket = 0; bucket < BUCKETS; ++bucket)
+    {
+        heads[bucket] = -1;
+    }
+
+    // Bump generations so handles from before the reset go stale
+    free_nodes.clear();
+    for (int index = static_cast<int>(nodes.size()) - 1; index >= 0; --index)
+    {
+        nodes[index].bucket = -1;
+        nodes[index].listener = nullptr;
+        ++nodes[index].generation;
+        free_nodes.push_back(index);
+    }
+    count = 0;
+
+    now = 0;
+    pending = 0.0;
+}
+
+// ----------------------------------------------------
+// Buckets
+// ----------------------------------------------------
+
+void TimerWheel::link(int index, int bucket)
+{
+    Node& node = nodes[index];
+    node.bucket = bucket;
+    node.prev = -1;
+    node.next = heads[bucket];
+    if (node.next >= 0) nodes[node.next].prev = index;
+    heads[bucket] = index;
+}
+
+void TimerWheel::unlink(int index)
+{
+    Node& node = nodes[index];
+    if (node.prev >= 0) nodes[node.prev].next = node.next;
+    else heads[node.bucket] = node.next;
+    if (node.next >= 0) nodes[node.next].prev = node.prev;
+    node.bucket = -1;
+}
+
+void TimerWheel::release(int index)
+{
+    nodes[index].listener = nullptr;
+    ++nodes[index].generation;
+    free_nodes.push_back(index);
+    --count;
+}
+
+void TimerWheel::place(int index)
+{
+    uint64_t deadline = nodes[index].deadline;
+    uint64_t ticks = deadline > now ? deadline - now : 0;
+
+    const uint64_t level1Span = static_cast<uint64_t>(LEVEL0_SLOTS) << LEVEL_BITS;
+    const uint64_t level2Span = level1Span << LEVEL_BITS;
+
+    int bucket;
+    if (ticks < LEVEL0_SLOTS)
+    {
+        bucket = static_cast<int>(deadline & (LEVEL0_SLOTS - 1));
+    }
+    else if (ticks < level1Span)
+    {
+        bucket = LEVEL0_SLOTS + static_cast<int>((deadline >> LEVEL0_BITS) & (LEVEL_SLOTS - 1));
+    }
+    else
+    {
+        // Beyond the last level the timer parks in the furthest slot and is re-placed from there
+        uint64_t parked = ticks < level2Span ? deadline : now + level2Span - 1;
+        bucket = LEVEL0_SLOTS + LEVEL_SLOTS + static_cast<int>((parked >> (LEVEL0_BITS + LEVEL_BITS)) & (LEVEL_SLOTS - 1));
+    }
+
+    link(index, bucket);
+}
+
+void TimerWheel::cascade(int bucketBase, int slot)
+{
+    int index = heads[bucketBase + slot];
+    heads[bucketBase + slot] = -1;
+    while (index >= 0)
+    {
+        int next = nodes[index].next;
+        place(index);
+        index = next;
+    }
+}
+
+// ----------------------------------------------------
+// Timers
+// ----------------------------------------------------
+
+bool TimerWheel::isLive(const Handle& handle) const
+{
+    return handle.index >= 0 && handle.index < static_cast<int>(nodes.size())
+        && nodes[handle.index].generation == handle.generation
+        && nodes[handle.index].bucket >= 0;
+}
+
+TimerWheel::Handle TimerWheel::schedule(float delay, TimerListener* listener, int tag)
+{
+    int index;
+    if (!free_nodes.empty())
+    {
+        index = free_nodes.back();
+        free_nodes.pop_back();
+    }
+    else
+    {
+        Node node;
+        node.generation = 0;
+        nodes.push_back(node);
+        index = static_cast<int>(nodes.size()) - 1;
+    }
+
+    // Round up so a timer never fires early; the tick being processed is already past
+    double ticks = std::ceil((pending + (delay > 0.0f ? delay : 0.0f)) / TICK);
+    uint64_t wait = ticks < 1.0 ? 1 : static_cast<uint64_t>(ticks);
+
+    Node& node = nodes[index];
+    node.listener = listener;
+    node.tag = tag;
+    node.deadline = now + wait;
+    ++count;
+    place(index);
+
+    Handle handle;
+    handle.index = index;
+    handle.generation = node.generation;
+    return handle;
+}
+
+void TimerWheel::cancel(Handle& handle)
+{
+    if (isLive(handle))
+    {
+        unlink(handle.index);
+        release(handle.index);
+    }
+    handle = Handle();
+}
+
+bool TimerWheel::isPending(const Handle& handle) const
+{
+    return isLive(handle);
+}
+
+float TimerWheel::getRemaining(const Handle& handle) const
+{
+    if (!isLive(handle)) return 0.0f;
+
+    double remaining = static_cast<double>(nodes[handle.index].deadline - now) * TICK - pending;
+    return remaining > 0.0 ? static_cast<float>(remaining) : 0.0f;
+}
+
+void TimerWheel::advance(float delta)
+{
+    pending += delta;
+    while (pending >= TICK)
+    {
+        pending -= TICK;
+        ++now;
+
+        // Bring the coarser slots that start at this tick down a level
+        if ((now & (LEVEL0_SLOTS - 1)) == 0)
+        {
+            int slot1 = static_cast<int>((now >> LEVEL0_BITS) & (LEVEL_SLOTS - 1));
+            if (slot1 == 0)
+            {
+                cascade(LEVEL0_SLOTS + LEVEL_SLOTS, static_cast<int>((now >> (LEVEL0_BITS + LEVEL_BITS)) & (LEVEL_SLOTS - 1)));
+            }
+            cascade(LEVEL0_SLOTS, slot1);
+        }
+
+        int slot = static_cast<int>(now & (LEVEL0_SLOTS - 1));
+        if (heads[slot] < 0) continue;
+
+        // Move the slot aside so listeners can schedule and cancel freely while it fires
+        heads[FIRING] = heads[slot];
+        heads[slot] = -1;
+        for (int index = heads[FIRING]; index >= 0; index = nodes[index].next)
+        {
+            nodes[index].bucket = FIRING;
+        }
+
+        while (heads[FIRING] >= 0)
+        {
+            int index = heads[FIRING];
+            unlink(index);
+            if (nodes[index].deadline > now)
+            {
+                place(index);   // Parked beyond the last level, not due yet
+                continue;
+            }
+
+            TimerListener* listener = nodes[index].listener;
+            int tag = nodes[index].tag;
+            release(index);
+            listener->onTimer(tag);
+        }
+    }
+}
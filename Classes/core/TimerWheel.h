@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Receives the timers it scheduled on a TimerWheel.
+ */
+class TimerListener
+{
+public:
+    virtual ~TimerListener() {}
+
+    /** @param tag The tag passed to TimerWheel::schedule */
+    virtual void onTimer(int tag) = 0;
+};
+
+/**
+ * @brief Hierarchical timer wheel for lifetimes and cooldowns in game time.
+ *
+ * Entities schedule a deadline once instead of adding delta to a float every frame; GameWorld
+ * advances the wheel with the same (time-scaled) delta as everything else, so deadlines hold
+ * under the speed toggle and in replays. A tick only looks at the slot that is due: the first
+ * level holds the next 256 ticks, two coarser levels hold the rest and are cascaded down as
+ * their slot comes up. Listeners must cancel their pending timers before they are destroyed.
+ */
+class TimerWheel
+{
+public:
+    static const float TICK;    // Seconds per tick
+
+    struct Handle
+    {
+        int index = -1;
+        uint32_t generation = 0;
+    };
+
+    TimerWheel();
+
+    /** @brief Drops every pending timer without firing it */
+    void reset();
+
+    /**
+     * @brief Calls listener->onTimer(tag) once delay seconds of game time have passed
+     * @return Handle for cancel() and the queries; fires no earlier than asked, at most a tick late
+     */
+    Handle schedule(float delay, TimerListener* listener, int tag = 0);
+
+    /** @brief Stops a pending timer and clears the handle; harmless if it already fired */
+    void cancel(Handle& handle);
+
+    bool isPending(const Handle& handle) const;
+
+    /** @brief Seconds until the timer fires, 0 if it is not pending */
+    float getRemaining(const Handle& handle) const;
+
+    /** @brief Moves game time forward and fires the timers that came due, in deadline order */
+    void advance(float delta);
+
+    double getTime() const { return static_cast<double>(now) * TICK + pending; }
+
+    int getCount() const { return count; }
+
+private:
+    static const int LEVEL0_BITS = 8;
+    static const int LEVEL_BITS = 6;
+    static const int LEVEL0_SLOTS = 1 << LEVEL0_BITS;
+    static const int LEVEL_SLOTS = 1 << LEVEL_BITS;
+    static const int BUCKETS = LEVEL0_SLOTS + 2 * LEVEL_SLOTS + 1;
+    static const int FIRING = BUCKETS - 1;  // Bucket of the slot being fired
+
+    struct Node
+    {
+        TimerListener* listener;
+        int tag;
+        uint64_t deadline;      // In ticks
+        int bucket;             // -1 while free
+        int prev;
+        int next;
+        uint32_t generation;
+    };
+
+    bool isLive(const Handle& handle) const;
+    void place(int index);
+    void link(int index, int bucket);
+    void unlink(int index);
+    void release(int index);
+    void cascade(int bucketBase, int slot);
+
+    std::vector<Node> nodes;
+    std::vector<int> free_nodes;
+    int heads[BUCKETS];
+    int count;
+
+    uint64_t now;               // Ticks processed so far
+    double pending;             // Game time not yet turned into a tick
+};
@@ -0,0 +1,170 @@
+#include "WavePlanner.h"
+#include <algorithm>
+#include <cmath>
+
+// ----------------------------------------------------
+// Static constant definitions
+// ----------------------------------------------------
+const float WavePlanner::TOTAL_GAME_TIME = 300.0f;
+const float WavePlanner::FIRST_BATCH_TIME = 8.0f;
+const float WavePlanner::FINAL_WAVE_PROGRESS = 0.999f;
+const float WavePlanner::FINAL_WAVE_DELAY = 4.0f;
+
+const int WaveRules::PHASE_COUNT;
+
+WaveRules WaveRules::defaults()
+{
+    WaveRules r;
+
+    // until, normal min, normal max, pole, bucket head, zomboni, gargantuar, interval
+    r.phases[0] = { 0.25f,                            1, 2, 0.0f,  0.0f,  0.0f,  0.0f,  10.0f };
+    r.phases[1] = { 0.60f,                            3, 5, 0.12f, 0.12f, 0.10f, 0.03f, 10.0f };
+    r.phases[2] = { WavePlanner::FINAL_WAVE_PROGRESS, 3, 5, 0.20f, 0.25f, 0.25f, 0.08f, 12.0f };
+
+    r.night_prob_scale = 0.8f;
+    return r;
+}
+
+WavePlanner::WavePlanner(bool isNightMode, const WaveRules& waveRules)
+    : is_night_mode(isNightMode)
+    , rules(waveRules)
+{
+}
+
+int WavePlanner::applyNightFactor(int baseCount, bool allowZero) const
+{
+    if (!is_night_mode) return baseCount;
+    if (baseCount <= 0) return 0;
+    float scaled = baseCount * 0.75f; // Reduce overall at night
+    int c = static_cast<int>(std::round(scaled));
+    if (!allowZero) c = std::max(1, c);
+    return std::max(0, c);
+}
+
+WavePlan WavePlanner::planTimedBatch(float normalizedTime, WaveRandom& rng) const
+{
+    // Phase division; past the last phase (final wave time) the first phase's numbers apply
+    int phaseIndex = 0;
+    for (int i = 0; i < WaveRules::PHASE_COUNT; ++i)
+    {
+        bool last = i == WaveRules::PHASE_COUNT - 1;
+        if (last ? normalizedTime < rules.phases[i].until : normalizedTime <= rules.phases[i].until)
+        {
+            phaseIndex = i;
+            break;
+        }
+    }
+    const WavePhaseRules& phase = rules.phases[phaseIndex];
+
+    // Phase parameters
+    int normalMin = phase.normal_min, normalMax = phase.normal_max;
+    float poleProb = phase.pole_prob;
+    float bucketHeadProb = phase.bucket_head_prob;
+    float zamboniProb = phase.zomboni_prob;
+    float gargantuarProb = phase.gargantuar_prob;
+    float intervalSec = phase.interval_sec;
+    int subBatches = rng.range(3, 4);
+    float subDelay = 0.9f;
+
+    // Adjust probability at night
+    float probScale = is_night_mode ? rules.night_prob_scale : 1.0f;
+    poleProb *= probScale;
+    bucketHeadProb *= probScale;
+    zamboniProb *= probScale;
+    gargantuarProb *= probScale;
+
+    // Generate count for this batch
+    int normalCnt = rng.range(normalMin, normalMax);
+    normalCnt = applyNightFactor(normalCnt, false);
+
+    int poleCnt = 0;
+    if (rng.unit() < poleProb) poleCnt = 1;
+
+    int zamboniCnt = 0;
+    if (rng.unit() < zamboniProb) zamboniCnt = 1;
+
+    int bucketHeadCnt = 0;
+    if (rng.unit() < bucketHeadProb) bucketHeadCnt = 1;
+
+    int gargantuarCnt = 0;
+    if (rng.unit() < gargantuarProb) gargantuarCnt = 1; // Maximum 1 gargantuar in regular phases
+
+    // Distribute to sub-batches
+    int nRemain = normalCnt, pRemain = poleCnt, bRemain = bucketHeadCnt, zRemain = zamboniCnt, gRemain = gargantuarCnt;
+
+    auto takePortion = [](int& remain, int slotsLeft) {
+        if (remain <= 0) return 0;
+        int base = remain / slotsLeft;
+        int extra = remain % slotsLeft;
+        int take = base + (extra > 0 ? 1 : 0);
+        remain -= take;
+        return take;
+    };
+
+    WavePlan plan;
+    plan.flagZombie = false;
+    plan.flagZombieRow = 0;
+    plan.nextIntervalSec = intervalSec;
+
+    for (int i = 0; i < subBatches; ++i) {
+        int slotsLeft = subBatches - i;
+        ZombieBatch batch;
+        batch.normal = takePortion(nRemain, slotsLeft);
+        batch.poleVaulter = takePortion(pRemain, slotsLeft);
+        batch.bucketHead = takePortion(bRemain, slotsLeft);
+        batch.zomboni = takePortion(zRemain, slotsLeft);
+        batch.gargantuar = takePortion(gRemain, slotsLeft);
+        batch.delaySec = i * subDelay;
+        plan.batches.push_back(batch);
+    }
+    plan.spawningDoneSec = plan.batches.empty() ? 0.0f : plan.batches.back().delaySec;
+
+    return plan;
+}
+
+WavePlan WavePlanner::planFinalWave(WaveRandom& rng) const
+{
+    float baseDelay = FINAL_WAVE_DELAY; // Start spawning after subtitle plays for 4 seconds
+
+    // Adjust count at night
+    int gCount = applyNightFactor(2, false); // Two gargantuars (keep at least 1 at night)
+
+    // Configuration for several sub-batches
+    int normal2 = applyNightFactor(rng.range(3, 5), false);
+    int pole2 = (rng.unit() < (is_night_mode ? 0.18f : 0.28f)) ? 1 : 0;
+
+    int zambo3 = applyNightFactor(1, true); // May be 0 (reduced at night)
+    int normal3 = applyNightFactor(rng.range(2, 3), false);
+
+    int normal4 = applyNightFactor(rng.range(3, 4), false);
+    int pole4 = (rng.unit() < (is_night_mode ? 0.16f : 0.24f)) ? 1 : 0;
+
+    int zambo5 = applyNightFactor(1, true);
+    int normal5 = applyNightFactor(rng.range(2, 3), false);
+
+    // Add bucket head zombies in final wave
+    int bucket2 = (rng.unit() < (is_night_mode ? 0.25f : 0.35f)) ? 1 : 0;
+    int bucket4 = (rng.unit() < (is_night_mode ? 0.20f : 0.30f)) ? 1 : 0;
+
+    // Sub-batches: 0s gargantuar, 1.2s normal+pole+bucket, 2.4s zamboni+normal, 3.6s normal+pole+bucket, 4.8s zamboni+normal (all delayed by 4 seconds)
+    WavePlan plan;
+    plan.flagZombie = true;
+    plan.flagZombieRow = 3;
+    plan.nextIntervalSec = 0.0f;
+
+    ZombieBatch b1 = { 0, 0, 0, 0, gCount, baseDelay + 0.0f };
+    ZombieBatch b2 = { normal2, pole2, bucket2, 0, 0, baseDelay + 1.2f };
+    ZombieBatch b3 = { normal3, 0, 0, zambo3, 0, baseDelay + 2.4f };
+    ZombieBatch b4 = { normal4, pole4, bucket4, 0, 0, baseDelay + 3.6f };
+    ZombieBatch b5 = { normal5, 0, 0, zambo5, 0, baseDelay + 4.8f };
+    plan.batches.push_back(b1);
+    plan.batches.push_back(b2);
+    plan.batches.push_back(b3);
+    plan.batches.push_back(b4);
+    plan.batches.push_back(b5);
+
+    // Mark final wave as all released a little after the last batch
+    plan.spawningDoneSec = baseDelay + 5.0f;
+
+    return plan;
+}
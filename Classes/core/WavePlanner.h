@@ -0,0 +1,114 @@
+#pragma once
+
+#include <vector>
+
+/**
+ * @brief Source of randomness for the wave planner.
+ * The game backs it with the WAVES stream of RandomService; the headless simulator backs it
+ * with its own seeded generator, so both produce batches with exactly the same rules.
+ */
+class WaveRandom
+{
+public:
+    virtual ~WaveRandom() {}
+
+    /** @brief Uniform integer in the inclusive range [a, b] (order of a and b does not matter) */
+    virtual int range(int a, int b) = 0;
+
+    /** @brief Uniform float in [0, 1] */
+    virtual float unit() = 0;
+};
+
+/**
+ * @struct ZombieBatch
+ * @brief One group of zombies released together after a delay.
+ */
+struct ZombieBatch
+{
+    int normal;
+    int poleVaulter;
+    int bucketHead;
+    int zomboni;
+    int gargantuar;
+    float delaySec;     // Delay relative to the moment the wave was planned
+};
+
+/**
+ * @struct WavePlan
+ * @brief Everything one call to the planner decided.
+ */
+struct WavePlan
+{
+    std::vector<ZombieBatch> batches;
+    float nextIntervalSec;      // Time until the next timed batch (timed batches only)
+    bool flagZombie;            // Spawn the flag zombie immediately (final wave only)
+    int flagZombieRow;
+    float spawningDoneSec;      // Delay after which every batch has been released
+};
+
+/**
+ * @struct WavePhaseRules
+ * @brief Tunable numbers of the timed batches in one phase of the level.
+ */
+struct WavePhaseRules
+{
+    float until;                // Last normalized time of the phase (inclusive)
+    int normal_min;
+    int normal_max;
+    float pole_prob;            // Chance of one pole vaulter per batch
+    float bucket_head_prob;
+    float zomboni_prob;
+    float gargantuar_prob;
+    float interval_sec;         // Time until the next timed batch
+};
+
+/**
+ * @struct WaveRules
+ * @brief Tunable numbers of the timed batches, so a balance sweep can override them.
+ */
+struct WaveRules
+{
+    static const int PHASE_COUNT = 3;
+
+    /** @brief Rules of the shipped game */
+    static WaveRules defaults();
+
+    WavePhaseRules phases[PHASE_COUNT];
+    float night_prob_scale;     // Special zombie chances are scaled by this at night
+};
+
+/**
+ * @brief Cocos-free wave rules shared by GameWorld and the headless simulator.
+ * Decides how many zombies of each type a batch contains and how they are split
+ * into sub-batches; the caller owns timing and actually spawning the zombies.
+ */
+class WavePlanner
+{
+public:
+    explicit WavePlanner(bool isNightMode, const WaveRules& rules = WaveRules::defaults());
+
+    /**
+     * @brief Plan a regular timed batch.
+     * @param normalizedTime Level progress in [0, 1]
+     * @param rng Random source (draw order is part of the rules)
+     */
+    WavePlan planTimedBatch(float normalizedTime, WaveRandom& rng) const;
+
+    /** @brief Plan the final (flag) wave */
+    WavePlan planFinalWave(WaveRandom& rng) const;
+
+    /** @brief Scale a zombie count down for night levels */
+    int applyNightFactor(int baseCount, bool allowZero = false) const;
+
+    /** @brief True once the level has progressed far enough to release the final wave */
+    static bool isFinalWaveTime(float normalizedTime) { return normalizedTime >= FINAL_WAVE_PROGRESS; }
+
+    static const float TOTAL_GAME_TIME;       // Level length in seconds
+    static const float FIRST_BATCH_TIME;      // Time of the first timed batch
+    static const float FINAL_WAVE_PROGRESS;   // Normalized time that triggers the final wave
+    static const float FINAL_WAVE_DELAY;      // Banner time before the final wave starts spawning
+
+private:
+    bool is_night_mode;
+    WaveRules rules;
+};
@@ -0,0 +1,113 @@
+#include "WaveSchedule.h"
+#include "GameTypes.h"
+#include <algorithm>
+#include <iterator>
+
+WaveSchedule::WaveSchedule()
+{
+    clear();
+}
+
+void WaveSchedule::clear()
+{
+    spawns.clear();
+    cursor = 0;
+    final_wave_time = 0.0f;
+    spawning_done_time = 0.0f;
+    std::fill(std::begin(totals), std::end(totals), 0);
+}
+
+void WaveSchedule::build(const WavePlanner& planner, WaveRandom& rng)
+{
+    clear();
+
+    // Timed batches, each planned at the level progress of its own due time
+    float time = WavePlanner::FIRST_BATCH_TIME;
+    for (;;)
+    {
+        float t = std::min(time / WavePlanner::TOTAL_GAME_TIME, 1.0f);
+        if (WavePlanner::isFinalWaveTime(t)) break;
+
+        WavePlan plan = planner.planTimedBatch(t, rng);
+        for (const auto& batch : plan.batches)
+        {
+            addBatch(time + batch.delaySec, batch, rng);
+        }
+        time += plan.nextIntervalSec;
+    }
+
+    // Final wave: the flag zombie comes with the banner, the batches after it
+    final_wave_time = WavePlanner::FINAL_WAVE_PROGRESS * WavePlanner::TOTAL_GAME_TIME;
+    WavePlan plan = planner.planFinalWave(rng);
+    if (plan.flagZombie)
+    {
+        add(final_wave_time, WaveZombie::FLAG, plan.flagZombieRow);
+    }
+    for (const auto& batch : plan.batches)
+    {
+        addBatch(final_wave_time + batch.delaySec, batch, rng);
+    }
+    spawning_done_time = final_wave_time + plan.spawningDoneSec;
+
+    // Sub-batches of one timed batch may run past the next one; equal times keep planning order
+    std::stable_sort(spawns.begin(), spawns.end(), [](const WaveSpawn& a, const WaveSpawn& b) {
+        return a.time < b.time;
+    });
+}
+
+void WaveSchedule::addBatch(float time, const ZombieBatch& batch, WaveRandom& rng)
+{
+    // Type order and one row draw per zombie, as the batches have always been released
+    for (int i = 0; i < batch.normal; ++i) add(time, WaveZombie::NORMAL, rng.range(0, MAX_ROW - 1));
+    for (int i = 0; i < batch.poleVaulter; ++i) add(time, WaveZombie::POLE_VAULTER, rng.range(0, MAX_ROW - 1));
+    for (int i = 0; i < batch.bucketHead; ++i) add(time, WaveZombie::BUCKET_HEAD, rng.range(0, MAX_ROW - 1));
+    for (int i = 0; i < batch.zomboni; ++i) add(time, WaveZombie::ZOMBONI, rng.range(0, MAX_ROW - 1));
+    for (int i = 0; i < batch.gargantuar; ++i) add(time, WaveZombie::GARGANTUAR, rng.range(0, MAX_ROW - 1));
+}
+
+void WaveSchedule::add(float time, WaveZombie type, int row)
+{
+    WaveSpawn spawn;
+    spawn.time = time;
+    spawn.type = type;
+    spawn.row = static_cast<uint8_t>(row);
+    spawns.push_back(spawn);
+    ++totals[static_cast<int>(type)];
+}
+
+const WaveSpawn* WaveSchedule::popDue(float time)
+{
+    if (cursor >= spawns.size() || spawns[cursor].time > time) return nullptr;
+    return &spawns[cursor++];
+}
+
+int WaveSchedule::getPeakSpawns(float window) const
+{
+    int peak = 0;
+    size_t first = 0;
+    for (size_t last = 0; last < spawns.size(); ++last)
+    {
+        while (spawns[last].time - spawns[first].time > window) ++first;
+        peak = std::max(peak, static_cast<int>(last - first + 1));
+    }
+    return peak;
+}
+
+int WaveSchedule::getPeakSpawns(WaveZombie type, float window) const
+{
+    std::vector<float> times;
+    times.reserve(getTotal(type));
+    for (const auto& spawn : spawns)
+    {
+        if (spawn.type == type) times.push_back(spawn.time);
+    }
+
+    int peak = 0;
+    size_t first = 0;
+    for (size_t last = 0; last < times.size(); ++last)
+    {
+        while (times[last] - times[first] > window) ++first;
+        peak = std::max(peak, static_cast<int>(last - first + 1));
+    }
+    return peak;
+}
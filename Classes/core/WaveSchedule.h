@@ -0,0 +1,85 @@
+#pragma once
+
+#include "WavePlanner.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Zombie types the wave rules spawn.
+ */
+enum class WaveZombie : uint8_t
+{
+    NORMAL,
+    POLE_VAULTER,
+    BUCKET_HEAD,
+    ZOMBONI,
+    GARGANTUAR,
+    FLAG,
+    COUNT
+};
+
+/** @brief One zombie of the schedule: when, what and where */
+struct WaveSpawn
+{
+    float time;         // Level time in seconds
+    WaveZombie type;
+    uint8_t row;
+};
+
+/**
+ * @brief Every zombie of a level, planned from the seed before the first frame.
+ *
+ * build() runs the WavePlanner for each timed batch at its due time and for the final wave,
+ * draws the spawn rows, and stores the result as one time-ordered table. GameWorld (and the
+ * headless simulator) drain it with popDue() from their update; nothing is scheduled as an
+ * action, so spawns stop with the game clock and are fully described by the seed. Because the
+ * table is known up front, counts per type and the busiest spawn window can be read at load
+ * time for prefetching and pool sizing.
+ */
+class WaveSchedule
+{
+public:
+    WaveSchedule();
+
+    /**
+     * @brief Plans the whole level and rewinds to its start.
+     * @param rng Random source (draw order is part of the rules)
+     */
+    void build(const WavePlanner& planner, WaveRandom& rng);
+
+    void clear();
+
+    /** @brief Next spawn due at or before time, or nullptr; each spawn is returned once */
+    const WaveSpawn* popDue(float time);
+
+    /** @brief Every spawn has been handed out */
+    bool isExhausted() const { return cursor >= spawns.size(); }
+
+    /** @brief Level time at which the final wave (banner and flag zombie) starts */
+    float getFinalWaveTime() const { return final_wave_time; }
+
+    /** @brief Level time after which the final wave counts as fully released */
+    float getSpawningDoneTime() const { return spawning_done_time; }
+
+    int getTotal() const { return static_cast<int>(spawns.size()); }
+    int getTotal(WaveZombie type) const { return totals[static_cast<int>(type)]; }
+
+    /** @brief Most zombies spawned within any window of the given length */
+    int getPeakSpawns(float window) const;
+
+    /** @brief Most zombies of one type spawned within any window of the given length */
+    int getPeakSpawns(WaveZombie type, float window) const;
+
+    const std::vector<WaveSpawn>& getSpawns() const { return spawns; }
+
+private:
+    void addBatch(float time, const ZombieBatch& batch, WaveRandom& rng);
+    void add(float time, WaveZombie type, int row);
+
+    std::vector<WaveSpawn> spawns;
+    size_t cursor;
+    float final_wave_time;
+    float spawning_done_time;
+    int totals[static_cast<int>(WaveZombie::COUNT)];
+};
@@ -0,0 +1,152 @@
+#include "WorldLayers.h"
+#include "GameDefs.h"
+#include <chrono>
+
+USING_NS_CC;
+
+namespace
+{
+    // Batches start small and grow; peas and ice come in the hundreds at most
+    const ssize_t BATCH_CAPACITY = 64;
+
+    /** @brief Times the re-sort that visit() does when the child list is dirty */
+    template<typename Base>
+    class SortTimed : public Base
+    {
+    public:
+        explicit SortTimed(WorldLayers* owner) : layers(owner) {}
+
+        virtual void sortAllChildren() override
+        {
+            if (!this->_reorderChildDirty)
+            {
+                Base::sortAllChildren();
+                return;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            Base::sortAllChildren();
+            std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            layers->recordSort(elapsed.count());
+        }
+
+    private:
+        WorldLayers* layers;
+    };
+
+    int layerZOrder(WorldLayer layer)
+    {
+        switch (layer)
+        {
+            case WorldLayer::ICE:     return ICE_LAYER;
+            case WorldLayer::PLANTS:  return PLANT_LAYER;
+            case WorldLayer::BULLETS: return BULLET_LAYER;
+            case WorldLayer::ZOMBIES: return ENEMY_LAYER;
+            case WorldLayer::SUNS:    return SUN_LAYER;
+            default:                  return 0;
+        }
+    }
+}
+
+WorldLayers::WorldLayers()
+{
+    for (auto& layer : layers)
+    {
+        layer = nullptr;
+    }
+    stats.child_sorts = 0;
+    stats.sort_ms = 0.0;
+}
+
+void WorldLayers::build(Node* world)
+{
+    // ICE_LAYER equals PLANT_LAYER; same z draws in order of arrival, so ice goes in first
+    for (int i = 0; i < static_cast<int>(WorldLayer::COUNT); ++i)
+    {
+        auto layer = new (std::nothrow) SortTimed<Node>(this);
+        if (layer && layer->init())
+        {
+            layer->autorelease();
+        }
+        else
+        {
+            CC_SAFE_DELETE(layer);
+            layer = nullptr;
+        }
+
+        layers[i] = layer;
+        batches[i].clear();
+        if (layer)
+        {
+            world->addChild(layer, layerZOrder(static_cast<WorldLayer>(i)));
+        }
+    }
+    stats.child_sorts = 0;
+    stats.sort_ms = 0.0;
+}
+
+void WorldLayers::add(WorldLayer layer, Node* node, int zOrder)
+{
+    get(layer)->addChild(node, zOrder);
+}
+
+void WorldLayers::addBatched(WorldLayer layer, Sprite* sprite)
+{
+    Node* target = get(layer);
+    if (Texture2D* texture = sprite->getTexture())
+    {
+        if (SpriteBatchNode* batch = getBatch(layer, texture)) target = batch;
+    }
+
+    if (sprite->getParent() == target) return;
+
+    // Recycled sprites may still hang off an old parent; keep them alive while moving
+    sprite->retain();
+    sprite->removeFromParent();
+    target->addChild(sprite);
+    sprite->release();
+}
+
+SpriteBatchNode* WorldLayers::getBatch(WorldLayer layer, Texture2D* texture)
+{
+    auto& list = batches[static_cast<int>(layer)];
+    for (const auto& entry : list)
+    {
+        if (entry.texture == texture) return entry.node;
+    }
+
+    auto batch = new (std::nothrow) SortTimed<SpriteBatchNode>(this);
+    if (!batch || !batch->initWithTexture(texture, BATCH_CAPACITY))
+    {
+        CC_SAFE_DELETE(batch);
+        return nullptr;
+    }
+    batch->autorelease();
+
+    // Batches sit above loose children of the layer (coins over suns)
+    get(layer)->addChild(batch, 1);
+    Batch entry = { texture, batch };
+    list.push_back(entry);
+    return batch;
+}
+
+int WorldLayers::getBatchCount() const
+{
+    int count = 0;
+    for (const auto& list : batches)
+    {
+        count += static_cast<int>(list.size());
+    }
+    return count;
+}
+
+void WorldLayers::recordSort(double ms)
+{
+    ++stats.child_sorts;
+    stats.sort_ms += ms;
+}
+
+uint32_t WorldLayers::getDrawCalls()
+{
+    return static_cast<uint32_t>(Director::getInstance()->getRenderer()->getDrawnBatches());
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "cocos2d.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Lawn entity categories, each drawn from its own container node.
+ */
+enum class WorldLayer
+{
+    ICE,        // Zomboni trails, under everything on the lawn
+    PLANTS,
+    BULLETS,
+    ZOMBIES,
+    SUNS,       // Suns and coins
+    COUNT
+};
+
+/**
+ * @brief Per-category container nodes between GameWorld and its lawn entities.
+ *
+ * Adding or removing an entity only dirties the child list of its own layer instead of the
+ * scene's. Sprites that share a texture (peas, puffs, ice slices, coins) go through addBatched(),
+ * which keeps one SpriteBatchNode per texture and layer so they draw as a single command.
+ * Every layer and batch times its own child sorts; with the renderer's draw-call count this
+ * is what benchmark reports show under "render".
+ */
+class WorldLayers
+{
+public:
+    struct RenderStats
+    {
+        uint32_t child_sorts;   // Child lists re-sorted since the layers were built
+        double sort_ms;         // Time spent in those sorts
+    };
+
+    WorldLayers();
+
+    /** @brief Creates the layer nodes as children of world, at the matching *_LAYER z orders */
+    void build(cocos2d::Node* world);
+
+    cocos2d::Node* get(WorldLayer layer) const { return layers[static_cast<int>(layer)]; }
+
+    void add(WorldLayer layer, cocos2d::Node* node, int zOrder = 0);
+
+    /**
+     * @brief Adds sprite to the batch of its texture in layer, moving it there if it has another parent.
+     * A sprite without a texture (or whose batch cannot be made) goes into the layer itself.
+     */
+    void addBatched(WorldLayer layer, cocos2d::Sprite* sprite);
+
+    /** @brief Number of batch nodes created so far */
+    int getBatchCount() const;
+
+    /** @brief Totals since build(); also counts sorts of the node passed to recordSort() */
+    const RenderStats& getRenderStats() const { return stats; }
+
+    /** @brief Adds one timed child sort, for containers outside the layers (the scene itself) */
+    void recordSort(double ms);
+
+    /** @brief Draw calls the renderer issued for the last drawn frame */
+    static uint32_t getDrawCalls();
+
+private:
+    struct Batch
+    {
+        cocos2d::Texture2D* texture;
+        cocos2d::SpriteBatchNode* node;
+    };
+
+    /** @brief Batch node for texture in layer, created on first use; nullptr if that fails */
+    cocos2d::SpriteBatchNode* getBatch(WorldLayer layer, cocos2d::Texture2D* texture);
+
+    cocos2d::Node* layers[static_cast<int>(WorldLayer::COUNT)];
+    std::vector<Batch> batches[static_cast<int>(WorldLayer::COUNT)];
+    RenderStats stats;
+};
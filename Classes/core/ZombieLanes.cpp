@@ -0,0 +1,142 @@
+#include "ZombieLanes.h"
+
+namespace
+{
+    template <typename T>
+    void eraseAt(std::vector<T>& values, int index)
+    {
+        values.erase(values.begin() + index);
+    }
+}
+
+ZombieLanes::ZombieLanes()
+{
+}
+
+ZombieLanes::~ZombieLanes()
+{
+    clear();
+}
+
+void ZombieLanes::add(Zombie* zombie, ZombieSlot* slot, int row, const Entry& entry)
+{
+    Row& lane = rows[row];
+    slot->lanes = this;
+    slot->row = row;
+    slot->index = static_cast<int>(lane.size());
+
+    lane.zombie.push_back(zombie);
+    lane.slot.push_back(slot);
+    lane.x.push_back(entry.x);
+    lane.y.push_back(entry.y);
+    lane.shown_x.push_back(entry.x);
+    lane.shown_y.push_back(entry.y);
+    lane.speed.push_back(entry.speed);
+    lane.fall.push_back(entry.fall);
+    lane.move.push_back(0.0f);
+    lane.timer.push_back(entry.timer);
+    lane.timer_rate.push_back(0.0f);
+    lane.interval.push_back(entry.interval);
+    lane.flags.push_back(0);
+    lane.due.push_back(0);
+    setFlags(*slot, entry.flags);
+}
+
+void ZombieLanes::remove(ZombieSlot* slot)
+{
+    if (slot->lanes != this) return;
+
+    Row& lane = rows[slot->row];
+    int index = slot->index;
+    eraseAt(lane.zombie, index);
+    eraseAt(lane.slot, index);
+    eraseAt(lane.x, index);
+    eraseAt(lane.y, index);
+    eraseAt(lane.shown_x, index);
+    eraseAt(lane.shown_y, index);
+    eraseAt(lane.speed, index);
+    eraseAt(lane.fall, index);
+    eraseAt(lane.move, index);
+    eraseAt(lane.timer, index);
+    eraseAt(lane.timer_rate, index);
+    eraseAt(lane.interval, index);
+    eraseAt(lane.flags, index);
+    eraseAt(lane.due, index);
+
+    // Entries after the removed one moved down by one
+    for (size_t i = index; i < lane.size(); ++i)
+    {
+        lane.slot[i]->index = static_cast<int>(i);
+    }
+    *slot = ZombieSlot();
+}
+
+void ZombieLanes::clear()
+{
+    for (auto& lane : rows)
+    {
+        for (auto slot : lane.slot)
+        {
+            *slot = ZombieSlot();
+        }
+        lane = Row();
+    }
+}
+
+int ZombieLanes::getCount() const
+{
+    int count = 0;
+    for (const auto& lane : rows)
+    {
+        count += static_cast<int>(lane.size());
+    }
+    return count;
+}
+
+void ZombieLanes::setFlags(const ZombieSlot& slot, uint8_t flags)
+{
+    Row& lane = rows[slot.row];
+    lane.flags[slot.index] = flags;
+    lane.move[slot.index] = (flags & MOVES) ? 1.0f : 0.0f;
+    lane.timer_rate[slot.index] = (flags & TIMER) ? 1.0f : 0.0f;
+}
+
+void ZombieLanes::integrate(float delta)
+{
+    for (auto& lane : rows)
+    {
+        const size_t count = lane.size();
+        float* x = lane.x.data();
+        float* y = lane.y.data();
+        const float* speed = lane.speed.data();
+        const float* fall = lane.fall.data();
+        const float* move = lane.move.data();
+
+        // No branches or calls: stopped entries multiply by a zero mask
+        for (size_t i = 0; i < count; ++i)
+        {
+            float step = move[i] * delta;
+            x[i] -= speed[i] * step;
+            y[i] -= fall[i] * step;
+        }
+    }
+}
+
+void ZombieLanes::advanceTimers(float delta)
+{
+    for (auto& lane : rows)
+    {
+        const size_t count = lane.size();
+        float* timer = lane.timer.data();
+        const float* rate = lane.timer_rate.data();
+        const float* interval = lane.interval.data();
+        const uint8_t* flags = lane.flags.data();
+        uint8_t* due = lane.due.data();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            timer[i] += rate[i] * delta;
+            due[i] = static_cast<uint8_t>((timer[i] >= interval[i]) & ((flags[i] & EATS) != 0));
+        }
+    }
+}
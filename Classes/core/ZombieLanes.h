@@ -0,0 +1,112 @@
+#pragma once
+
+#include "GameTypes.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Zombie;
+class ZombieLanes;
+
+/**
+ * @brief Where a zombie's hot state lives inside ZombieLanes.
+ * Owned by the zombie; the store keeps index current when entries before it are removed.
+ */
+struct ZombieSlot
+{
+    ZombieLanes* lanes = nullptr;   // nullptr while the zombie is not on the lawn
+    int row = -1;
+    int index = -1;
+};
+
+/**
+ * @brief Structure-of-arrays store of the zombies on the lawn, stepped once per frame by GameWorld.
+ *
+ * Each row keeps one array per field, in the same order as GameWorld's zombies_in_row.
+ * integrate() moves every zombie and advanceTimers() runs every attack timer in branch-free
+ * loops over those arrays; per-zombie code only runs for entries whose flags ask for it
+ * (TICKS, or a due bite). The store owns x/y and the attack timer while a zombie is enlisted;
+ * speed, fall, interval and flags are copies the zombie writes through on every change.
+ */
+class ZombieLanes
+{
+public:
+    /** @brief Per-entry behaviour bits, chosen by Zombie::getLaneFlags() */
+    enum Flags : uint8_t
+    {
+        MOVES = 1 << 0,     // x -= speed * dt, y -= fall * dt
+        TIMER = 1 << 1,     // Attack timer advances
+        EATS  = 1 << 2,     // A timer that reaches the interval is a bite
+        TICKS = 1 << 3      // Needs Zombie::updateLaneTick this frame
+    };
+
+    /** @brief One row of zombies, one array per field */
+    struct Row
+    {
+        std::vector<Zombie*> zombie;
+        std::vector<ZombieSlot*> slot;
+        std::vector<float> x;
+        std::vector<float> y;
+        std::vector<float> shown_x;     // Position last written to the sprite
+        std::vector<float> shown_y;
+        std::vector<float> speed;       // Leftward speed, px/s
+        std::vector<float> fall;        // Downward speed while moving, px/s
+        std::vector<float> move;        // 1 if MOVES is set, else 0
+        std::vector<float> timer;       // Attack timer, seconds
+        std::vector<float> timer_rate;  // 1 if TIMER is set, else 0
+        std::vector<float> interval;    // Seconds between bites
+        std::vector<uint8_t> flags;
+        std::vector<uint8_t> due;       // Set by advanceTimers for bites to resolve this frame
+
+        size_t size() const { return zombie.size(); }
+    };
+
+    /** @brief Initial values of a new entry */
+    struct Entry
+    {
+        float x;
+        float y;
+        float speed;
+        float fall;
+        float timer;
+        float interval;
+        uint8_t flags;
+    };
+
+    ZombieLanes();
+    ~ZombieLanes();
+
+    ZombieLanes(const ZombieLanes&) = delete;
+    ZombieLanes& operator=(const ZombieLanes&) = delete;
+
+    /** @brief Appends a zombie to a row and points slot at the new entry */
+    void add(Zombie* zombie, ZombieSlot* slot, int row, const Entry& entry);
+
+    /** @brief Removes the entry of slot, keeping the row order, and detaches slot */
+    void remove(ZombieSlot* slot);
+
+    /** @brief Detaches and drops every entry */
+    void clear();
+
+    /** @brief Moves every entry flagged MOVES */
+    void integrate(float delta);
+
+    /** @brief Advances the timers flagged TIMER and marks due bites of entries flagged EATS */
+    void advanceTimers(float delta);
+
+    Row& getRow(int row) { return rows[row]; }
+    const Row& getRow(int row) const { return rows[row]; }
+    int getCount() const;
+
+    // Field access through a slot; the slot must be attached to this store
+    float getX(const ZombieSlot& slot) const { return rows[slot.row].x[slot.index]; }
+    void setX(const ZombieSlot& slot, float x) { rows[slot.row].x[slot.index] = x; }
+    float getTimer(const ZombieSlot& slot) const { return rows[slot.row].timer[slot.index]; }
+    void setTimer(const ZombieSlot& slot, float timer) { rows[slot.row].timer[slot.index] = timer; }
+    void setSpeed(const ZombieSlot& slot, float speed) { rows[slot.row].speed[slot.index] = speed; }
+    void setFall(const ZombieSlot& slot, float fall) { rows[slot.row].fall[slot.index] = fall; }
+    void setFlags(const ZombieSlot& slot, uint8_t flags);
+
+private:
+    Row rows[MAX_ROW];
+};
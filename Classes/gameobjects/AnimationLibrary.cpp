@@ -0,0 +1,194 @@
+#include "AnimationLibrary.h"
+#include "SpriteAtlas.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+// ----------------------------------------------------
+// AnimationSpec
+// ----------------------------------------------------
+
+AnimationSpec AnimationSpec::grid(const std::string& file, float frameWidth, float frameHeight,
+    int row, int col, int frameCount, float delay)
+{
+    // Same frames as range(0, n - 1) once capped, so both share one registry entry
+    int count = std::max(0, std::min(frameCount, row * col));
+    return range(file, frameWidth, frameHeight, row, col, 0, count - 1, delay);
+}
+
+AnimationSpec AnimationSpec::range(const std::string& file, float frameWidth, float frameHeight,
+    int row, int col, int startIndex, int endIndex, float delay)
+{
+    AnimationSpec spec;
+    spec.file = file;
+    spec.frame_width = frameWidth;
+    spec.frame_height = frameHeight;
+    spec.row = row;
+    spec.col = col;
+    spec.start_index = startIndex;
+    spec.frame_count = std::max(0, endIndex - startIndex + 1);
+    spec.wraps = false;
+    spec.delay = delay;
+    return spec;
+}
+
+AnimationSpec AnimationSpec::cycle(const std::string& file, float frameWidth, float frameHeight,
+    int row, int col, int startIndex, int totalFrameCount, float delay)
+{
+    AnimationSpec spec = range(file, frameWidth, frameHeight, row, col, 0, totalFrameCount - 1, delay);
+    if (totalFrameCount > 0 && startIndex % totalFrameCount != 0)
+    {
+        // A cycle starting on frame 0 is a plain range
+        spec.start_index = startIndex % totalFrameCount;
+        spec.wraps = true;
+    }
+    return spec;
+}
+
+std::string AnimationSpec::key() const
+{
+    return StringUtils::format("%s|%.2fx%.2f|%dx%d|%d+%d%s|%.4f",
+        file.c_str(), frame_width, frame_height, row, col,
+        start_index, frame_count, wraps ? "c" : "", delay);
+}
+
+// ----------------------------------------------------
+// AnimationLibrary
+// ----------------------------------------------------
+
+AnimationLibrary* AnimationLibrary::instance = nullptr;
+
+AnimationLibrary* AnimationLibrary::getInstance()
+{
+    if (!instance)
+    {
+        instance = new (std::nothrow) AnimationLibrary();
+    }
+    return instance;
+}
+
+AnimationLibrary::AnimationLibrary()
+{
+    stats.animations = 0;
+    stats.frames = 0;
+    stats.frame_bytes = 0;
+    stats.texture_bytes = 0;
+    resetStats();
+}
+
+void AnimationLibrary::resetStats()
+{
+    stats.hits = 0;
+    stats.misses = 0;
+}
+
+SpriteFrame* AnimationLibrary::getFrame(const AnimationSpec& spec, int index)
+{
+    float x = (index % spec.col) * spec.frame_width;
+    float y = (index / spec.col) * spec.frame_height;
+
+    std::string frameKey = StringUtils::format("%s|%.2f,%.2f|%.2fx%.2f",
+        spec.file.c_str(), x, y, spec.frame_width, spec.frame_height);
+
+    auto it = frames.find(frameKey);
+    if (it != frames.end())
+    {
+        return it->second;
+    }
+
+    // Packed cell when the sheet is in an atlas, otherwise sliced from the loose sheet
+    auto frame = SpriteAtlas::getInstance()->createCellFrame(spec.file, index, Rect(x, y, spec.frame_width, spec.frame_height));
+    if (!frame)
+    {
+        return nullptr;
+    }
+    frame->retain();
+    frames[frameKey] = frame;
+
+    // Byte estimates follow the texture's pixel format
+    size_t bytesPerPixel = 4;
+    auto texture = frame->getTexture();
+    if (texture)
+    {
+        bytesPerPixel = std::max(1u, texture->getBitsPerPixelForFormat() / 8);
+        if (textures.find(texture) == textures.end())
+        {
+            size_t textureBytes = static_cast<size_t>(texture->getPixelsWide()) * texture->getPixelsHigh() * bytesPerPixel;
+            textures[texture] = textureBytes;
+            stats.texture_bytes += textureBytes;
+        }
+    }
+
+    ++stats.frames;
+    // Packed cells are trimmed, so count the frame's own rect rather than the grid cell
+    const Rect& frameRect = frame->getRect();
+    stats.frame_bytes += static_cast<size_t>(frameRect.size.width * frameRect.size.height) * bytesPerPixel;
+    return frame;
+}
+
+Animation* AnimationLibrary::get(const AnimationSpec& spec)
+{
+    std::string animationKey = spec.key();
+
+    auto it = animations.find(animationKey);
+    if (it != animations.end())
+    {
+        ++stats.hits;
+        return it->second;
+    }
+    ++stats.misses;
+
+    Vector<SpriteFrame*> animationFrames;
+    for (int i = 0; i < spec.frame_count; ++i)
+    {
+        int index = spec.wraps ? (spec.start_index + i) % spec.frame_count : spec.start_index + i;
+        auto frame = getFrame(spec, index);
+        if (frame)
+        {
+            animationFrames.pushBack(frame);
+        }
+    }
+
+    auto animation = Animation::createWithSpriteFrames(animationFrames, spec.delay);
+    animation->retain();
+    animations[animationKey] = animation;
+    ++stats.animations;
+    return animation;
+}
+
+void AnimationLibrary::warm(const std::vector<AnimationSpec>& specs)
+{
+    for (const auto& spec : specs)
+    {
+        get(spec);
+    }
+}
+
+void AnimationLibrary::logStats() const
+{
+    CCLOG("AnimationLibrary: hits=%ld misses=%ld animations=%d frames=%d frameKB=%zu textureKB=%zu",
+        stats.hits, stats.misses, stats.animations, stats.frames,
+        stats.frame_bytes / 1024, stats.texture_bytes / 1024);
+}
+
+void AnimationLibrary::clear()
+{
+    logStats();
+
+    for (auto& entry : animations)
+    {
+        entry.second->release();
+    }
+    for (auto& entry : frames)
+    {
+        entry.second->release();
+    }
+    animations.clear();
+    frames.clear();
+    textures.clear();
+
+    stats.animations = 0;
+    stats.frames = 0;
+    stats.frame_bytes = 0;
+    stats.texture_bytes = 0;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "cocos2d.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Describes one animation sliced out of a grid sprite sheet.
+ * Built through grid()/range()/cycle(), which match the three GameObject::initAnimate helpers.
+ */
+struct AnimationSpec
+{
+    std::string file;       // Sprite sheet texture
+    float frame_width;      // Width of a single cell
+    float frame_height;     // Height of a single cell
+    int row;                // Rows in the sheet
+    int col;                // Columns in the sheet
+    int start_index;        // First frame (or rotation start for a cycle)
+    int frame_count;        // Frames in the animation
+    bool wraps;             // true: frame i is (start_index + i) % frame_count
+    float delay;            // Time between frames
+
+    /** @brief The first frameCount cells, row by row, capped to the grid size */
+    static AnimationSpec grid(const std::string& file, float frameWidth, float frameHeight,
+        int row, int col, int frameCount, float delay);
+
+    /** @brief Cells startIndex..endIndex inclusive */
+    static AnimationSpec range(const std::string& file, float frameWidth, float frameHeight,
+        int row, int col, int startIndex, int endIndex, float delay);
+
+    /** @brief totalFrameCount cells played from startIndex and wrapping back to 0 */
+    static AnimationSpec cycle(const std::string& file, float frameWidth, float frameHeight,
+        int row, int col, int startIndex, int totalFrameCount, float delay);
+
+    /** @brief Registry key: sheet, cell size, grid, frame range and delay */
+    std::string key() const;
+};
+
+/**
+ * @brief Process-wide registry of sliced sprite sheet animations.
+ *
+ * Each distinct AnimationSpec is built once and the same cocos2d::Animation is handed to
+ * every entity that asks for it; callers only wrap it in Animate::create, which never
+ * modifies the animation. Sprite frames are cached per (sheet, cell) as well, so cycle
+ * variants that start on different frames share their frames.
+ */
+class AnimationLibrary
+{
+public:
+    /** @brief Cache counters, logged on clear() */
+    struct Stats
+    {
+        long hits;              // get() calls served from the registry
+        long misses;            // get() calls that had to build an animation
+        int animations;         // Animations currently held
+        int frames;             // Sprite frames currently held
+        size_t frame_bytes;     // Pixel bytes covered by the held frames
+        size_t texture_bytes;   // Bytes of the distinct sheets or atlas pages behind them
+    };
+
+    /** @brief Access the global animation library. */
+    static AnimationLibrary* getInstance();
+
+    AnimationLibrary(const AnimationLibrary&) = delete;
+    AnimationLibrary& operator=(const AnimationLibrary&) = delete;
+
+    /**
+     * @brief Returns the shared animation for spec, building it on first use.
+     * The library keeps its own reference; callers must not release it.
+     */
+    cocos2d::Animation* get(const AnimationSpec& spec);
+
+    /** @brief Builds every spec up front, e.g. at level start, so spawns never slice sheets */
+    void warm(const std::vector<AnimationSpec>& specs);
+
+    /** @brief Drops every cached animation and frame */
+    void clear();
+
+    const Stats& getStats() const { return stats; }
+
+    /** @brief Resets the hit/miss counters; the size counters always reflect the cache */
+    void resetStats();
+
+    /** @brief Prints the counters, e.g. when a level ends */
+    void logStats() const;
+
+private:
+    AnimationLibrary();
+    static AnimationLibrary* instance;
+
+    cocos2d::SpriteFrame* getFrame(const AnimationSpec& spec, int index);
+
+    std::unordered_map<std::string, cocos2d::Animation*> animations;
+    std::unordered_map<std::string, cocos2d::SpriteFrame*> frames;
+    std::unordered_map<const cocos2d::Texture2D*, size_t> textures;    // Sheet or atlas page -> texture bytes
+    Stats stats;
+};
@@ -1,5 +1,6 @@
 #include "Coin.h"
-#include "audio/include/AudioEngine.h"
+#include "Log.h"
+#include "SoundManager.h"
 
 USING_NS_CC;
 
@@ -14,18 +15,20 @@ const float Coin::LIFETIME = 10.0f;
 Coin::Coin()
     : is_collected(false)
     , is_collecting(false)
-    , life_time(0.0f)
+    , is_expired(false)
+    , timers(nullptr)
     , target_pos(Vec2::ZERO)
     , coin_scale(1.0f)
     , coin_type(CoinType::SILVER)
 {
-    CCLOG("Coin instance created.");
+    LOG_TRACE(LIFECYCLE, "Coin instance created.");
 }
 
 // Destructor
 Coin::~Coin()
 {
-    CCLOG("Coin instance destroyed.");
+    if (timers) timers->cancel(lifetime);
+    LOG_TRACE(LIFECYCLE, "Coin instance destroyed.");
 }
 
 // Initialization logic
@@ -41,34 +44,32 @@ bool Coin::init(CoinType coinType)
     // Initialize sprite with the corresponding texture based on type
     if (!Sprite::initWithFile(IMAGE_FILENAME[static_cast<int>(coin_type)]))
     {
-        CCLOG("Failed to load coin image: %s", IMAGE_FILENAME[static_cast<int>(coin_type)].c_str());
+        LOG_WARN(ASSETS, "Failed to load coin image: %s", IMAGE_FILENAME[static_cast<int>(coin_type)].c_str());
         return false;
     }
 
     // Apply visual properties
     this->setScale(coin_scale);
     is_collected = false;
-    life_time = 0.0f;
+    is_expired = false;
 
     // Trigger idle animations (spinning effect)
     setAnimation();
 
-    // Enable per-frame update scheduling
-    this->scheduleUpdate();
-
     return true;
 }
 
-// Per-frame logic update
-void Coin::update(float delta)
+// Lifetime runs in game time on the level's timer wheel
+void Coin::startLifetime(TimerWheel* newTimers)
 {
-    // Do not update lifetime if the coin is already being processed for collection
-    if (is_collected || is_collecting)
-    {
-        return;
-    }
+    timers = newTimers;
+    lifetime = timers->schedule(LIFETIME, this);
+}
 
-    life_time += delta;
+void Coin::onTimer(int tag)
+{
+    lifetime = TimerWheel::Handle();
+    is_expired = true;
 }
 
 // Returns true if the coin is interactive
@@ -87,14 +88,17 @@ void Coin::collect(const std::function<void(int)>& onfinished)
 
     this->is_collecting = true;
 
+    // A coin being collected no longer expires
+    if (timers) timers->cancel(lifetime);
+
     // Play specific audio feedback based on coin value
     if (coin_type == CoinType::DIAMOND)
     {
-        cocos2d::AudioEngine::play2d("diamond.mp3", false);
+        SoundManager::getInstance()->post("diamond.mp3");
     }
     else
     {
-        cocos2d::AudioEngine::play2d("coin.mp3", false);
+        SoundManager::getInstance()->post("coin.mp3");
     }
 
     // Movement animation towards the UI currency display (50, 20)
@@ -117,13 +121,13 @@ void Coin::collect(const std::function<void(int)>& onfinished)
     auto sequence = Sequence::create(move, fadeOut, addCoinValue, markCollected, nullptr);
     this->runAction(sequence);
 
-    CCLOG("Coin collection sequence started. Value: %d", COIN_VALUE[static_cast<int>(coin_type)]);
+    LOG_DEBUG(ECONOMY, "Coin collection sequence started. Value: %d", COIN_VALUE[static_cast<int>(coin_type)]);
 }
 
 // Condition for GameWorld to remove this object from the container
 bool Coin::shouldRemove() const
 {
-    return is_collected || (life_time >= LIFETIME);
+    return is_collected || is_expired;
 }
 
 // Creates the "3D" spinning effect by scaling the X-axis
@@ -3,13 +3,14 @@
 #include "cocos2d.h"
 #include "GameObject.h"
 #include "GameDefs.h"
+#include "TimerWheel.h"
 #include <string>
 
 /**
  * @brief Coin class for currency collection
  * Can be dropped by defeated zombies or generated through special events
  */
-class Coin : public GameObject
+class Coin : public GameObject, public TimerListener
 {
 public:
     /**
@@ -36,10 +37,12 @@ public:
     static Coin* create(CoinType coinType);
 
     /**
-     * @brief Update function for movement and lifetime tracking
-     * @param delta Time elapsed since the last frame
+     * @brief Starts the lifetime on timers, called by GameWorld when the coin is added
      */
-    virtual void update(float delta) override;
+    void startLifetime(TimerWheel* timers);
+
+    /** @brief Lifetime ran out before the coin was collected */
+    virtual void onTimer(int tag) override;
 
     /**
      * @brief Check if the coin is currently in a state where the player can click it
@@ -80,7 +83,9 @@ private:
     // ----------------------------------------------------
     bool is_collected;        // Flag indicating if the coin lifecycle is finished
     bool is_collecting;       // Flag indicating if the collection animation is active
-    float life_time;          // Counter for tracking time elapsed since creation
+    bool is_expired;          // Flag indicating the lifetime ran out uncollected
+    TimerWheel* timers;       // Clock of the level, set by startLifetime
+    TimerWheel::Handle lifetime;  // Pending while the coin waits to be collected
     cocos2d::Vec2 target_pos; // Final destination for falling/jumping trajectory
     float coin_scale;         // Visual scale factor
     CoinType coin_type;       // The specific type of this coin instance
@@ -3,6 +3,7 @@
 
 #include "cocos2d.h"
 #include "GameDefs.h"
+#include "AnimationLibrary.h"
 
 /**
  * @brief Base class for all interactive objects displayed on screen.
@@ -24,6 +25,22 @@ public:
     virtual bool init() override;
 
 protected:
+    /**
+     * @brief Returns the shared animation described by spec.
+     * All initAnimate helpers go through AnimationLibrary, so each sheet is sliced once per process
+     * and the result must not be modified; wrap it in Animate::create as usual.
+     */
+    cocos2d::Animation* initAnimate(const AnimationSpec& spec);
+
+    /**
+     * @brief Initializes the sprite's first frame, preferring the packed atlas over the loose file.
+     * A packed sheet starts on its first cell and a packed image on rect, so the loose texture is
+     * only loaded when the atlases were not built.
+     * @param fileName Sprite sheet or image, as passed to Sprite::initWithFile
+     * @param rect Part of the file to show; Rect::ZERO selects the whole image
+     */
+    bool initWithAtlasFile(const std::string& fileName, const cocos2d::Rect& rect = cocos2d::Rect::ZERO);
+
     /**
      * @brief Creates an animation by cycling through frames starting from a specific index
      * @param fileName Path to the sprite sheet texture
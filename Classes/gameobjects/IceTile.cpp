@@ -28,28 +28,4 @@ IceTile* IceTile::create(const Vec2& worldPos, int iceIndex)
     ice->autorelease();
 
     return ice;
-}
-
-void IceTile::update(float dt)
-{
-    life_time += dt;
-    if (life_time >= max_life)
-    {
-        expired = true;
-    }
-}
-
-int IceTile::getRow()
-{
-    // Coordinate conversion to determine row based on global game definitions
-    int row = static_cast<int>((this->getPositionY() + 30 - GRID_ORIGIN.y - CELLSIZE.height * 0.7f) / CELLSIZE.height);
-
-    // Log for debugging grid placement
-    CCLOG("Ice tile identified in row: %d", row);
-    return row;
-}
-
-void IceTile::markAsExpired()
-{
-    this->expired = true;
 }
\ No newline at end of file
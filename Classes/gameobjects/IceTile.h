@@ -20,31 +20,12 @@ public:
     static IceTile* create(const cocos2d::Vec2& worldPos, int iceIndex);
 
     /**
-     * @brief Per-frame logic update for expiration timing
-     * @param dt Delta time since last frame
+     * @brief Seconds until the slice melts on its own; GameWorld times it
      */
-    virtual void update(float dt) override;
-
-    /**
-     * @brief Returns whether the ice tile has reached its maximum lifespan
-     */
-    bool isExpired() const { return expired; }
-
-    /**
-     * @brief Calculates which grid row this tile occupies
-     * @return Zero-based row index
-     */
-    int getRow();
-
-    /**
-     * @brief Manually flag the tile for removal
-     */
-    void markAsExpired();
+    float getLifetime() const { return max_life; }
 
 private:
-    float life_time = 0.0f; // Accumulated time since creation
     float max_life = 60.0f; // Maximum duration (seconds) before melting
-    bool expired = false;   // Removal flag
 };
 
 #endif // __ICE_TILE_H__
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "Mower.h"
-#include "audio/include/AudioEngine.h"
+#include "Log.h"
+#include "SoundManager.h"
 
 USING_NS_CC;
 
@@ -44,7 +45,7 @@ void Mower::start()
     moving = true;
 
     // Play the activation sound effect
-    cocos2d::AudioEngine::play2d("Lawnmower.ogg", false, 1.0f);
+    SoundManager::getInstance()->post("Lawnmower.ogg", SoundPriority::HIGH);
 
     // Calculate movement parameters
     auto visibleSize = Director::getInstance()->getVisibleSize();
@@ -58,5 +59,5 @@ void Mower::start()
     auto moveAction = MoveBy::create(duration, Vec2(targetDistance, 0));
     this->runAction(moveAction);
 
-    CCLOG("Mower activated and moving across the row.");
+    LOG_DEBUG(COMBAT, "Mower activated and moving across the row.");
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "Rake.h"
+#include "Log.h"
 #include "Zombie.h"
-#include "audio/include/AudioEngine.h"
+#include "SoundManager.h"
 
 USING_NS_CC;
 
@@ -49,7 +50,7 @@ void Rake::trigger(Zombie* z)
     used = true;
 
     // Play feedback sound (the "bonk" when the handle hits the zombie)
-    cocos2d::AudioEngine::play2d("bonk.mp3", false, 1.0f);
+    SoundManager::getInstance()->post("bonk.mp3", SoundPriority::NORMAL);
 
     // Visual sequence: The rake flips up and then removes itself
     auto rotateUp = RotateBy::create(0.12f, 49.0f);
@@ -57,7 +58,7 @@ void Rake::trigger(Zombie* z)
 
     this->runAction(Sequence::create(rotateUp, removeAction, nullptr));
 
-    CCLOG("Rake trap triggered by zombie.");
+    LOG_DEBUG(COMBAT, "Rake trap triggered by zombie.");
 }
 
 cocos2d::Rect Rake::getBoundingBox() const
@@ -1,6 +1,6 @@
 #include "SeedPacket.h"
+#include "Log.h"
 #include "Plant.h"
-#include "GameWorld.h"
 #include "Sunflower.h"
 #include "Sunshroom.h"
 #include "PeaShooter.h"
@@ -18,22 +18,49 @@
 
 USING_NS_CC;
 
+namespace
+{
+    /** @brief Appends "folder/1 (1).png" .. "folder/1 (count).png", the Mushroom/PotatoMine frame naming */
+    std::vector<std::string> frameFiles(const std::string& folder, int count, std::vector<std::string> files = {})
+    {
+        for (int i = 1; i <= count; ++i)
+        {
+            files.push_back(folder + "/1 (" + std::to_string(i) + ").png");
+        }
+        return files;
+    }
+}
+
 // Initialize the static configuration table with plant-specific metadata and factory lambdas
 const std::map<PlantName, PlantConfig> SeedPacket::CONFIG_TABLE = {
-    {PlantName::SUNFLOWER,    {"seedpacket_sunflower.png", 7.5f, 50,    [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<Sunflower>(i,c,s,n); }}},
-    {PlantName::SUNSHROOM,    {"seedpacket_sunshroom.png", 7.5f, 25,    [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<Sunshroom>(i,c,s,n); }}},
-    {PlantName::PEASHOOTER,   {"seedpacket_peashooter.png", 7.5f, 100,  [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<PeaShooter>(i,c,s,n); }}},
-    {PlantName::REPEATER,     {"seedpacket_repeater.png", 7.5f, 200,    [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<Repeater>(i,c,s,n); }}},
-    {PlantName::THREEPEATER,  {"Threepeater_Seed_Packet_PC.png", 7.5f, 325, [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<ThreePeater>(i,c,s,n); }}},
-    {PlantName::PUFFSHROOM,   {"seedpacket_puffshroom.png", 7.5f, 0,     [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<Puffshroom>(i,c,s,n); }}},
-    {PlantName::WALLNUT,      {"seedpacket_wallnut.png", 30.0f, 50,    [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<Wallnut>(i,c,s,n); }}},
-    {PlantName::CHERRYBOMB,   {"seedpacket_cherry_bomb.png", 50.0f, 150, [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<CherryBomb>(i,c,s,n); }}},
-    {PlantName::SPIKEWEED,    {"seedpacket_spikeweed.png", 7.5f, 100,   [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<SpikeWeed>(i,c,s,n); }}},
-    {PlantName::JALAPENO,     {"seedpacket_jalapeno.png", 50.0f, 125,   [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<Jalapeno>(i,c,s,n); }}},
-    {PlantName::TWINSUNFLOWER,{"seedpacket_twinsunflower.png", 50.0f, 150, [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<TwinSunflower>(i,c,s,n); }}},
-    {PlantName::GATLINGPEA,   {"seedpacket_gatlingpea.png", 50.0f, 250,  [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<GatlingPea>(i,c,s,n); }}},
-    {PlantName::POTATOMINE,   {"seedpacket_potatoBomb.png", 30.0f, 25,   [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<PotatoMine>(i,c,s,n); }}},
-    {PlantName::SPIKEROCK,    {"seedpacket_spikerock.png", 50.0f, 125,  [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<SpikeRock>(i,c,s,n); }}}
+    {PlantName::SUNFLOWER,    {"seedpacket_sunflower.png", 7.5f, 50,    [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<Sunflower>(i,c,s,n); },
+        {"Sunflower_spritesheet.png"}}},
+    {PlantName::SUNSHROOM,    {"seedpacket_sunshroom.png", 7.5f, 25,    [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<Sunshroom>(i,c,s,n); },
+        frameFiles("sunshroom/init", 10, frameFiles("sunshroom/grownup", 10, frameFiles("sunshroom/sleep", 14)))}},
+    {PlantName::PEASHOOTER,   {"seedpacket_peashooter.png", 7.5f, 100,  [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<PeaShooter>(i,c,s,n); },
+        {"peashooter_spritesheet.png"}}},
+    {PlantName::REPEATER,     {"seedpacket_repeater.png", 7.5f, 200,    [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<Repeater>(i,c,s,n); },
+        {"repeater_spritesheet.png"}}},
+    {PlantName::THREEPEATER,  {"Threepeater_Seed_Packet_PC.png", 7.5f, 325, [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<ThreePeater>(i,c,s,n); },
+        {"threepeat_spritesheet.png"}}},
+    {PlantName::PUFFSHROOM,   {"seedpacket_puffshroom.png", 7.5f, 0,     [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<Puffshroom>(i,c,s,n); },
+        frameFiles("puffshroom/sleep", 17, frameFiles("puffshroom/init", 14))}},
+    {PlantName::WALLNUT,      {"seedpacket_wallnut.png", 30.0f, 50,    [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<Wallnut>(i,c,s,n); },
+        {"wallnut_spritesheet.png", "wallnut_cracked_spritesheet.png"}}},
+    {PlantName::CHERRYBOMB,   {"seedpacket_cherry_bomb.png", 50.0f, 150, [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<CherryBomb>(i,c,s,n); },
+        {"cherry_bomb_spritesheet.png", "explosion.png"}}},
+    {PlantName::SPIKEWEED,    {"seedpacket_spikeweed.png", 7.5f, 100,   [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<SpikeWeed>(i,c,s,n); },
+        {"spikeweed_spritesheet.png"}}},
+    {PlantName::JALAPENO,     {"seedpacket_jalapeno.png", 50.0f, 125,   [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<Jalapeno>(i,c,s,n); },
+        {"jalapeno_spritesheet.png", "fire_spritesheet.png"}}},
+    {PlantName::TWINSUNFLOWER,{"seedpacket_twinsunflower.png", 50.0f, 150, [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<TwinSunflower>(i,c,s,n); },
+        {"twinsunflower_spritesheet.png"}}},
+    {PlantName::GATLINGPEA,   {"seedpacket_gatlingpea.png", 50.0f, 250,  [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<GatlingPea>(i,c,s,n); },
+        {"gatlingpea_spritesheet.png"}}},
+    {PlantName::POTATOMINE,   {"seedpacket_potatoBomb.png", 30.0f, 25,   [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<PotatoMine>(i,c,s,n); },
+        frameFiles("potato_mine/ready", 8, {"potato_mine/arming.png", "potato_mine/triggered.png"})}},
+    {PlantName::SPIKEROCK,    {"seedpacket_spikerock.png", 50.0f, 125,  [](const std::string& i, float c, int s, PlantName n) {return SeedPacket::create<SpikeRock>(i,c,s,n); },
+        {"spikerock_first_spritesheet.png", "spikerock_second_spritesheet.png", "spikerock_third_spritesheet.png"}}}
 };
 
 SeedPacket* SeedPacket::createFromConfig(PlantName name) {
@@ -47,16 +74,17 @@ SeedPacket* SeedPacket::createFromConfig(PlantName name) {
 
 SeedPacket::SeedPacket()
     : cooldown_time(7.5f)
-    , accumulated_time(0.0f)
+    , timers(nullptr)
     , sun_cost(100)
     , is_on_cooldown(false)
 {
-    CCLOG("SeedPacket instance created.");
+    LOG_TRACE(LIFECYCLE, "SeedPacket instance created.");
 }
 
 SeedPacket::~SeedPacket()
 {
-    CCLOG("SeedPacket instance destroyed.");
+    if (timers) timers->cancel(cooldown);
+    LOG_TRACE(LIFECYCLE, "SeedPacket instance destroyed.");
 }
 
 bool SeedPacket::init()
@@ -71,58 +99,31 @@ bool SeedPacket::init()
     {
         if (!Sprite::initWithFile(seed_packet_image))
         {
-            CCLOG("Failed to load seed packet image: %s", seed_packet_image.c_str());
+            LOG_WARN(ASSETS, "Failed to load seed packet image: %s", seed_packet_image.c_str());
             return false;
         }
     }
     else
     {
-        CCLOG("Warning: seed_packet_image path is undefined.");
+        LOG_WARN(ASSETS, "Warning: seed_packet_image path is undefined.");
     }
 
     is_on_cooldown = false;
-    accumulated_time = 0.0f;
 
-    CCLOG("SeedPacket successfully initialized with asset: %s", seed_packet_image.c_str());
+    LOG_TRACE(LIFECYCLE, "SeedPacket successfully initialized with asset: %s", seed_packet_image.c_str());
     return true;
 }
 
-void SeedPacket::onEnter()
+void SeedPacket::updateState(int sunCount)
 {
-    Sprite::onEnter();
-    // Schedule the update loop once the node is attached to the scene
-    this->scheduleUpdate();
-}
-
-void SeedPacket::update(float delta)
-{
-    auto currentScene = Director::getInstance()->getRunningScene();
-    auto gameWorld = dynamic_cast<GameWorld*>(currentScene);
-
-    if (!gameWorld)
-    {
-        return;
-    }
-
     if (is_on_cooldown)
     {
-        accumulated_time += delta;
-
-        if (accumulated_time >= cooldown_time)
-        {
-            // Cooldown complete: reset state
-            is_on_cooldown = false;
-            accumulated_time = 0.0f;
-        }
-        else
-        {
-            updateCooldownEffect();
-        }
+        updateCooldownEffect();
     }
     else
     {
         // Visual feedback based on affordability
-        if (gameWorld->getSunCount() < sun_cost) {
+        if (sunCount < sun_cost) {
             // Affordability check: Gray out if not enough sun
             this->setColor(Color3B(128, 128, 128));
         }
@@ -138,10 +139,27 @@ bool SeedPacket::isReady() const
     return !is_on_cooldown;
 }
 
+void SeedPacket::setTimers(TimerWheel* newTimers)
+{
+    if (timers) timers->cancel(cooldown);
+    timers = newTimers;
+    is_on_cooldown = false;
+}
+
 void SeedPacket::startCooldown()
 {
+    if (!timers) return;
+
+    timers->cancel(cooldown);
+    cooldown = timers->schedule(cooldown_time, this);
     is_on_cooldown = true;
-    accumulated_time = 0.0f;
+}
+
+void SeedPacket::onTimer(int tag)
+{
+    // Cooldown complete: ready again
+    cooldown = TimerWheel::Handle();
+    is_on_cooldown = false;
 }
 
 int SeedPacket::getSunCost() const
@@ -152,7 +170,7 @@ int SeedPacket::getSunCost() const
 void SeedPacket::updateCooldownEffect()
 {
     // Linear progress from 0.0 to 1.0
-    float progress = accumulated_time / cooldown_time;
+    float progress = 1.0f - timers->getRemaining(cooldown) / cooldown_time;
 
     // Transition color from very dark (30, 30, 30) to half-brightness (128, 128, 128)
     // The card stays dimmed during the recovery phase
@@ -4,6 +4,7 @@
 #include "cocos2d.h"
 #include "GameObject.h"
 #include "GameDefs.h"
+#include "TimerWheel.h"
 #include <map>
 #include <string>
 
@@ -14,7 +15,7 @@ class Plant;
  * @brief SeedPacket base class for plant seed cards.
  * Manages cooldown timers, sun costs, and provides factory methods for plant creation.
  */
-class SeedPacket : public GameObject
+class SeedPacket : public GameObject, public TimerListener
 {
 public:
     /**
@@ -40,7 +41,6 @@ public:
                 sun_cost = sunCost;
                 plant_name = plantName;
                 is_on_cooldown = false;
-                accumulated_time = 0.0f;
             }
 
             virtual Plant* plantAt(const cocos2d::Vec2& globalPos) override
@@ -77,8 +77,18 @@ public:
     static SeedPacket* createFromConfig(PlantName name);
 
     virtual bool init() override;
-    virtual void onEnter() override;
-    virtual void update(float delta) override;
+
+    /**
+     * @brief Shades the packet by cooldown progress, or grays it out when it is not affordable.
+     * Called by GameWorld once per frame; packets are not scheduled themselves.
+     */
+    void updateState(int sunCount);
+
+    /** @brief Sets the wheel that times the cooldown; without one the packet never cools down */
+    void setTimers(TimerWheel* timers);
+
+    /** @brief Cooldown finished */
+    virtual void onTimer(int tag) override;
 
     /** @brief Returns true if the packet is ready for use (not on cooldown) */
     bool isReady() const;
@@ -109,7 +119,8 @@ private:
     // Member variables
     // ----------------------------------------------------
     float cooldown_time;      // Total required cooldown duration
-    float accumulated_time;   // Current elapsed cooldown time
+    TimerWheel* timers;       // Clock of the level the packet belongs to
+    TimerWheel::Handle cooldown;  // Pending while cooling down
     int sun_cost;             // Required sun resource
     bool is_on_cooldown;      // Cooldown state flag
     PlantName plant_name;     // Associated plant type
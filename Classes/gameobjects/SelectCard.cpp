@@ -1,5 +1,5 @@
 #include "SelectCard.h"
-#include "SeedPacket.h"
+#include "SpriteAtlas.h"
 
 USING_NS_CC;
 
@@ -10,7 +10,6 @@ USING_NS_CC;
 SelectCard::SelectCard()
     : is_selected(false)
     , plant_name(PlantName::SUNFLOWER)
-    , seed_packet(nullptr)
 {
     // Member variables are initialized in the list above
 }
@@ -24,16 +23,16 @@ SelectCard::~SelectCard()
 // Factory Method
 // ---------------------------------------------------------
 
-SelectCard* SelectCard::create(const std::string& imageFile, PlantName plantName, SeedPacket* seedPacket)
+SelectCard* SelectCard::create(const std::string& imageFile, PlantName plantName)
 {
     SelectCard* ret = new (std::nothrow) SelectCard();
 
-    // Initialize the sprite with the provided image file
-    if (ret && ret->initWithFile(imageFile))
+    // Initialize the sprite from the packed frame, or the loose image file without atlases
+    auto frame = SpriteAtlas::getInstance()->createImageFrame(imageFile);
+    if (ret && frame && ret->initWithSpriteFrame(frame))
     {
         ret->image_file = imageFile;
         ret->plant_name = plantName;
-        ret->seed_packet = seedPacket;
 
         // Add to the autorelease pool for automatic memory management
         ret->autorelease();
@@ -3,24 +3,23 @@
 
 #include "cocos2d.h"
 #include "GameDefs.h"
-#include "SeedPacket.h"
 
 /**
  * @brief Represents a plant card in the "Choose Your Seeds" menu.
  * This class handles the visual state (selected vs unselected) during
- * the card selection phase before the game starts.
+ * the card selection phase before the game starts. It is only a picture of the packet:
+ * the functional SeedPacket is built by GameWorld for the chosen plants.
  */
 class SelectCard : public cocos2d::Sprite
 {
 public:
     /**
      * @brief Static factory method to create a SelectCard instance.
-     * @param imageFile Path to the card texture.
+     * @param imageFile Path to the card texture (taken from the packed atlas when there is one).
      * @param plantName The associated plant type identifier.
-     * @param seedPacket Pointer to the corresponding SeedPacket object.
      * @return Pointer to the created SelectCard object.
      */
-    static SelectCard* create(const std::string& imageFile, PlantName plantName, SeedPacket* seedPacket);
+    static SelectCard* create(const std::string& imageFile, PlantName plantName);
 
     /** @brief Returns true if the card is already picked for the current level. */
     bool isSelected() const { return is_selected; }
@@ -33,9 +32,6 @@ public:
     /** @brief Gets the plant name identifier associated with this card. */
     PlantName getPlantName() const { return plant_name; }
 
-    /** @brief Gets the pointer to the seed packet data. */
-    SeedPacket* getSeedPacket() const { return seed_packet; }
-
     /** @brief Gets the texture filename of the card. */
     const std::string& getImageFile() const { return image_file; }
 
@@ -45,7 +41,6 @@ private:
 
     bool is_selected;           // Selection state flag
     PlantName plant_name;       // Type of plant this card represents
-    SeedPacket* seed_packet;    // Reference to the functional seed packet
     std::string image_file;     // Texture path storage
 };
 
@@ -1,4 +1,5 @@
 #include "Shovel.h"
+#include "Log.h"
 
 USING_NS_CC;
 
@@ -14,13 +15,13 @@ Shovel::Shovel()
     : is_dragging(false)
     , original_position(Vec2::ZERO)
 {
-    CCLOG("Shovel instance created.");
+    LOG_TRACE(LIFECYCLE, "Shovel instance created.");
 }
 
 // Destructor
 Shovel::~Shovel()
 {
-    CCLOG("Shovel instance destroyed.");
+    LOG_TRACE(LIFECYCLE, "Shovel instance destroyed.");
 }
 
 // Initialization logic
@@ -34,7 +35,7 @@ bool Shovel::init()
     // Load the shovel texture
     if (!Sprite::initWithFile(IMAGE_FILENAME))
     {
-        CCLOG("Critical Error: Failed to load shovel image: %s", IMAGE_FILENAME.c_str());
+        LOG_WARN(ASSETS, "Critical Error: Failed to load shovel image: %s", IMAGE_FILENAME.c_str());
         return false;
     }
 
@@ -46,7 +47,7 @@ bool Shovel::init()
 
     is_dragging = false;
 
-    CCLOG("Shovel successfully initialized.");
+    LOG_TRACE(LIFECYCLE, "Shovel successfully initialized.");
     return true;
 }
 
@@ -0,0 +1,184 @@
+#include "SpriteAtlas.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+namespace
+{
+    // Written by tools/atlas/pack_atlases.py
+    const std::string INDEX_FILE = "atlas/index.plist";
+    const int INDEX_VERSION = 1;
+}
+
+SpriteAtlas* SpriteAtlas::instance = nullptr;
+
+SpriteAtlas* SpriteAtlas::getInstance()
+{
+    if (!instance)
+    {
+        instance = new (std::nothrow) SpriteAtlas();
+    }
+    return instance;
+}
+
+SpriteAtlas::SpriteAtlas()
+{
+}
+
+void SpriteAtlas::loadIndex()
+{
+    auto fileUtils = FileUtils::getInstance();
+    if (!fileUtils->isFileExist(INDEX_FILE))
+    {
+        CCLOG("SpriteAtlas: %s not found, using loose images.", INDEX_FILE.c_str());
+        return;
+    }
+
+    ValueMap index = fileUtils->getValueMapFromFile(INDEX_FILE);
+    if (index["version"].asInt() != INDEX_VERSION)
+    {
+        CCLOG("SpriteAtlas: %s has an unknown version, using loose images.", INDEX_FILE.c_str());
+        return;
+    }
+
+    for (auto& entry : index["atlases"].asValueMap())
+    {
+        atlas_textures[entry.first] = entry.second.asString();
+    }
+    for (auto& entry : index["sources"].asValueMap())
+    {
+        auto& plists = sources[entry.first];
+        for (auto& plist : entry.second.asValueVector())
+        {
+            plists.push_back(plist.asString());
+        }
+    }
+    CCLOG("SpriteAtlas: %d atlas pages covering %d source files.",
+        static_cast<int>(atlas_textures.size()), static_cast<int>(sources.size()));
+}
+
+std::vector<std::string> SpriteAtlas::getTextureFiles(const std::string& file) const
+{
+    auto it = sources.find(file);
+    if (it == sources.end())
+    {
+        return std::vector<std::string>(1, file);
+    }
+
+    std::vector<std::string> textures;
+    for (const auto& plist : it->second)
+    {
+        auto texture = atlas_textures.find(plist);
+        if (texture != atlas_textures.end())
+        {
+            textures.push_back(texture->second);
+        }
+    }
+    return textures;
+}
+
+std::string SpriteAtlas::cellName(const std::string& sheet, int index)
+{
+    return sheet + "#" + std::to_string(index);
+}
+
+bool SpriteAtlas::ensureRegistered(const std::string& file)
+{
+    auto it = sources.find(file);
+    if (it == sources.end())
+    {
+        return false;
+    }
+
+    for (const auto& plist : it->second)
+    {
+        if (registered.insert(plist).second)
+        {
+            // Loads the page texture too, unless AssetPreloader already decoded it
+            SpriteFrameCache::getInstance()->addSpriteFramesWithFile(plist);
+        }
+    }
+    return true;
+}
+
+SpriteFrame* SpriteAtlas::findCellFrame(const std::string& sheet, int index)
+{
+    if (!ensureRegistered(sheet))
+    {
+        return nullptr;
+    }
+    return SpriteFrameCache::getInstance()->getSpriteFrameByName(cellName(sheet, index));
+}
+
+SpriteFrame* SpriteAtlas::findImageFrame(const std::string& file, const Rect& rect)
+{
+    if (!ensureRegistered(file))
+    {
+        return nullptr;
+    }
+
+    auto frame = SpriteFrameCache::getInstance()->getSpriteFrameByName(file);
+    if (!frame)
+    {
+        return nullptr;
+    }
+
+    const Size& original = frame->getOriginalSize();
+    bool wholeImage = rect.size.width <= 0.0f || rect.size.height <= 0.0f
+        || rect.equals(Rect(0.0f, 0.0f, original.width, original.height));
+    if (wholeImage)
+    {
+        return frame;
+    }
+    if (frame->isRotated())
+    {
+        return nullptr;
+    }
+
+    // Where the trimmed pixels sit inside the original image
+    const Rect& packed = frame->getRect();
+    const Vec2& offset = frame->getOffset();
+    float trimX = (original.width - packed.size.width) * 0.5f + offset.x;
+    float trimY = (original.height - packed.size.height) * 0.5f - offset.y;
+
+    float left = std::max(rect.getMinX(), trimX);
+    float right = std::min(rect.getMaxX(), trimX + packed.size.width);
+    float top = std::max(rect.getMinY(), trimY);
+    float bottom = std::min(rect.getMaxY(), trimY + packed.size.height);
+    if (right <= left || bottom <= top)
+    {
+        // Only transparent pixels requested; let the caller use the loose file
+        return nullptr;
+    }
+
+    Rect part(packed.origin.x + left - trimX, packed.origin.y + top - trimY, right - left, bottom - top);
+    Vec2 partOffset((left + right) * 0.5f - rect.getMidX(), rect.getMidY() - (top + bottom) * 0.5f);
+    return SpriteFrame::createWithTexture(frame->getTexture(), part, false, partOffset, rect.size);
+}
+
+SpriteFrame* SpriteAtlas::createCellFrame(const std::string& sheet, int index, const Rect& rect)
+{
+    auto frame = findCellFrame(sheet, index);
+    return frame ? frame : SpriteFrame::create(sheet, rect);
+}
+
+SpriteFrame* SpriteAtlas::createImageFrame(const std::string& file, const Rect& rect)
+{
+    auto frame = findImageFrame(file, rect);
+    if (frame)
+    {
+        return frame;
+    }
+
+    if (rect.size.width > 0.0f && rect.size.height > 0.0f)
+    {
+        return SpriteFrame::create(file, rect);
+    }
+
+    auto texture = Director::getInstance()->getTextureCache()->addImage(file);
+    if (!texture)
+    {
+        return nullptr;
+    }
+    return SpriteFrame::createWithTexture(texture, Rect(Vec2::ZERO, texture->getContentSize()));
+}
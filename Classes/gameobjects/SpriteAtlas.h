@@ -0,0 +1,65 @@
+#pragma once
+
+#include "cocos2d.h"
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief Resolves sprite frames through the atlases built by tools/atlas/pack_atlases.py.
+ *
+ * The packer trims and packs grid sheet cells and loose frame images into power-of-two pages
+ * and writes atlas/index.plist. An atlas page is registered with SpriteFrameCache the first
+ * time one of its source files is asked for. Without an index (atlases not built) every
+ * lookup falls back to the loose file, so callers never need to know which build they run.
+ *
+ * All rects are in points with a top-left origin, like SpriteFrame::create(file, rect).
+ */
+class SpriteAtlas
+{
+public:
+    /** @brief Access the global atlas registry. */
+    static SpriteAtlas* getInstance();
+
+    SpriteAtlas(const SpriteAtlas&) = delete;
+    SpriteAtlas& operator=(const SpriteAtlas&) = delete;
+
+    /** @brief Reads atlas/index.plist; a missing index keeps every lookup on loose files */
+    void loadIndex();
+
+    /** @brief True if file was packed into an atlas */
+    bool isPacked(const std::string& file) const { return sources.count(file) > 0; }
+
+    /** @brief Textures to load for file: its atlas pages if packed, otherwise the file itself */
+    std::vector<std::string> getTextureFiles(const std::string& file) const;
+
+    /** @brief Name the packer gives cell index of a grid sheet */
+    static std::string cellName(const std::string& sheet, int index);
+
+    /** @brief Packed cell of a grid sheet, or nullptr if the sheet is not packed */
+    cocos2d::SpriteFrame* findCellFrame(const std::string& sheet, int index);
+
+    /**
+     * @brief Packed part of a loose image, or nullptr if the image is not packed.
+     * @param rect Part of the original image; an empty rect selects the whole image.
+     */
+    cocos2d::SpriteFrame* findImageFrame(const std::string& file, const cocos2d::Rect& rect = cocos2d::Rect::ZERO);
+
+    /** @brief Cell from the atlas, or rect of the loose sheet */
+    cocos2d::SpriteFrame* createCellFrame(const std::string& sheet, int index, const cocos2d::Rect& rect);
+
+    /** @brief Part of an image from the atlas, or from the loose file (empty rect = whole image) */
+    cocos2d::SpriteFrame* createImageFrame(const std::string& file, const cocos2d::Rect& rect = cocos2d::Rect::ZERO);
+
+private:
+    SpriteAtlas();
+    static SpriteAtlas* instance;
+
+    /** @brief Registers the atlas pages holding file's frames; false if it is not packed */
+    bool ensureRegistered(const std::string& file);
+
+    std::unordered_map<std::string, std::string> atlas_textures;             // plist -> page texture
+    std::unordered_map<std::string, std::vector<std::string>> sources;       // source file -> plists
+    std::unordered_set<std::string> registered;                              // plists added to SpriteFrameCache
+};
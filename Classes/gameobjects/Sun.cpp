@@ -1,4 +1,6 @@
 #include "Sun.h"
+#include "Log.h"
+#include "RandomService.h"
 
 USING_NS_CC;
 
@@ -18,17 +20,19 @@ Sun::Sun()
     : is_collected(false)
     , is_collecting(false)
     , is_falling(false)
-    , life_time(0.0f)
+    , is_expired(false)
+    , timers(nullptr)
     , target_pos(Vec2::ZERO)
     , sun_scale(1.0f)
     , sun_value(SUN_VALUE)
 {
-    CCLOG("Sun instance created.");
+    LOG_TRACE(LIFECYCLE, "Sun instance created.");
 }
 
 Sun::~Sun()
 {
-    CCLOG("Sun instance destroyed.");
+    if (timers) timers->cancel(lifetime);
+    LOG_TRACE(LIFECYCLE, "Sun instance destroyed.");
 }
 
 bool Sun::init()
@@ -39,19 +43,18 @@ bool Sun::init()
     }
 
     // Initialize with first frame of the spritesheet (100x100 pixels)
-    if (!Sprite::initWithFile(IMAGE_FILENAME, Rect(0, 0, 100, 100)))
+    if (!initWithAtlasFile(IMAGE_FILENAME, Rect(0, 0, 100, 100)))
     {
-        CCLOG("Error: Failed to load sun spritesheet: %s", IMAGE_FILENAME.c_str());
+        LOG_WARN(ASSETS, "Error: Failed to load sun spritesheet: %s", IMAGE_FILENAME.c_str());
         return false;
     }
 
     this->setScale(sun_scale);
     is_collected = false;
-    life_time = 0.0f;
+    is_expired = false;
 
-    // Start rotation animation and enable per-frame updates
+    // Start rotation animation; GameWorld drives the per-frame update
     setAnimation();
-    this->scheduleUpdate();
 
     return true;
 }
@@ -92,7 +95,7 @@ Sun* Sun::createFromSky(int targetGridCol, float startY)
     {
         // Randomly determine which row the sun will stop falling at
         float targetX = GRID_ORIGIN.x + targetGridCol * CELLSIZE.width + CELLSIZE.width * 0.5f;
-        int randomRow = rand() % MAX_ROW;
+        int randomRow = RandomService::getInstance()->get(RandomStreamId::SKY_SUN).below(MAX_ROW);
         float targetY = GRID_ORIGIN.y + randomRow * CELLSIZE.height + CELLSIZE.height * 0.5f;
 
         sun->target_pos = Vec2(targetX, targetY);
@@ -128,11 +131,28 @@ void Sun::update(float delta)
             }
             this->setPositionY(newY);
         }
-        return;
+
+        // Landed: the lifetime window opens now
+        if (!is_falling && timers)
+        {
+            lifetime = timers->schedule(LIFETIME, this);
+        }
+    }
+}
+
+void Sun::startLifetime(TimerWheel* newTimers)
+{
+    timers = newTimers;
+    if (!is_falling)
+    {
+        lifetime = timers->schedule(LIFETIME, this);
     }
+}
 
-    // Expire if not collected within the lifetime window
-    life_time += delta;
+void Sun::onTimer(int tag)
+{
+    lifetime = TimerWheel::Handle();
+    is_expired = true;
 }
 
 bool Sun::isCollectible() const
@@ -150,6 +170,9 @@ void Sun::collect(const std::function<void(int)>& onfinish)
     this->is_falling = false;
     this->is_collecting = true;
 
+    // A sun being collected no longer expires
+    if (timers) timers->cancel(lifetime);
+
     // Animation sequence: Fly to UI sun counter (95, 675) then disappear
     auto moveToBank = MoveTo::create(0.8f, Vec2(95, 675));
     auto fadeOut = FadeOut::create(0.2f);
@@ -168,12 +191,12 @@ void Sun::collect(const std::function<void(int)>& onfinish)
     auto sequence = Sequence::create(moveToBank, fadeOut, addResource, markDone, nullptr);
     this->runAction(sequence);
 
-    CCLOG("Sun collection triggered. Value: %d", sun_value);
+    LOG_DEBUG(ECONOMY, "Sun collection triggered. Value: %d", sun_value);
 }
 
 bool Sun::shouldRemove() const
 {
-    return is_collected || (life_time >= LIFETIME);
+    return is_collected || is_expired;
 }
 
 void Sun::setAnimation()
@@ -4,12 +4,13 @@
 #include "cocos2d.h"
 #include "GameObject.h"
 #include "GameDefs.h"
+#include "TimerWheel.h"
 
 /**
  * @brief Represents the primary resource in the game.
  * Suns can fall from the sky or be produced by specific plants like Sunflowers.
  */
-class Sun : public GameObject
+class Sun : public GameObject, public TimerListener
 {
 public:
     /**
@@ -45,10 +46,19 @@ public:
     static Sun* createFromSky(int targetGridCol, float startY);
 
     /**
-     * @brief Per-frame logic for falling movement and lifetime tracking.
+     * @brief Per-frame falling movement, called by GameWorld. Landed suns do nothing here.
      */
     virtual void update(float delta) override;
 
+    /**
+     * @brief Starts the lifetime on timers once the sun rests on the lawn (right away unless falling).
+     * Called by GameWorld when the sun is added.
+     */
+    void startLifetime(TimerWheel* timers);
+
+    /** @brief Lifetime ran out before the sun was collected */
+    virtual void onTimer(int tag) override;
+
     /**
      * @brief Checks if the sun is currently interactive.
      * @return true if it can be clicked, false if already being collected.
@@ -90,7 +100,9 @@ private:
     bool is_collected;        // Flag for finished collection sequence
     bool is_collecting;       // Flag for active collection animation
     bool is_falling;          // Flag for sky-to-ground movement
-    float life_time;          // Timer tracking duration on field
+    bool is_expired;          // Lifetime ran out on the field
+    TimerWheel* timers;       // Clock of the level, set by startLifetime
+    TimerWheel::Handle lifetime;  // Pending while the sun waits on the field
     cocos2d::Vec2 target_pos; // Landing coordinates for sky suns
     float sun_scale;          // Custom size multiplier
     int sun_value;            // Resource points awarded for this instance
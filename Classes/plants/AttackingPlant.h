@@ -2,6 +2,7 @@
 #define __ATTACKING_PLANT_H__
 
 #include "Plant.h"
+#include "LaneIndex.h"
 #include <vector>
 
 // Forward declarations
@@ -22,14 +23,16 @@ public:
      */
     virtual PlantCategory getCategory() const override { return PlantCategory::ATTACKING; }
 
+    virtual AttackingPlant* asAttacker() override { return this; }
+
     /**
      * @brief Pure virtual function to handle the plant's unique attack logic.
      * Called by GameWorld to determine if a plant should fire or strike.
-     * @param allZombiesInRow Array of zombie vectors, one for each game row.
+     * @param lanes Per-row zombie index of the current frame.
      * @param plantRow The current row index (0-4) this plant occupies.
      * @return A vector of created Bullet pointers (can be empty if no attack occurs).
      */
-    virtual std::vector<Bullet*> checkAndAttack(std::vector<Zombie*> allZombiesInRow[MAX_ROW], int plantRow) = 0;
+    virtual std::vector<Bullet*> checkAndAttack(const LaneIndex& lanes, int plantRow) = 0;
 
 protected:
     AttackingPlant() : Plant() {}
@@ -37,19 +40,19 @@ protected:
 
     /**
      * @brief Detects if there is a valid target ahead of the plant in its own row.
-     * @param zombiesInRow The vector of zombies occupying the same row.
+     * @param lanes Per-row zombie index of the current frame.
+     * @param row The row to scan (normally the plant's own row).
      * @return true if a live zombie is found to the right of the plant.
      */
-    bool isZombieInRange(const std::vector<Zombie*>& zombiesInRow);
+    bool isZombieInRange(const LaneIndex& lanes, int row);
 
     /**
      * @brief Detects targets across multiple rows (e.g., for Threepeater).
-     * @param allZombiesInRow Global array of zombie vectors.
+     * @param lanes Per-row zombie index of the current frame.
      * @param rowsToCheck List of row indices to scan for targets.
      * @return true if at least one live zombie is found in any of the specified rows.
      */
-    bool isZombieInRangeMultiRow(std::vector<Zombie*> allZombiesInRow[MAX_ROW],
-        const std::vector<int>& rowsToCheck);
+    bool isZombieInRangeMultiRow(const LaneIndex& lanes, const std::vector<int>& rowsToCheck);
 };
 
 #endif // __ATTACKING_PLANT_H__
\ No newline at end of file
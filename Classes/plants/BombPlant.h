@@ -2,6 +2,7 @@
 #define __BOMB_PLANT_H__
 
 #include "Plant.h"
+#include "LaneIndex.h"
 #include <vector>
 
 // Forward declaration
@@ -21,6 +22,8 @@ public:
      */
     virtual PlantCategory getCategory() const override { return PlantCategory::BOMB; }
 
+    virtual BombPlant* asBomb() override { return this; }
+
     /**
      * @brief Checks if the bomb has already triggered its explosion logic.
      */
@@ -29,11 +32,11 @@ public:
     /**
      * @brief Pure virtual function to execute the explosion.
      * Must be implemented by subclasses to handle specific damage values and effects.
-     * @param allZombiesInRow Global array of zombie vectors.
+     * @param lanes Per-row zombie index of the current frame.
      * @param plantRow The row coordinate of the explosion center.
      * @param plantCol The column coordinate of the explosion center.
      */
-    virtual void explode(std::vector<Zombie*> allZombiesInRow[5], int plantRow, int plantCol) = 0;
+    virtual void explode(const LaneIndex& lanes, int plantRow, int plantCol) = 0;
 
 protected:
     BombPlant() : Plant(), has_exploded(false), animation_finished(false) {}
@@ -51,12 +54,12 @@ protected:
 
     /**
      * @brief Helper method to identify which zombies are inside the blast zone.
-     * @param allZombiesInRow Global array of zombie vectors.
+     * @param lanes Per-row zombie index of the current frame.
      * @param centerRow Grid row of the explosion.
      * @param centerCol Grid column of the explosion.
      * @return A vector containing pointers to all affected live zombies.
      */
-    std::vector<Zombie*> getZombiesInRange(std::vector<Zombie*> allZombiesInRow[5], int centerRow, int centerCol);
+    std::vector<Zombie*> getZombiesInRange(const LaneIndex& lanes, int centerRow, int centerCol);
 };
 
 #endif // __BOMB_PLANT_H__
\ No newline at end of file
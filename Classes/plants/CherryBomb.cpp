@@ -1,7 +1,8 @@
 #include "CherryBomb.h"
+#include "Log.h"
 #include "Zombie.h"
 #include "Sun.h"
-#include "audio/include/AudioEngine.h"
+#include "SoundManager.h"
 
 USING_NS_CC;
 
@@ -32,7 +33,7 @@ bool CherryBomb::init()
 {
     if (!BombPlant::init()) return false;
 
-    if (!Sprite::initWithFile(IMAGE_FILENAME, INITIAL_PIC_RECT)) return false;
+    if (!initWithAtlasFile(IMAGE_FILENAME, INITIAL_PIC_RECT)) return false;
 
     // CherryBombs have high health to prevent being eaten during their short arming time
     max_health = 1000;
@@ -42,7 +43,6 @@ bool CherryBomb::init()
     idle_animation_duration = 0.0f;
 
     this->setAnimation();
-    this->scheduleUpdate();
 
     return true;
 }
@@ -81,18 +81,18 @@ void CherryBomb::update(float delta)
     if (!animation_finished && accumulated_time >= idle_animation_duration)
     {
         animation_finished = true;
-        CCLOG("CherryBomb is armed and ready.");
+        LOG_TRACE(COMBAT, "CherryBomb is armed and ready.");
     }
 }
 
-void CherryBomb::explode(std::vector<Zombie*> allZombiesInRow[5], int plantRow, int plantCol)
+void CherryBomb::explode(const LaneIndex& lanes, int plantRow, int plantCol)
 {
     if (has_exploded || !animation_finished) return;
 
     has_exploded = true;
 
     // Detect all zombies within a 3x3 grid centered on this plant
-    std::vector<Zombie*> zombiesInRange = getZombiesInRange(allZombiesInRow, plantRow, plantCol);
+    std::vector<Zombie*> zombiesInRange = getZombiesInRange(lanes, plantRow, plantCol);
 
     for (auto zombie : zombiesInRange)
     {
@@ -124,7 +124,7 @@ void CherryBomb::playExplosionAnimation()
 
         auto fadeOut = FadeOut::create(0.5f);
         auto removePlant = CallFunc::create([this]() {
-            this->is_dead = true; // Mark plant for cleanup in the next update cycle
+            this->markDead(); // Mark plant for cleanup in the next update cycle
             });
         auto removeSprite = RemoveSelf::create();
 
@@ -133,9 +133,9 @@ void CherryBomb::playExplosionAnimation()
     }
     else
     {
-        this->is_dead = true;
+        this->markDead();
     }
 
     // Audio feedback
-    cocos2d::AudioEngine::play2d("cherrybomb.mp3", false);
+    SoundManager::getInstance()->post("cherrybomb.mp3", SoundPriority::HIGH);
 }
\ No newline at end of file
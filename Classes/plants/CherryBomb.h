@@ -36,11 +36,11 @@ public:
 
     /**
      * @brief Triggers the damage logic and explosion visuals.
-     * @param allZombiesInRow Array of zombie vectors used to calculate hits.
+     * @param lanes Per-row zombie index used to calculate hits.
      * @param plantRow The grid row of this plant.
      * @param plantCol The grid column of this plant.
      */
-    virtual void explode(std::vector<Zombie*> allZombiesInRow[5], int plantRow, int plantCol) override;
+    virtual void explode(const LaneIndex& lanes, int plantRow, int plantCol) override;
 
 private:
     // ----------------------------------------------------
@@ -1,5 +1,7 @@
 #include "GatlingPea.h"
+#include "Log.h"
 #include "Bullet.h"
+#include "BulletPool.h"
 
 USING_NS_CC;
 
@@ -13,7 +15,7 @@ const cocos2d::Size GatlingPea::OBJECT_SIZE = Size(85.333f, 128.0f);
 // Protected constructor
 GatlingPea::GatlingPea()
 {
-    CCLOG("GatlingPea created.");
+    LOG_TRACE(LIFECYCLE, "GatlingPea created.");
 }
 
 // ------------------------------------------------------------------------
@@ -58,12 +60,12 @@ void GatlingPea::update(float delta)
 }
 
 
-std::vector<Bullet*> GatlingPea::checkAndAttack(std::vector<Zombie*> allZombiesInRow[MAX_ROW], int plantRow)
+std::vector<Bullet*> GatlingPea::checkAndAttack(const LaneIndex& lanes, int plantRow)
 {
     std::vector<Bullet*> bullets;
 
     // Check if any zombie is in range in current row and cooldown is ready
-    if (!isZombieInRange(allZombiesInRow[plantRow]) || accumulated_time < cooldown_interval)
+    if (!isZombieInRange(lanes, plantRow) || accumulated_time < cooldown_interval)
     {
         return bullets;
     }
@@ -74,14 +76,14 @@ std::vector<Bullet*> GatlingPea::checkAndAttack(std::vector<Zombie*> allZombiesI
     std::vector<Vec2>spawnPos(4);
     for (int i = 0; i < 4; ++i) {
         spawnPos[i] = this->getPosition() + Vec2(30.0f, 20.0f) + static_cast<float>(i) * Vec2(20.0f, 0.0f);
-        pea[i] = Pea::create(spawnPos[i]);
+        pea[i] = BulletPool::getInstance()->acquirePea(spawnPos[i]);
         if (pea[i])
             bullets.push_back(pea[i]);
     }
 
     if (!bullets.empty())
     {
-        CCLOG("GatlingPea fired %d peas", static_cast<int>(bullets.size()));
+        LOG_TRACE(COMBAT, "GatlingPea fired %d peas", static_cast<int>(bullets.size()));
     }
 
     return bullets;
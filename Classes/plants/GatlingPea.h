@@ -47,7 +47,7 @@ public:
         return false; 
     }
 
-    virtual std::vector<Bullet*> checkAndAttack(std::vector<Zombie*> allZombiesInRow[MAX_ROW], int plantRow) override;
+    virtual std::vector<Bullet*> checkAndAttack(const LaneIndex& lanes, int plantRow) override;
 
 private:
     // ----------------------------------------------------
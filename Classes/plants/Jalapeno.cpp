@@ -1,8 +1,9 @@
 #include "Jalapeno.h"
+#include "Log.h"
 #include "Zombie.h"
 #include "Sun.h"
 #include "GameWorld.h"
-#include "audio/include/AudioEngine.h"
+#include "SoundManager.h"
 
 USING_NS_CC;
 
@@ -24,7 +25,7 @@ Jalapeno::Jalapeno()
 {
     explosion_damage = EXPLOSION_DAMAGE;
     explosion_radius = EXPLOSION_RADIUS;
-    CCLOG("Jalapeno created.");
+    LOG_TRACE(LIFECYCLE, "Jalapeno created.");
 }
 
 // ------------------------------------------------------------------------
@@ -34,13 +35,13 @@ bool Jalapeno::init()
 {
     if (!BombPlant::init())
     {
-        CCLOG("BombPlant::init() failed!");
+        LOG_WARN(ASSETS, "BombPlant::init() failed!");
         return false;
     }
 
-    if (!Sprite::initWithFile(IMAGE_FILENAME, INITIAL_PIC_RECT))
+    if (!initWithAtlasFile(IMAGE_FILENAME, INITIAL_PIC_RECT))
     {
-        CCLOG("Sprite::initWithFile failed! Check if %s exists.", IMAGE_FILENAME.c_str());
+        LOG_WARN(ASSETS, "Sprite::initWithFile failed! Check if %s exists.", IMAGE_FILENAME.c_str());
         return false;
     }
 
@@ -51,7 +52,6 @@ bool Jalapeno::init()
     idle_animation_duration = 0.0f;
 
     this->setAnimation();
-    this->scheduleUpdate();
 
     return true;
 }
@@ -95,14 +95,14 @@ void Jalapeno::update(float delta)
     if (!animation_finished && accumulated_time >= idle_animation_duration)
     {
         animation_finished = true;
-        CCLOG("Jalapeno idle animation finished, ready to explode!");
+        LOG_TRACE(COMBAT, "Jalapeno idle animation finished, ready to explode!");
     }
 }
 
 // ------------------------------------------------------------------------
 // 5. Explode function
 // ------------------------------------------------------------------------
-void Jalapeno::explode(std::vector<Zombie*> allZombiesInRow[5], int plantRow, int plantCol)
+void Jalapeno::explode(const LaneIndex& lanes, int plantRow, int plantCol)
 {
     if (has_exploded)
     {
@@ -116,8 +116,9 @@ void Jalapeno::explode(std::vector<Zombie*> allZombiesInRow[5], int plantRow, in
 
     has_exploded = true;
 
-    // Get zombies in explosion range (3x3 grid)
-    std::vector<Zombie*> zombiesInRange = allZombiesInRow[plantRow];
+    // Get every zombie in the row
+    std::vector<Zombie*> zombiesInRange;
+    lanes.queryRange(plantRow, plantRow, -FLT_MAX, FLT_MAX, zombiesInRange);
 
     // Deal damage to all zombies in range
     // Note: zombiesInRange is a local copy, so range-for is safe here
@@ -127,14 +128,14 @@ void Jalapeno::explode(std::vector<Zombie*> allZombiesInRow[5], int plantRow, in
         if (zombie && !zombie->isDead())
         {
             zombie->takeDamage(static_cast<float>(explosion_damage));
-            CCLOG("Jalapeno dealt %d damage to zombie!", explosion_damage);
+            LOG_TRACE(COMBAT, "Jalapeno dealt %d damage to zombie!", explosion_damage);
         }
     }
 
     // Play explosion animation
     playExplosionAnimation();
 
-    auto gameWorld = static_cast<GameWorld*>(this->getParent());
+    auto gameWorld = static_cast<GameWorld*>(this->getScene());
     if (!gameWorld) return;
 
     gameWorld->removeIceInRow(plantRow);
@@ -146,7 +147,7 @@ void Jalapeno::explode(std::vector<Zombie*> allZombiesInRow[5], int plantRow, in
 void Jalapeno::playExplosionAnimation()
 {
     this->stopAllActions();
-    cocos2d::AudioEngine::play2d("Jalapeno.mp3", false, 1.0f);
+    SoundManager::getInstance()->post("Jalapeno.mp3", SoundPriority::HIGH);
     auto explosionSprite = Sprite::create("fire_spritesheet.png");
     if (explosionSprite)
     {
@@ -178,10 +179,10 @@ void Jalapeno::playExplosionAnimation()
         }
         else
             explosionSprite->runAction(RemoveSelf::create());
-        this->is_dead = true;
+        this->markDead();
     }
     else
-        this->is_dead = true;
+        this->markDead();
 
-    CCLOG("Jalapeno explosion animation played!");
+    LOG_TRACE(COMBAT, "Jalapeno explosion animation played!");
 }
@@ -30,11 +30,11 @@ public:
 
     /**
      * @brief Trigger explosion
-     * @param allZombiesInRow All zombies in each row
+     * @param lanes Per-row zombie index of the current frame
      * @param plantRow The row this plant is in
      * @param plantCol The column this plant is in
      */
-    virtual void explode(std::vector<Zombie*> allZombiesInRow[5], int plantRow, int plantCol) override;
+    virtual void explode(const LaneIndex& lanes, int plantRow, int plantCol) override;
 
 private:
     // ----------------------------------------------------
@@ -1,4 +1,6 @@
 #include "Mushroom.h"
+#include "Log.h"
+#include "SpriteAtlas.h"
 
 USING_NS_CC;
 
@@ -36,13 +38,13 @@ bool Mushroom::checkDayNightChange()
         if (!is_initialized)
         {
             is_initialized = true;
-            CCLOG("Mushroom logic synchronized. Mode: %s", is_night_mode ? "NIGHT" : "DAY");
+            LOG_DEBUG(GENERAL, "Mushroom logic synchronized. Mode: %s", is_night_mode ? "NIGHT" : "DAY");
             return true;
         }
 
         if (changed)
         {
-            CCLOG("Mushroom environment shifted to: %s", is_night_mode ? "NIGHT" : "DAY");
+            LOG_DEBUG(GENERAL, "Mushroom environment shifted to: %s", is_night_mode ? "NIGHT" : "DAY");
         }
 
         return changed;
@@ -66,7 +68,7 @@ Animation* Mushroom::loadAnimation(const std::string& folderPath, int frameCount
         // Expects file naming convention: "folder/1 (1).png", "folder/1 (2).png", etc.
         std::string filename = StringUtils::format("%s/1 (%d).png", folderPath.c_str(), i);
 
-        auto frame = SpriteFrame::create(filename, Rect(offsetX, offsetY, actualCropW, actualCropH));
+        auto frame = SpriteAtlas::getInstance()->createImageFrame(filename, Rect(offsetX, offsetY, actualCropW, actualCropH));
 
         if (frame)
         {
@@ -74,7 +76,7 @@ Animation* Mushroom::loadAnimation(const std::string& folderPath, int frameCount
         }
         else
         {
-            CCLOG("Warning: Mushroom failed to load animation frame: %s", filename.c_str());
+            LOG_WARN(ASSETS, "Warning: Mushroom failed to load animation frame: %s", filename.c_str());
         }
     }
 
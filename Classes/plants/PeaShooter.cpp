@@ -1,4 +1,6 @@
 #include "PeaShooter.h"
+#include "Log.h"
+#include "BulletPool.h"
 
 USING_NS_CC;
 
@@ -13,7 +15,7 @@ const float PeaShooter::ATTACK_RANGE = 2000.0f;
 // Protected constructor
 PeaShooter::PeaShooter()
 {
-    CCLOG("PeaShooter created.");
+    LOG_TRACE(LIFECYCLE, "PeaShooter created.");
 }
 
 // ------------------------------------------------------------------------
@@ -58,12 +60,12 @@ void PeaShooter::update(float delta)
 // ------------------------------------------------------------------------
 // 5. Check and attack logic (override from AttackingPlant)
 // ------------------------------------------------------------------------
-std::vector<Bullet*> PeaShooter::checkAndAttack(std::vector<Zombie*> allZombiesInRow[MAX_ROW], int plantRow)
+std::vector<Bullet*> PeaShooter::checkAndAttack(const LaneIndex& lanes, int plantRow)
 {
     std::vector<Bullet*> bullets;
 
     // Check if any zombie is in range in current row (to the right)
-    if (!isZombieInRange(allZombiesInRow[plantRow]))
+    if (!isZombieInRange(lanes, plantRow))
     {
         return bullets;
     }
@@ -77,11 +79,11 @@ std::vector<Bullet*> PeaShooter::checkAndAttack(std::vector<Zombie*> allZombiesI
         // Offset slightly to spawn from the "mouth"
         Vec2 spawnPos = this->getPosition() + Vec2(30.0f, 20.0f); 
         
-        Pea* pea = Pea::create(spawnPos);
+        Pea* pea = BulletPool::getInstance()->acquirePea(spawnPos);
         if (pea)
         {
              bullets.push_back(pea);
-             CCLOG("PeaShooter fired a pea at %f, %f", spawnPos.x, spawnPos.y);
+             LOG_TRACE(COMBAT, "PeaShooter fired a pea at %f, %f", spawnPos.x, spawnPos.y);
         }
     }
     return bullets;
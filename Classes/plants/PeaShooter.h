@@ -31,11 +31,11 @@ public:
 
     /**
      * @brief Check for zombies and attack if possible (override from AttackingPlant)
-     * @param allZombiesInRow All zombies in each row
+     * @param lanes Per-row zombie index of the current frame
      * @param plantRow The row this plant is in
      * @return std::vector<Bullet*> Returns vector containing Pea bullet if attack happened, empty otherwise
      */
-    virtual std::vector<Bullet*> checkAndAttack(std::vector<Zombie*> allZombiesInRow[MAX_ROW], int plantRow) override;
+    virtual std::vector<Bullet*> checkAndAttack(const LaneIndex& lanes, int plantRow) override;
 
 protected:
     // ----------------------------------------------------
@@ -1,6 +1,8 @@
 #include "Plant.h"
+#include "Log.h"
 #include "Zombie.h"
 #include "Bullet.h"
+#include "PopulationTracker.h"
 
 USING_NS_CC;
 
@@ -18,13 +20,13 @@ Plant::Plant()
     , accumulated_time(0.0f)
     , plant_pos(Vec2::ZERO)
 {
-    CCLOG("Plant created.");
+    LOG_TRACE(LIFECYCLE, "Plant created.");
 }
 
 // Destructor
 Plant::~Plant()
 {
-    CCLOG("Plant destroyed.");
+    LOG_TRACE(LIFECYCLE, "Plant destroyed.");
 }
 
 // Initialization function
@@ -43,7 +45,7 @@ bool Plant::init()
     return true;
 }
 
-// Update every frame
+// Update every frame (called by GameWorld, plants are not scheduled themselves)
 void Plant::update(float delta)
 {
     // Skip if already dead
@@ -71,17 +73,49 @@ void Plant::takeDamage(float damage)
     }
 
     current_health -= static_cast<int>(damage);
-    CCLOG("Plant took %d damage, remaining health: %d", static_cast<int>(damage), current_health);
+    LOG_TRACE(COMBAT, "Plant took %d damage, remaining health: %d", static_cast<int>(damage), current_health);
 
     if (current_health <= 0)
     {
         current_health = 0;
-        is_dead = true;
-        CCLOG("Plant is dead.");
+        markDead();
+        LOG_TRACE(LIFECYCLE, "Plant is dead.");
         // Can add death effects here, remove from scene, etc.
     }
 }
 
+// Mark dead and report to the population tracker
+void Plant::markDead()
+{
+    if (is_dead)
+    {
+        return;
+    }
+
+    is_dead = true;
+    if (population)
+    {
+        population->onPlantDied(this, population_row, population_col);
+    }
+}
+
+void Plant::joinPopulation(PopulationTracker* tracker, int row, int col)
+{
+    population = tracker;
+    population_row = row;
+    population_col = col;
+}
+
+void Plant::leavePopulation()
+{
+    population = nullptr;
+}
+
+void Plant::joinTimers(TimerWheel* wheel)
+{
+    timers = wheel;
+}
+
 // Set plant position
 void Plant::setPlantPosition(const cocos2d::Vec2& pos)
 {
@@ -100,9 +134,9 @@ bool Plant::initPlantWithSettings(const std::string& imageFile,
         return false;
     }
 
-    if (!Sprite::initWithFile(imageFile, initialRect))
+    if (!initWithAtlasFile(imageFile, initialRect))
     {
-        CCLOG("Failed to load plant image: %s", imageFile.c_str());
+        LOG_WARN(ASSETS, "Failed to load plant image: %s", imageFile.c_str());
         return false;
     }
 
@@ -112,7 +146,6 @@ bool Plant::initPlantWithSettings(const std::string& imageFile,
     accumulated_time = 0.0f;
 
     this->setAnimation();
-    this->scheduleUpdate();
 
     return true;
 }
@@ -121,5 +154,5 @@ bool Plant::initPlantWithSettings(const std::string& imageFile,
 void Plant::setAnimation()
 {
     // Subclasses will implement their specific animations
-    CCLOG("Plant::setAnimation() called (to be implemented by subclass).");
+    LOG_TRACE(LIFECYCLE, "Plant::setAnimation() called (to be implemented by subclass).");
 }
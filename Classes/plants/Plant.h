@@ -8,6 +8,11 @@
 // Forward declaration
 class Zombie;
 class Bullet;
+class PopulationTracker;
+class TimerWheel;
+class SunProducingPlant;
+class AttackingPlant;
+class BombPlant;
 
 /**
  * @brief Plant class, inherits from GameObject.
@@ -26,7 +31,7 @@ public:
     virtual bool init() override;
 
     /**
-     * @brief Update function called every frame for cooldown logic and attack checks.
+     * @brief Update function called every frame by GameWorld for cooldown logic and attack checks.
      * @param delta Time delta (time elapsed since last frame)
      */
     virtual void update(float delta) override;
@@ -50,6 +55,15 @@ public:
      */
     virtual bool isSpike() const { return false; }
 
+    /**
+     * @brief Category interfaces of this plant, or nullptr.
+     * These functions are used to avoid dynamic_cast when GameWorld files a new plant
+     * into its per-category lists.
+     */
+    virtual SunProducingPlant* asSunProducer() { return nullptr; }
+    virtual AttackingPlant* asAttacker() { return nullptr; }
+    virtual BombPlant* asBomb() { return nullptr; }
+
     /**
      * @brief Check if this plant can be upgraded to the specified plant type.
      * This function is used to avoid dynamic_cast usage in upgrade checks.
@@ -64,6 +78,21 @@ public:
      */
     void takeDamage(float damage);
 
+    /**
+     * @brief Reports this plant's death to the tracker from now on.
+     * @param row Grid cell the plant occupies
+     */
+    void joinPopulation(PopulationTracker* tracker, int row, int col);
+
+    /** @brief Stops reporting, e.g. before the plant is replaced by its upgrade */
+    void leavePopulation();
+
+    /**
+     * @brief Gives the plant the level's timer wheel once it is on the lawn.
+     * Plants with one-off deadlines (e.g. PotatoMine arming) schedule them here.
+     */
+    virtual void joinTimers(TimerWheel* timers);
+
 protected:
     // Protected constructor
     Plant();
@@ -121,6 +150,9 @@ protected:
      */
     virtual void setAnimation();
 
+    /** @brief Marks the plant dead and reports it to the tracker, once */
+    void markDead();
+
     // ----------------------------------------------------
     // Static constants
     // ----------------------------------------------------
@@ -135,4 +167,10 @@ protected:
     float cooldown_interval;   // Cooldown interval (in seconds)
     float accumulated_time;    // Current cooldown accumulated time
     cocos2d::Vec2 plant_pos;   // Plant position
+
+    PopulationTracker* population = nullptr;   // Set while the plant is on the lawn
+    int population_row = -1;
+    int population_col = -1;
+
+    TimerWheel* timers = nullptr;               // Set while the plant is on the lawn
 };
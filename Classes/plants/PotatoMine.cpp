@@ -1,6 +1,7 @@
 #include "PotatoMine.h"
 #include "Zombie.h"
-#include "audio/include/AudioEngine.h"
+#include "SpriteAtlas.h"
+#include "SoundManager.h"
 
 USING_NS_CC;
 
@@ -16,19 +17,23 @@ const std::string PotatoMine::TRIGGERED_IMAGE    = "potato_mine/triggered.png";
 PotatoMine::PotatoMine()
     : BombPlant()
     , _state(MineState::ARMING)
-    , _armingTimer(DEFAULT_ARMING_TIME)
 {
     explosion_damage = EXPLOSION_DAMAGE;
     explosion_radius = EXPLOSION_RADIUS;
 }
 
+PotatoMine::~PotatoMine()
+{
+    if (timers) timers->cancel(_armingTimer);
+}
+
 // ---------- init ----------
 bool PotatoMine::init()
 {
     if (!BombPlant::init())
         return false;
 
-    if (!Sprite::initWithFile(ARMING_IMAGE))
+    if (!initWithAtlasFile(ARMING_IMAGE))
         return false;
 
     // Set health value (easy to be eaten by zombies)
@@ -39,7 +44,6 @@ bool PotatoMine::init()
     cooldown_interval = 0.0f;
     accumulated_time  = 0.0f;
 
-    this->scheduleUpdate();
     return true;
 }
 
@@ -51,11 +55,7 @@ void PotatoMine::update(float delta)
     switch (_state)
     {
     case MineState::ARMING:
-        _armingTimer -= delta;
-        if (_armingTimer <= 0.0f)
-        {
-            switchToReadyState();
-        }
+        // Surfaces from onTimer
         break;
     case MineState::READY:
         // nothing special
@@ -66,6 +66,25 @@ void PotatoMine::update(float delta)
     }
 }
 
+// ---------- Arming deadline ----------
+void PotatoMine::joinTimers(TimerWheel* wheel)
+{
+    Plant::joinTimers(wheel);
+    if (_state == MineState::ARMING)
+    {
+        _armingTimer = timers->schedule(DEFAULT_ARMING_TIME, this);
+    }
+}
+
+void PotatoMine::onTimer(int tag)
+{
+    _armingTimer = TimerWheel::Handle();
+    if (_state == MineState::ARMING && !is_dead)
+    {
+        switchToReadyState();
+    }
+}
+
 // ---------- switchToReadyState ----------
 void PotatoMine::switchToReadyState()
 {
@@ -75,7 +94,7 @@ void PotatoMine::switchToReadyState()
     for (int i = 1; i <= 8; ++i)
     {
         std::string frameFile = READY_FRAME_DIR + "1 (" + std::to_string(i) + ").png";
-        auto frame = SpriteFrame::create(frameFile, Rect(0, 0, this->getContentSize().width, this->getContentSize().height));
+        auto frame = SpriteAtlas::getInstance()->createImageFrame(frameFile, Rect(0, 0, this->getContentSize().width, this->getContentSize().height));
         if (frame)
         {
             frames.pushBack(frame);
@@ -92,24 +111,19 @@ void PotatoMine::switchToReadyState()
 }
 
 // ---------- explode ----------
-void PotatoMine::explode(std::vector<Zombie*> allZombiesInRow[5], int plantRow, int plantCol)
+void PotatoMine::explode(const LaneIndex& lanes, int plantRow, int plantCol)
 {
     if (_state != MineState::READY || has_exploded)
         return;
 
     // Detect zombie collision in current row
-    auto& zombies = allZombiesInRow[plantRow];
+    std::vector<Zombie*> zombies;
+    lanes.queryOverlapping(plantRow, this->getBoundingBox(), zombies);
     bool triggered = false;
     for (auto zombie : zombies)
     {
-        if (zombie && !zombie->isDead())
-        {
-            if (this->getBoundingBox().intersectsRect(zombie->getBoundingBox()))
-            {
-                zombie->takeDamage(static_cast<float>(explosion_damage));
-                triggered = true;
-            }
-        }
+        zombie->takeDamage(static_cast<float>(explosion_damage));
+        triggered = true;
     }
 
     if (triggered)
@@ -125,16 +139,19 @@ void PotatoMine::playExplosionAnimation()
 {
     // Stop all actions and switch to explosion texture
     this->stopAllActions();
-    this->setTexture(TRIGGERED_IMAGE);
+    if (auto triggeredFrame = SpriteAtlas::getInstance()->createImageFrame(TRIGGERED_IMAGE))
+    {
+        this->setSpriteFrame(triggeredFrame);
+    }
 
     // Play sound effect
-    cocos2d::AudioEngine::play2d("mine.mp3", false);
+    SoundManager::getInstance()->post("mine.mp3", SoundPriority::HIGH);
 
     // Explosion blink + fade out then die
     auto blink = Blink::create(0.3f, 4);
     auto fade  = FadeOut::create(0.4f);
     auto die   = CallFunc::create([this]() {
-        this->is_dead = true;
+        this->markDead();
     });
 
     this->runAction(Sequence::create(blink, fade, die, nullptr));
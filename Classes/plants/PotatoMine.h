@@ -2,6 +2,7 @@
 
 #include "BombPlant.h"
 #include "GameDefs.h"
+#include "TimerWheel.h"
 #include <vector>
 
 // Forward declaration
@@ -11,7 +12,7 @@ class Zombie;
  * @brief PotatoMine landmine plant
  * Flow: Planting -> ARMING (underground, timing) -> READY (emerged) -> TRIGGERED (explodes when stepped on)
  */
-class PotatoMine : public BombPlant
+class PotatoMine : public BombPlant, public TimerListener
 {
 public:
     enum class MineState
@@ -28,14 +29,19 @@ public:
     virtual bool init() override;
     virtual void update(float delta) override;
 
+    // ---------- Arming deadline ----------
+    virtual void joinTimers(TimerWheel* timers) override;
+    virtual void onTimer(int tag) override;
+
     // ---------- Static factory for SeedPacket ----------
     static PotatoMine* plantAtPosition(const cocos2d::Vec2& globalPos);
 
     // ---------- BombPlant interface ----------
-    virtual void explode(std::vector<Zombie*> allZombiesInRow[5], int plantRow, int plantCol) override;
+    virtual void explode(const LaneIndex& lanes, int plantRow, int plantCol) override;
 
 private:
     PotatoMine();
+    virtual ~PotatoMine();
 
     // BombPlant pure virtual function implementation
     virtual void playExplosionAnimation() override;
@@ -47,7 +53,7 @@ private:
 
     // ---------- Member variables ----------
     MineState _state;
-    float _armingTimer;     // Underground preparation remaining time
+    TimerWheel::Handle _armingTimer;    // Pending while underground
 
     // ---------- 常量 ----------
     static const float DEFAULT_ARMING_TIME;          // Preparation duration
@@ -1,6 +1,9 @@
 #include "Puffshroom.h"
+#include "Log.h"
 #include "Puff.h"
-#include "audio/include/AudioEngine.h"
+#include "BulletPool.h"
+#include "SpriteAtlas.h"
+#include "SoundManager.h"
 
 USING_NS_CC;
 
@@ -18,7 +21,7 @@ Puffshroom::Puffshroom()
     , AttackingPlant()
     , Mushroom()
 {
-    CCLOG("Puffshroom instance created.");
+    LOG_TRACE(LIFECYCLE, "Puffshroom instance created.");
 }
 
 bool Puffshroom::init()
@@ -85,7 +88,10 @@ void Puffshroom::setAnimation()
 
     if (activity_state == ActivityState::SLEEPING)
     {
-        this->setTexture("puffshroom/sleep/1 (1).png");
+        if (auto firstFrame = SpriteAtlas::getInstance()->createImageFrame("puffshroom/sleep/1 (1).png"))
+        {
+            this->setSpriteFrame(firstFrame);
+        }
         /**
          * Sleep Animation: 17 frames.
          * Sliced with a 33px width reduction to remove whitespace from spritesheet.
@@ -96,7 +102,10 @@ void Puffshroom::setAnimation()
     }
     else
     {
-        this->setTexture("puffshroom/init/1 (1).png");
+        if (auto firstFrame = SpriteAtlas::getInstance()->createImageFrame("puffshroom/init/1 (1).png"))
+        {
+            this->setSpriteFrame(firstFrame);
+        }
         /**
          * Active Animation: 14 frames.
          * Adjusted with Y-offset of 7 to align properly with the ground.
@@ -119,31 +128,16 @@ void Puffshroom::setAnimation()
 // Attack Logic
 // ----------------------------------------------------
 
-std::vector<Bullet*> Puffshroom::checkAndAttack(std::vector<Zombie*> allZombiesInRow[MAX_ROW], int plantRow)
+std::vector<Bullet*> Puffshroom::checkAndAttack(const LaneIndex& lanes, int plantRow)
 {
     // Puff-shrooms do not attack during the day unless awakened by a Coffee Bean
     if (isDaytime()) return {};
 
     float plantX = this->getPositionX();
     float maxRange = plantX + (CELLSIZE.width * DETECTION_RANGE);
-    bool zombieDetected = false;
 
     // Scan for zombies specifically within the short detection range
-    auto& zombiesInThisRow = allZombiesInRow[plantRow];
-    for (auto zombie : zombiesInThisRow)
-    {
-        if (zombie && !zombie->isDead())
-        {
-            float zombieX = zombie->getPositionX();
-            if (zombieX > plantX && zombieX <= maxRange)
-            {
-                zombieDetected = true;
-                break;
-            }
-        }
-    }
-
-    if (!zombieDetected) return {};
+    if (!lanes.hasZombieAhead(plantRow, plantX, maxRange)) return {};
 
     // Handle firing cooldown
     if (accumulated_time >= cooldown_interval)
@@ -153,10 +147,10 @@ std::vector<Bullet*> Puffshroom::checkAndAttack(std::vector<Zombie*> allZombiesI
         // Offset spawn position so the puff comes out of the "mouth"
         Vec2 spawnPos = this->getPosition() + Vec2(10.0f, -5.0f);
 
-        Puff* puff = Puff::create(spawnPos);
+        Puff* puff = BulletPool::getInstance()->acquirePuff(spawnPos);
         if (puff)
         {
-            cocos2d::AudioEngine::play2d("puff.mp3", false, 1.0f);
+            SoundManager::getInstance()->post("puff.mp3", SoundPriority::LOW);
             return { puff };
         }
     }
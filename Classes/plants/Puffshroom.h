@@ -25,7 +25,7 @@ public:
      * @brief Combat logic: Checks for zombies within a 3-tile range.
      * @return Vector containing a spawned Puff bullet if conditions are met.
      */
-    virtual std::vector<Bullet*> checkAndAttack(std::vector<Zombie*> allZombiesInRow[MAX_ROW], int plantRow) override;
+    virtual std::vector<Bullet*> checkAndAttack(const LaneIndex& lanes, int plantRow) override;
 
     /** @brief Explicit override to resolve diamond inheritance dominance (C4250). */
     virtual PlantCategory getCategory() const override { return PlantCategory::ATTACKING; }
@@ -1,5 +1,7 @@
 #include "Repeater.h"
+#include "Log.h"
 #include "Pea.h"
+#include "BulletPool.h"
 
 USING_NS_CC;
 
@@ -12,7 +14,7 @@ const cocos2d::Rect Repeater::INITIAL_PIC_RECT = Rect(0.0f, 0.0f, 85.333f, 85.33
 // Protected constructor
 Repeater::Repeater()
 {
-    CCLOG("Repeater created.");
+    LOG_TRACE(LIFECYCLE, "Repeater created.");
 }
 
 // ------------------------------------------------------------------------
@@ -39,12 +41,12 @@ void Repeater::setAnimation()
 // ------------------------------------------------------------------------
 // 3. Check and attack logic - shoots TWO peas simultaneously
 // ------------------------------------------------------------------------
-std::vector<Bullet*> Repeater::checkAndAttack(std::vector<Zombie*> allZombiesInRow[MAX_ROW], int plantRow)
+std::vector<Bullet*> Repeater::checkAndAttack(const LaneIndex& lanes, int plantRow)
 {
     std::vector<Bullet*> bullets;
 
     // Check if any zombie is in range in current row and cooldown is ready
-    if (!isZombieInRange(allZombiesInRow[plantRow]) || accumulated_time < cooldown_interval)
+    if (!isZombieInRange(lanes, plantRow) || accumulated_time < cooldown_interval)
     {
         return bullets;
     }
@@ -53,11 +55,11 @@ std::vector<Bullet*> Repeater::checkAndAttack(std::vector<Zombie*> allZombiesInR
     
     // Create first pea
     Vec2 spawnPos1 = this->getPosition() + Vec2(30.0f, 20.0f);
-    Pea* firstPea = Pea::create(spawnPos1);
+    Pea* firstPea = BulletPool::getInstance()->acquirePea(spawnPos1);
     
     // Create second pea with horizontal offset (same height)
     Vec2 spawnPos2 = this->getPosition() + Vec2(70.0f, 20.0f);
-    Pea* secondPea = Pea::create(spawnPos2);
+    Pea* secondPea = BulletPool::getInstance()->acquirePea(spawnPos2);
     
     if (firstPea)
     {
@@ -71,7 +73,7 @@ std::vector<Bullet*> Repeater::checkAndAttack(std::vector<Zombie*> allZombiesInR
     
     if (!bullets.empty())
     {
-        CCLOG("Repeater fired %d peas", static_cast<int>(bullets.size()));
+        LOG_TRACE(COMBAT, "Repeater fired %d peas", static_cast<int>(bullets.size()));
     }
     
     return bullets;
@@ -29,11 +29,11 @@ public:
 
     /**
      * @brief Check for zombies and attack with two peas (override from PeaShooter)
-     * @param allZombiesInRow All zombies in each row
+     * @param lanes Per-row zombie index of the current frame
      * @param plantRow The row this plant is in
      * @return std::vector<Bullet*> Returns vector containing two Pea bullets if attack happened
      */
-    virtual std::vector<Bullet*> checkAndAttack(std::vector<Zombie*> allZombiesInRow[MAX_ROW], int plantRow) override;
+    virtual std::vector<Bullet*> checkAndAttack(const LaneIndex& lanes, int plantRow) override;
 
     /**
      * @brief Check if this plant can be upgraded to the specified plant type.
@@ -1,4 +1,6 @@
 #include "SpikeRock.h"
+#include "Log.h"
+#include "SoundManager.h"
 
 USING_NS_CC;
 
@@ -18,7 +20,7 @@ SpikeRock::SpikeRock()
 {
     this->current_state = SpikeRockState::COMPLETE;
     this->current_health = 3000;
-    CCLOG("SpikeRock created.");
+    LOG_TRACE(LIFECYCLE, "SpikeRock created.");
 }
 
 // ------------------------------------------------------------------------
@@ -26,7 +28,7 @@ SpikeRock::SpikeRock()
 // ------------------------------------------------------------------------
 bool SpikeRock::init()
 {
-    return initPlantWithSettings(IMAGE_FILENAME_FIRST, INITIAL_PIC_RECT, 3000, 1.5f);
+    return initPlantWithSettings(IMAGE_FILENAME_FIRST, INITIAL_PIC_RECT, 3000, 0.75f);
 }
 
 // ------------------------------------------------------------------------
@@ -90,12 +92,10 @@ void SpikeRock::update(float delta)
 // ------------------------------------------------------------------------
 // 5. Check and attack logic (override from AttackingPlant)
 // ------------------------------------------------------------------------
-std::vector<Bullet*> SpikeRock::checkAndAttack(std::vector<Zombie*> allZombiesInRow[MAX_ROW], int plantRow)
+std::vector<Bullet*> SpikeRock::checkAndAttack(const LaneIndex& lanes, int plantRow)
 {
     std::vector<Bullet*> empty; 
 
-    accumulated_time += Director::getInstance()->getDeltaTime();
-
     if (accumulated_time < cooldown_interval)
         return empty;
     accumulated_time = 0.0f;
@@ -105,22 +105,18 @@ std::vector<Bullet*> SpikeRock::checkAndAttack(std::vector<Zombie*> allZombiesIn
     spikeRect.origin.x += 45;
     spikeRect.size.width -= 90;
 
-    for (auto zombie : allZombiesInRow[plantRow])
+    std::vector<Zombie*> touching;
+    lanes.queryOverlapping(plantRow, spikeRect, touching);
+
+    for (auto zombie : touching)
     {
-        if (!zombie || zombie->isDead())
-            continue;
-        
-        if (spikeRect.intersectsRect(zombie->getBoundingBox()))
-        {
-            if (zombie->isZomboni() && !zombie->hasBeenAttackedBySpike()) {
-                zombie->setSpecialDeath();
-                this->takeDamage(1000);
-            }
-            else {
-                cocos2d::AudioEngine::play2d("bullet_hit.mp3");
-                zombie->takeDamage(20);
-            }
-            
+        if (zombie->isZomboni() && !zombie->hasBeenAttackedBySpike()) {
+            zombie->setSpecialDeath();
+            this->takeDamage(1000);
+        }
+        else {
+            SoundManager::getInstance()->post("bullet_hit.mp3", SoundPriority::LOW);
+            zombie->takeDamage(20);
         }
     }
     return empty;
@@ -1,4 +1,6 @@
 #include "SpikeWeed.h"
+#include "Log.h"
+#include "SoundManager.h"
 
 USING_NS_CC;
 
@@ -12,7 +14,7 @@ const cocos2d::Rect SpikeWeed::INITIAL_PIC_RECT = Rect(0.0f, 512.0f - 128.0f, 85
 // Protected constructor
 SpikeWeed::SpikeWeed()
 {
-    CCLOG("PeaShooter created.");
+    LOG_TRACE(LIFECYCLE, "SpikeWeed created.");
 }
 
 // ------------------------------------------------------------------------
@@ -20,7 +22,7 @@ SpikeWeed::SpikeWeed()
 // ------------------------------------------------------------------------
 bool SpikeWeed::init()
 {
-    return initPlantWithSettings(IMAGE_FILENAME, INITIAL_PIC_RECT, 300, 1.5f);
+    return initPlantWithSettings(IMAGE_FILENAME, INITIAL_PIC_RECT, 300, 0.75f);
 }
 
 // ------------------------------------------------------------------------
@@ -59,12 +61,10 @@ void SpikeWeed::update(float delta)
 // ------------------------------------------------------------------------
 // 5. Check and attack logic (override from AttackingPlant)
 // ------------------------------------------------------------------------
-std::vector<Bullet*> SpikeWeed::checkAndAttack(std::vector<Zombie*> allZombiesInRow[MAX_ROW], int plantRow)
+std::vector<Bullet*> SpikeWeed::checkAndAttack(const LaneIndex& lanes, int plantRow)
 {
     std::vector<Bullet*> empty; 
 
-    accumulated_time += Director::getInstance()->getDeltaTime();
-
     if (accumulated_time < cooldown_interval)
         return empty;
     accumulated_time = 0.0f;
@@ -74,23 +74,19 @@ std::vector<Bullet*> SpikeWeed::checkAndAttack(std::vector<Zombie*> allZombiesIn
     spikeRect.origin.x += 45;
     spikeRect.size.width -= 90;
 
-    for (auto zombie : allZombiesInRow[plantRow])
+    std::vector<Zombie*> touching;
+    lanes.queryOverlapping(plantRow, spikeRect, touching);
+
+    for (auto zombie : touching)
     {
-        if (!zombie || zombie->isDead())
-            continue;
-        
-        if (spikeRect.intersectsRect(zombie->getBoundingBox()))
-        {
-            auto z = dynamic_cast<Zomboni*>(zombie);
-            if (z) {
-                z->setSpecialDeath();
-                this->takeDamage(1000);
-            }
-            else {
-                zombie->takeDamage(20);
-                cocos2d::AudioEngine::play2d("bullet_hit.mp3");
-            }
-            
+        auto z = dynamic_cast<Zomboni*>(zombie);
+        if (z) {
+            z->setSpecialDeath();
+            this->takeDamage(1000);
+        }
+        else {
+            zombie->takeDamage(20);
+            SoundManager::getInstance()->post("bullet_hit.mp3", SoundPriority::LOW);
         }
     }
     return empty;
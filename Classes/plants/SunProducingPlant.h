@@ -16,6 +16,8 @@ public:
      */
     virtual PlantCategory getCategory() const override { return PlantCategory::SUN_PRODUCING; }
 
+    virtual SunProducingPlant* asSunProducer() override { return this; }
+
     /**
      * @brief Try to produce sun if cooldown is finished
      * @return Sun* Returns Sun instance if ready, nullptr otherwise
@@ -1,4 +1,5 @@
 #include "Sunflower.h"
+#include "Log.h"
 #include "Sun.h"
 
 USING_NS_CC;
@@ -14,7 +15,7 @@ const float Sunflower::SUN_PRODUCTION_INTERVAL = 12.0f;  // Produce sun every 24
 // Protected constructor
 Sunflower::Sunflower()
 {
-    CCLOG("Sunflower created.");
+    LOG_TRACE(LIFECYCLE, "Sunflower created.");
 }
 
 // ------------------------------------------------------------------------
@@ -69,7 +70,7 @@ std::vector<Sun*> Sunflower::produceSun()
 
         // Create sun at sunflower position
         Sun* sun = Sun::createFromSunflower(this->getPosition());
-        CCLOG("Sunflower produced a sun!");
+        LOG_DEBUG(ECONOMY, "Sunflower produced a sun!");
         return { sun };
     }
 
@@ -1,6 +1,7 @@
 #include "Sunshroom.h"
+#include "Log.h"
 #include "Sun.h"
-#include "audio/include/AudioEngine.h"
+#include "SoundManager.h"
 
 USING_NS_CC;
 
@@ -25,7 +26,7 @@ Sunshroom::Sunshroom()
     , growth_timer(0.0f)
     , current_scale(SMALL_SCALE)
 {
-    CCLOG("Sunshroom instance created.");
+    LOG_TRACE(LIFECYCLE, "Sunshroom instance created.");
 }
 
 bool Sunshroom::init()
@@ -216,7 +217,7 @@ void Sunshroom::startGrowingSequence()
 
     Action* growUpAction = growUpAnim ? (Action*)Animate::create(growUpAnim) : (Action*)DelayTime::create(1.0f);
 
-    cocos2d::AudioEngine::play2d("plantgrow.mp3", false, 1.0f);
+    SoundManager::getInstance()->post("plantgrow.mp3", SoundPriority::NORMAL);
 
     auto switchToGrown = CallFunc::create(CC_CALLBACK_0(Sunshroom::onGrowthSequenceFinished, this));
     auto sequence = Sequence::create(scaleUp, growUpAction, switchToGrown, nullptr);
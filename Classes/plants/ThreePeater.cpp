@@ -1,4 +1,6 @@
 #include "ThreePeater.h"
+#include "Log.h"
+#include "BulletPool.h"
 
 USING_NS_CC;
 
@@ -11,7 +13,7 @@ const cocos2d::Rect ThreePeater::INITIAL_PIC_RECT = Rect(0.0f, 0.0f, 85.333f, 85
 // Protected constructor
 ThreePeater::ThreePeater()
 {
-    CCLOG("ThreePeater created.");
+    LOG_TRACE(LIFECYCLE, "ThreePeater created.");
 }
 
 // ------------------------------------------------------------------------
@@ -41,7 +43,7 @@ void ThreePeater::setAnimation()
 // ------------------------------------------------------------------------
 // 3. Check and attack logic - shoots peas in THREE lanes
 // ------------------------------------------------------------------------
-std::vector<Bullet*> ThreePeater::checkAndAttack(std::vector<Zombie*> allZombiesInRow[MAX_ROW], int plantRow)
+std::vector<Bullet*> ThreePeater::checkAndAttack(const LaneIndex& lanes, int plantRow)
 {
     std::vector<Bullet*> bullets;
 
@@ -53,7 +55,7 @@ std::vector<Bullet*> ThreePeater::checkAndAttack(std::vector<Zombie*> allZombies
 
     // Check if any zombie is in range in three rows (above, current, below)
     std::vector<int> rowsToCheck = {plantRow - 1, plantRow, plantRow + 1};
-    if (!isZombieInRangeMultiRow(allZombiesInRow, rowsToCheck))
+    if (!isZombieInRangeMultiRow(lanes, rowsToCheck))
     {
         return bullets;
     }
@@ -79,17 +81,17 @@ std::vector<Bullet*> ThreePeater::checkAndAttack(std::vector<Zombie*> allZombies
         Vec2 spawnPos(basePos.x + 30.0f, targetY);
 
         // Create pea for this lane
-        Pea* pea = Pea::create(spawnPos);
+        Pea* pea = BulletPool::getInstance()->acquirePea(spawnPos);
         if (pea)
         {
             bullets.push_back(pea);
-            CCLOG("ThreePeater created pea for row %d at (%.2f, %.2f)", targetRow, spawnPos.x, spawnPos.y);
+            LOG_TRACE(COMBAT, "ThreePeater created pea for row %d at (%.2f, %.2f)", targetRow, spawnPos.x, spawnPos.y);
         }
     }
 
     if (!bullets.empty())
     {
-        CCLOG("ThreePeater fired %d peas in multiple lanes", static_cast<int>(bullets.size()));
+        LOG_TRACE(COMBAT, "ThreePeater fired %d peas in multiple lanes", static_cast<int>(bullets.size()));
     }
 
     return bullets;
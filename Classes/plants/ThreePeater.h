@@ -30,11 +30,11 @@ public:
 
     /**
      * @brief Check for zombies and attack with three peas in three lanes
-     * @param allZombiesInRow All zombies in each row
+     * @param lanes Per-row zombie index of the current frame
      * @param plantRow The row this plant is in
      * @return std::vector<Bullet*> Returns vector containing up to 3 Pea bullets (one per lane)
      */
-    virtual std::vector<Bullet*> checkAndAttack(std::vector<Zombie*> allZombiesInRow[MAX_ROW], int plantRow) override;
+    virtual std::vector<Bullet*> checkAndAttack(const LaneIndex& lanes, int plantRow) override;
 
 private:
     // ----------------------------------------------------
@@ -1,4 +1,5 @@
 #include "TwinSunflower.h"
+#include "Log.h"
 #include "Sun.h"
 
 USING_NS_CC;
@@ -14,7 +15,7 @@ const float TwinSunflower::SUN_PRODUCTION_INTERVAL = 15.0f;  // Produce sun ever
 // Protected constructor
 TwinSunflower::TwinSunflower()
 {
-    CCLOG("TwinSunflower created.");
+    LOG_TRACE(LIFECYCLE, "TwinSunflower created.");
 }
 
 // ------------------------------------------------------------------------
@@ -71,7 +72,7 @@ std::vector<Sun*> TwinSunflower::produceSun()
         Sun* sun1 = Sun::createFromSunflower(this->getPosition() + Vec2(20, 0));
         Sun* sun2 = Sun::createFromSunflower(this->getPosition() - Vec2(20, 0));
 
-        CCLOG("TwinSunflower produced two sun!");
+        LOG_DEBUG(ECONOMY, "TwinSunflower produced two sun!");
         return { sun1,sun2 };
     }
 
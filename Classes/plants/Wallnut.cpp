@@ -1,4 +1,5 @@
 #include "Wallnut.h"
+#include "Log.h"
 
 USING_NS_CC;
 
@@ -12,7 +13,7 @@ const cocos2d::Size Wallnut::OBJECT_SIZE = Size(85.333f, 128.0f);
 // Protected constructor
 Wallnut::Wallnut()
 {
-    CCLOG("Wallnut created.");
+    LOG_TRACE(LIFECYCLE, "Wallnut created.");
 }
 
 // ------------------------------------------------------------------------
@@ -25,7 +26,7 @@ bool Wallnut::init()
         return false;
     }
 
-    if (!Sprite::initWithFile(IMAGE_FILENAME, INITIAL_PIC_RECT))
+    if (!initWithAtlasFile(IMAGE_FILENAME, INITIAL_PIC_RECT))
     {
         return false;
     }
@@ -38,7 +39,6 @@ bool Wallnut::init()
 
     this->setAnimation();
     this->setCrackedAnimation();
-    this->scheduleUpdate();
     this->runAction(normalAnimation);
     return true;
 }
@@ -108,7 +108,7 @@ void Wallnut::update(float delta)
 // ------------------------------------------------------------------------
 // 5. Wallnut does not attack
 // ------------------------------------------------------------------------
-std::vector<Bullet*> Wallnut::checkAndAttack(std::vector<Zombie*> allZombiesInRow[MAX_ROW], int plantRow)
+std::vector<Bullet*> Wallnut::checkAndAttack(const LaneIndex& lanes, int plantRow)
 {
     // Wallnut is a defensive plant, does not attack
     return std::vector<Bullet*>();
@@ -1,8 +1,68 @@
 #include "PlayerProfile.h"
+#include "Log.h"
 #include <cocos2d.h>
+#include <cstring>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
 
 PlayerProfile* PlayerProfile::instance = nullptr;
 
+const long long PlayerProfile::STARTING_COINS = 10000;   // Elevated for debugging/testing
+
+namespace
+{
+    const char SNAPSHOT_MAGIC[4] = { 'P', 'V', 'Z', 'P' };
+    const char JOURNAL_MAGIC[4] = { 'P', 'V', 'Z', 'J' };
+    const uint8_t VERSION = 1;
+
+    // Snapshot: magic, version, generation, coins, flags, unlocked plant mask
+    const size_t SNAPSHOT_SIZE = 4 + 1 + 4 + 8 + 1 + 4;
+    // Journal: magic, version, generation, then records of a kind byte and a 64-bit value
+    const size_t JOURNAL_HEADER_SIZE = 4 + 1 + 4;
+    const size_t RECORD_SIZE = 1 + 8;
+
+    const uint8_t FLAG_RAKE = 1;
+    const uint8_t FLAG_MOWER = 2;
+
+    void putLittleEndian(uint8_t* out, uint64_t value, int bytes)
+    {
+        for (int i = 0; i < bytes; ++i) out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+
+    uint64_t getLittleEndian(const uint8_t* in, int bytes)
+    {
+        uint64_t value = 0;
+        for (int i = 0; i < bytes; ++i) value |= static_cast<uint64_t>(in[i]) << (8 * i);
+        return value;
+    }
+
+    /** @brief Reads a whole (small) file with a single fread */
+    bool readFile(const std::string& path, std::vector<uint8_t>& bytes)
+    {
+        FILE* file = std::fopen(path.c_str(), "rb");
+        if (!file) return false;
+        std::fseek(file, 0, SEEK_END);
+        long size = std::ftell(file);
+        std::fseek(file, 0, SEEK_SET);
+        bytes.resize(size > 0 ? static_cast<size_t>(size) : 0);
+        size_t read = bytes.empty() ? 0 : std::fread(bytes.data(), 1, bytes.size(), file);
+        std::fclose(file);
+        return read == bytes.size();
+    }
+
+    /** @brief Moves from onto to, replacing it in one step where the platform allows */
+    bool replaceFile(const std::string& from, const std::string& to)
+    {
+#ifdef _WIN32
+        return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+        return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+    }
+}
+
 PlayerProfile* PlayerProfile::getInstance()
 {
     if (!instance)
@@ -14,11 +74,11 @@ PlayerProfile* PlayerProfile::getInstance()
 }
 
 PlayerProfile::PlayerProfile()
-    : coins(10000) // Starting coins (elevated for debugging/testing)
+    : coins(STARTING_COINS)
 {
     /**
      * Initialize with default starting plants.
-     * Note: In a production version, these would be loaded from a save file.
+     * load() replaces these with the saved profile, if there is one.
      */
     unlocked_plants.insert(PlantName::SUNFLOWER);
     unlocked_plants.insert(PlantName::SUNSHROOM);
@@ -32,6 +92,174 @@ PlayerProfile::PlayerProfile()
     unlocked_plants.insert(PlantName::JALAPENO);
 }
 
+// ----------------------------------------------------
+// Persistence
+// ----------------------------------------------------
+
+void PlayerProfile::load(const std::string& directory)
+{
+    closeJournal();
+    snapshot_path = directory + "profile.pvzp";
+    journal_path = directory + "profile.pvzj";
+
+    std::vector<uint8_t> bytes;
+    if (readFile(snapshot_path, bytes))
+    {
+        if (bytes.size() == SNAPSHOT_SIZE
+            && std::memcmp(bytes.data(), SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) == 0
+            && bytes[4] == VERSION)
+        {
+            const uint8_t* in = bytes.data() + 5;
+            generation = static_cast<uint32_t>(getLittleEndian(in, 4));
+            coins = static_cast<long long>(getLittleEndian(in + 4, 8));
+            rake_enabled = (in[12] & FLAG_RAKE) != 0;
+            mower_enabled = (in[12] & FLAG_MOWER) != 0;
+
+            uint32_t mask = static_cast<uint32_t>(getLittleEndian(in + 13, 4));
+            unlocked_plants.clear();
+            for (int name = 0; name < static_cast<int>(PlantName::UNKNOWN); ++name)
+            {
+                if (mask & (1u << name)) unlocked_plants.insert(static_cast<PlantName>(name));
+            }
+        }
+        else
+        {
+            LOG_WARN(GENERAL, "PlayerProfile: %s is not a profile, starting a new one", snapshot_path.c_str());
+        }
+    }
+
+    replayJournal();
+}
+
+void PlayerProfile::replayJournal()
+{
+    std::vector<uint8_t> bytes;
+    if (!readFile(journal_path, bytes)) return;
+
+    bool current = bytes.size() >= JOURNAL_HEADER_SIZE
+        && std::memcmp(bytes.data(), JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) == 0
+        && bytes[4] == VERSION
+        && static_cast<uint32_t>(getLittleEndian(bytes.data() + 5, 4)) == generation;
+
+    // A journal from an older generation was already folded in before the app stopped
+    if (current)
+    {
+        int applied = 0;
+        for (size_t pos = JOURNAL_HEADER_SIZE; pos + RECORD_SIZE <= bytes.size(); pos += RECORD_SIZE)
+        {
+            applyChange(static_cast<Change>(bytes[pos]), static_cast<long long>(getLittleEndian(&bytes[pos + 1], 8)));
+            ++applied;
+        }
+        LOG_INFO(GENERAL, "PlayerProfile: replayed %d journal records", applied);
+    }
+
+    // Fold the journal in now so appends never follow a record cut short by a crash
+    if (!compact())
+    {
+        LOG_WARN(GENERAL, "PlayerProfile: cannot write %s", snapshot_path.c_str());
+    }
+}
+
+bool PlayerProfile::compact()
+{
+    if (snapshot_path.empty()) return false;
+
+    closeJournal();
+
+    // The journal is only removed once the new snapshot is in place; until then it still
+    // belongs to the old generation and is ignored if the app dies in between
+    ++generation;
+    if (!writeSnapshot())
+    {
+        --generation;
+        return false;
+    }
+    std::remove(journal_path.c_str());
+    return true;
+}
+
+bool PlayerProfile::writeSnapshot() const
+{
+    uint8_t bytes[SNAPSHOT_SIZE];
+    std::memcpy(bytes, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    bytes[4] = VERSION;
+    putLittleEndian(bytes + 5, generation, 4);
+    putLittleEndian(bytes + 9, static_cast<uint64_t>(coins), 8);
+    bytes[17] = static_cast<uint8_t>((rake_enabled ? FLAG_RAKE : 0) | (mower_enabled ? FLAG_MOWER : 0));
+
+    uint32_t mask = 0;
+    for (PlantName name : unlocked_plants)
+    {
+        mask |= 1u << static_cast<int>(name);
+    }
+    putLittleEndian(bytes + 18, mask, 4);
+
+    std::string temporary = snapshot_path + ".tmp";
+    FILE* file = std::fopen(temporary.c_str(), "wb");
+    if (!file) return false;
+    size_t written = std::fwrite(bytes, 1, sizeof(bytes), file);
+    if (std::fclose(file) != 0 || written != sizeof(bytes))
+    {
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return replaceFile(temporary, snapshot_path);
+}
+
+void PlayerProfile::journal(Change change, long long value)
+{
+    if (journal_path.empty()) return;
+
+    if (!journal_file)
+    {
+        journal_file = std::fopen(journal_path.c_str(), "ab");
+        if (!journal_file)
+        {
+            LOG_WARN(GENERAL, "PlayerProfile: cannot open %s", journal_path.c_str());
+            return;
+        }
+
+        std::fseek(journal_file, 0, SEEK_END);
+        if (std::ftell(journal_file) == 0)
+        {
+            uint8_t header[JOURNAL_HEADER_SIZE];
+            std::memcpy(header, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+            header[4] = VERSION;
+            putLittleEndian(header + 5, generation, 4);
+            std::fwrite(header, 1, sizeof(header), journal_file);
+        }
+    }
+
+    uint8_t record[RECORD_SIZE];
+    record[0] = static_cast<uint8_t>(change);
+    putLittleEndian(record + 1, static_cast<uint64_t>(value), 8);
+    std::fwrite(record, 1, sizeof(record), journal_file);
+    std::fflush(journal_file);
+}
+
+void PlayerProfile::closeJournal()
+{
+    if (journal_file)
+    {
+        std::fclose(journal_file);
+        journal_file = nullptr;
+    }
+}
+
+void PlayerProfile::applyChange(Change change, long long value)
+{
+    switch (change)
+    {
+        case Change::COINS:        coins += value; break;
+        case Change::UNLOCK_PLANT: unlocked_plants.insert(static_cast<PlantName>(value)); break;
+        case Change::RAKE:         rake_enabled = value != 0; break;
+        case Change::MOWER:        mower_enabled = value != 0; break;
+        default:
+            LOG_WARN(GENERAL, "PlayerProfile: unknown journal record %d", static_cast<int>(change));
+            break;
+    }
+}
+
 // ----------------------------------------------------
 // Economic Logic
 // ----------------------------------------------------
@@ -44,6 +272,7 @@ long long PlayerProfile::getCoins() const
 void PlayerProfile::addCoins(long long amount)
 {
     coins += amount;
+    journal(Change::COINS, amount);
 }
 
 bool PlayerProfile::spendCoins(long long amount)
@@ -51,6 +280,7 @@ bool PlayerProfile::spendCoins(long long amount)
     if (coins >= amount)
     {
         coins -= amount;
+        journal(Change::COINS, -amount);
         return true;
     }
     return false;
@@ -63,6 +293,7 @@ bool PlayerProfile::spendCoins(long long amount)
 void PlayerProfile::unlockPlant(PlantName plantName)
 {
     unlocked_plants.insert(plantName);
+    journal(Change::UNLOCK_PLANT, static_cast<long long>(plantName));
 }
 
 bool PlayerProfile::isPlantUnlocked(PlantName plantName) const
@@ -89,6 +320,7 @@ bool PlayerProfile::isPlantUnlocked(PlantName plantName) const
 void PlayerProfile::enableRake(bool enable)
 {
     rake_enabled = enable;
+    journal(Change::RAKE, enable ? 1 : 0);
 }
 
 bool PlayerProfile::isRakeEnabled() const
@@ -99,6 +331,7 @@ bool PlayerProfile::isRakeEnabled() const
 void PlayerProfile::enableMower(bool enable)
 {
     mower_enabled = enable;
+    journal(Change::MOWER, enable ? 1 : 0);
 }
 
 bool PlayerProfile::isMowerEnabled() const
@@ -2,12 +2,21 @@
 #define __PLAYER_PROFILE_H__
 
 #include "GameDefs.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
 #include <unordered_set>
 
 /**
  * @brief Singleton class managing persistent player data.
  * Handles currency (coins), unlocked plant types, and purchased power-ups
  * like the garden rake and lawn mowers.
+ *
+ * The profile lives in two files in the writable path. profile.pvzp is a small fixed-size
+ * snapshot that is read in one go and replaced through write-then-rename. profile.pvzj is an
+ * append-only journal: every change appends one 9-byte record, so collecting a coin never
+ * rewrites the snapshot. compact() folds the journal into a new snapshot; AppDelegate calls it
+ * when the app goes to the background or exits.
  */
 class PlayerProfile
 {
@@ -19,6 +28,17 @@ public:
     PlayerProfile(const PlayerProfile&) = delete;
     PlayerProfile& operator=(const PlayerProfile&) = delete;
 
+    // --- Persistence ---
+
+    /**
+     * @brief Loads the snapshot and replays its journal; call once at startup.
+     * @param directory Writable directory, with a trailing separator
+     */
+    void load(const std::string& directory);
+
+    /** @brief Writes a new snapshot and starts an empty journal */
+    bool compact();
+
     // --- Currency Management ---
     long long getCoins() const;
     void addCoins(long long amount);
@@ -38,6 +58,31 @@ private:
     PlayerProfile();
     static PlayerProfile* instance;
 
+    /** @brief Journal record kinds; values are part of the file format */
+    enum class Change : uint8_t
+    {
+        COINS = 1,      // Value is the signed change in coins
+        UNLOCK_PLANT,   // Value is the PlantName
+        RAKE,           // Value is 0 or 1
+        MOWER
+    };
+
+    static const long long STARTING_COINS;
+
+    void applyChange(Change change, long long value);
+
+    /** @brief Appends a record to the journal, once load() has picked the files */
+    void journal(Change change, long long value);
+
+    bool writeSnapshot() const;
+    void replayJournal();
+    void closeJournal();
+
+    std::string snapshot_path;      // Empty until load()
+    std::string journal_path;
+    FILE* journal_file = nullptr;   // Opened on the first change after load()
+    uint32_t generation = 0;        // Bumped by compact(); a journal from another generation is stale
+
     long long coins;
     std::unordered_set<PlantName> unlocked_plants;
     bool rake_enabled{ false };
@@ -15,6 +15,13 @@
 #include "SeedPacket.h"
 #include "audio/include/AudioEngine.h"
 #include "PlayerProfile.h"
+#include "AssetPreloader.h"
+#include "RandomService.h"
+#include "WaveSchedule.h"
+#include "ZombiePool.h"
+#include "SpriteAtlas.h"
+#include <functional>
+#include <memory>
 
 USING_NS_CC;
 
@@ -26,6 +33,38 @@ namespace
     const float SEED_BANK_SCALE_FACTOR_X = 1.34f;
     const float SEED_BANK_SCALE_FACTOR_Y = 1.0f;
     const std::string SEED_BANK_IMAGE = "seedBank.png";
+
+    // Longest the scene holds after "Ready Set Plant" for level textures still decoding
+    const float PRELOAD_MAX_WAIT = 3.0f;
+
+    // Pooled zombies built per frame while "Ready Set Plant" plays
+    const int ZOMBIE_PREWARM_PER_FRAME = 2;
+
+    // Fade-in of a preview zombie once its idle sheet is in
+    const float SHOWCASE_FADE_IN = 0.2f;
+
+    /**
+     * @brief Decodes every texture behind file (its atlas pages when packed) on the loader thread.
+     * done runs on the main thread once all of them are cached, right away if they already are.
+     */
+    void loadTexturesAsync(const std::string& file, const std::function<void()>& done)
+    {
+        auto files = SpriteAtlas::getInstance()->getTextureFiles(file);
+        if (files.empty())
+        {
+            if (done) done();
+            return;
+        }
+
+        auto remaining = std::make_shared<size_t>(files.size());
+        auto textureCache = Director::getInstance()->getTextureCache();
+        for (const auto& texture : files)
+        {
+            textureCache->addImageAsync(texture, [remaining, done](Texture2D*) {
+                if (--*remaining == 0 && done) done();
+            });
+        }
+    }
 }
 
 SelectCardsScene* SelectCardsScene::createScene(bool isNightMode)
@@ -73,7 +112,7 @@ SelectCardsScene::SelectCardsScene()
 
 SelectCardsScene::~SelectCardsScene()
 {
-    // Destructor: SeedPackets are autoreleased by Cocos2d-x
+    AssetPreloader::getInstance()->cancelCallback();
 }
 
 bool SelectCardsScene::init()
@@ -92,6 +131,17 @@ bool SelectCardsScene::init()
 
     buildWorld();
     buildUI();
+
+    // Decode the level's shared textures while the intro pan and card selection run
+    AssetPreloader::getInstance()->reset();
+    AssetPreloader::getInstance()->preload(AssetManifest::forLevel(is_night_mode, std::vector<PlantName>()));
+
+    // The card images are needed when the pan ends; decode them meanwhile
+    for (const auto& entry : SeedPacket::CONFIG_TABLE)
+    {
+        loadTexturesAsync(entry.second.packetImage, nullptr);
+    }
+
     runIntroMove();
 
     // Initialize background music for selection
@@ -204,6 +254,9 @@ void SelectCardsScene::showSelectBG()
         auto startItem = MenuItemLabel::create(startLabel, [this](Ref*) {
             cocos2d::AudioEngine::play2d("buttonclick.mp3", false);
 
+            // The loadout is final now: fetch its plant sheets during "Ready Set Plant"
+            AssetPreloader::getInstance()->preload(AssetManifest::forLevel(is_night_mode, selected_plant_names));
+
             // Hide the selection board and pan camera back to start the game
             if (selectBG && selectBG->isVisible()) {
                 selectBG->runAction(Sequence::create(
@@ -242,26 +295,49 @@ void SelectCardsScene::showSelectBG()
 
 void SelectCardsScene::spawnZombieShowcase()
 {
-    // Utility to arrange preview zombies in a grid on the right side of the lawn
-    int idx = 0, idy = 0;
-    auto addShow = [&](Sprite* sp) {
-        if (!sp) return;
-        sp->setPosition(Vec2(zShow_startX + zShow_gapX * idx, zShow_startY + zShow_gapY * idy));
-        if (zombie_show_layer) zombie_show_layer->addChild(sp, 7 - idy);
-        idy++;
-        if (idy >= 4) {
-            idy = 0;
-            ++idx;
-        }
-        };
+    if (!zombie_show_layer) return;
 
-    // Instantiate various zombies for the preview sequence
-    if (auto z = NormalZombie::createZombie()) addShow(z->createShowcaseSprite(Vec2::ZERO));
-    if (auto z = FlagZombie::createZombie()) addShow(z->createShowcaseSprite(Vec2::ZERO));
-    if (auto z = PoleVaulter::createZombie()) addShow(z->createShowcaseSprite(Vec2::ZERO));
-    if (auto z = Zomboni::createZombie()) addShow(z->createShowcaseSprite(Vec2::ZERO));
-    if (auto z = Gargantuar::createZombie()) addShow(z->createShowcaseSprite(Vec2::ZERO));
-    if (auto z = BucketHeadZombie::createZombie()) addShow(z->createShowcaseSprite(Vec2::ZERO));
+    // Preview sprites only: no zombie is built, and each idle sheet is decoded off the main thread
+    struct Showcase
+    {
+        AnimationSpec spec;
+        Sprite* (*create)(const Vec2&);
+    };
+    const Showcase showcases[] = {
+        { NormalZombie::getShowcaseSpec(), &NormalZombie::createShowcaseSprite },
+        { FlagZombie::getShowcaseSpec(), &FlagZombie::createShowcaseSprite },
+        { PoleVaulter::getShowcaseSpec(), &PoleVaulter::createShowcaseSprite },
+        { Zomboni::getShowcaseSpec(), &Zomboni::createShowcaseSprite },
+        { Gargantuar::getShowcaseSpec(), &Gargantuar::createShowcaseSprite },
+        { BucketHeadZombie::getShowcaseSpec(), &BucketHeadZombie::createShowcaseSprite }
+    };
+
+    int i = 0;
+    for (const auto& showcase : showcases)
+    {
+        // Arrange preview zombies in a grid of four rows on the right side of the lawn
+        int idx = i / 4, idy = i % 4;
+        ++i;
+        Vec2 pos(zShow_startX + zShow_gapX * idx, zShow_startY + zShow_gapY * idy);
+        int zOrder = 7 - idy;
+
+        auto create = showcase.create;
+        Node* layer = zombie_show_layer;
+        layer->retain();
+        loadTexturesAsync(showcase.spec.file, [layer, create, pos, zOrder]() {
+            // The player may have left the scene while the sheet was decoding
+            if (layer->getParent())
+            {
+                if (auto sp = create(pos))
+                {
+                    sp->setOpacity(0);
+                    layer->addChild(sp, zOrder);
+                    sp->runAction(FadeIn::create(SHOWCASE_FADE_IN));
+                }
+            }
+            layer->release();
+            });
+    }
 }
 
 void SelectCardsScene::createSelectCards()
@@ -275,13 +351,11 @@ void SelectCardsScene::createSelectCards()
         PlantName name = it->first;
         const PlantConfig& cfg = it->second;
 
-        SeedPacket* seedPacket = SeedPacket::createFromConfig(name);
-        if (seedPacket) {
-            auto selectCard = SelectCard::create(cfg.packetImage, name, seedPacket);
-            if (selectCard) {
-                all_select_cards.push_back(selectCard);
-                selectBG->addChild(selectCard, 10);
-            }
+        // Only the card picture: GameWorld builds the real seed packets for the chosen plants
+        auto selectCard = SelectCard::create(cfg.packetImage, name);
+        if (selectCard) {
+            all_select_cards.push_back(selectCard);
+            selectBG->addChild(selectCard, 10);
         }
     }
 
@@ -346,9 +420,6 @@ void SelectCardsScene::onCardSelected(SelectCard* card)
     cocos2d::AudioEngine::play2d("buttonclick.mp3", false);
     card->setSelected(!wasSelected);
 
-    auto* seedPacket = card->getSeedPacket();
-    if (!seedPacket) return;
-
     if (card->isSelected()) {
         selected_cards.push_back(card);
         selected_plant_names.push_back(card->getPlantName());
@@ -388,7 +459,8 @@ void SelectCardsScene::updateSelectedCardsDisplay()
         const std::string& imageFile = card->getImageFile();
         if (imageFile.empty()) continue;
 
-        auto displaySprite = Sprite::create(imageFile);
+        auto frame = SpriteAtlas::getInstance()->createImageFrame(imageFile);
+        auto displaySprite = frame ? Sprite::createWithSpriteFrame(frame) : nullptr;
         if (displaySprite) {
             displaySprite->setPosition(Vec2(baseX + i * spacing + origin.x, baseY + origin.y));
             selected_cards_container->addChild(displaySprite);
@@ -448,6 +520,18 @@ void SelectCardsScene::playReadySetPlantSequence()
 
     readySfxId = cocos2d::AudioEngine::play2d("plants-vs-zombies-ready-set-plant.mp3", false);
 
+    // Pick the level seed now and plan its waves, so the zombie pool fills up during the countdown.
+    // GameWorld is started with the same seed and plans the same schedule.
+    level_seed = RandomService::freshSeed();
+    RandomService::getInstance()->beginLevel(level_seed);
+    WaveSchedule waves;
+    waves.build(WavePlanner(is_night_mode), RandomService::getInstance()->get(RandomStreamId::WAVES));
+    ZombiePool::getInstance()->plan(waves);
+    this->schedule([this](float) {
+        if (ZombiePool::getInstance()->prewarm(ZOMBIE_PREWARM_PER_FRAME) == 0)
+            this->unschedule("zombie_prewarm");
+        }, "zombie_prewarm");
+
     // Final scene swap to the game world after the sequence completes
     float totalWait = 2.6f;
     this->runAction(Sequence::create(
@@ -459,7 +543,29 @@ void SelectCardsScene::playReadySetPlantSequence()
 
 void SelectCardsScene::maybeGoGame()
 {
+    if (has_left_scene) return;
+
+    // Hold the last frame until the preloaded textures are in, but never longer than PRELOAD_MAX_WAIT
+    auto preloader = AssetPreloader::getInstance();
+    if (!preloader->isReady() && !preload_wait_expired)
+    {
+        preloader->setReadyCallback([this](float) { maybeGoGame(); });
+        this->runAction(Sequence::create(
+            DelayTime::create(PRELOAD_MAX_WAIT),
+            CallFunc::create([this]() {
+                preload_wait_expired = true;
+                maybeGoGame();
+                }),
+            nullptr
+        ));
+        return;
+    }
+    has_left_scene = true;
+    preloader->cancelCallback();
+    CCLOG("SelectCardsScene: level assets ready after %.3fs (%d pending)",
+        preloader->getTimeToReady(), preloader->getPendingCount());
+
     cocos2d::AudioEngine::stopAll();
     // Navigate to the main gameplay scene
-    Director::getInstance()->replaceScene(GameWorld::createScene(is_night_mode, selected_plant_names));
+    Director::getInstance()->replaceScene(GameWorld::createScene(is_night_mode, selected_plant_names, level_seed));
 }
\ No newline at end of file
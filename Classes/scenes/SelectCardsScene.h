@@ -46,7 +46,7 @@ private:
 
     // --- Level Transition Sequence ---
     void playReadySetPlantSequence();   // Plays the "Ready, Set, Plant!" animation
-    void maybeGoGame();                 // Transitions to the GameWorld scene
+    void maybeGoGame();                 // Transitions to the GameWorld scene once assets are ready
 
     // --- Environment and Layers ---
     bool is_night_mode;
@@ -80,4 +80,7 @@ private:
     int select_BgmId = -1;              // Handle for the background music
     int readySfxId = -1;                // Handle for the transition sound effects
     bool is_transitioning = false;      // Prevents multiple scene transitions
+    bool preload_wait_expired = false;  // Stop waiting for AssetPreloader and start the level
+    bool has_left_scene = false;        // GameWorld has been requested
+    uint64_t level_seed = 0;            // Seed the zombie pool was planned with, handed to GameWorld
 };
\ No newline at end of file
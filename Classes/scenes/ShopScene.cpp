@@ -1,6 +1,8 @@
 #include "ShopScene.h"
 #include "GameMenu.h"
 #include "PlayerProfile.h"
+#include "RandomService.h"
+#include "SpriteAtlas.h"
 #include "ui/CocosGUI.h"
 #include "audio/include/AudioEngine.h"
 
@@ -93,7 +95,10 @@ void ShopScene::setupDaveAnimation()
     auto visibleSize = Director::getInstance()->getVisibleSize();
     Vec2 origin = Director::getInstance()->getVisibleOrigin();
 
-    dave_sprite = Sprite::create("dave/idling/1 (1).png");
+    auto atlas = SpriteAtlas::getInstance();
+    auto firstFrame = atlas->createImageFrame("dave/idling/1 (1).png");
+    if (!firstFrame) return;
+    dave_sprite = Sprite::createWithSpriteFrame(firstFrame);
     if (!dave_sprite) return;
 
     dave_sprite->setPosition(Vec2(150 + origin.x, 150 + origin.y));
@@ -102,18 +107,20 @@ void ShopScene::setupDaveAnimation()
     // Create Idle Animation (Breathing/Looking around)
     auto idleAnimation = Animation::create();
     for (int i = 1; i <= 17; ++i)
-        idleAnimation->addSpriteFrameWithFile(StringUtils::format("dave/idling/1 (%d).png", i));
+        if (auto frame = atlas->createImageFrame(StringUtils::format("dave/idling/1 (%d).png", i)))
+            idleAnimation->addSpriteFrame(frame);
     idleAnimation->setDelayPerUnit(DAVE_FRAME_DELAY);
 
     // Create Speaking Animation (Mouth movements)
     auto speakingAnimation = Animation::create();
     for (int i = 1; i <= 13; ++i)
-        speakingAnimation->addSpriteFrameWithFile(StringUtils::format("dave/speaking/1 (%d).png", i));
+        if (auto frame = atlas->createImageFrame(StringUtils::format("dave/speaking/1 (%d).png", i)))
+            speakingAnimation->addSpriteFrame(frame);
     speakingAnimation->setDelayPerUnit(DAVE_FRAME_DELAY);
 
     // Randomized Dave "gibberish" voice logic
     auto playRandomDaveSound = CallFunc::create([]() {
-        int randNum = cocos2d::random(1, 4);
+        int randNum = RandomService::getInstance()->get(RandomStreamId::COSMETIC).range(1, 4);
         AudioEngine::play2d(StringUtils::format("dave%d.mp3", randNum));
         });
 
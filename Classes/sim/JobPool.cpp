@@ -0,0 +1,123 @@
+#include "JobPool.h"
+#include <algorithm>
+
+JobPool::JobPool(int threads)
+    : job(nullptr)
+    , remaining(0)
+    , batch(0)
+    , stopping(false)
+{
+    threads = std::max(1, threads);
+    for (int i = 0; i < threads; ++i)
+    {
+        queues.emplace_back(new Queue());
+    }
+    for (int i = 1; i < threads; ++i)
+    {
+        workers.emplace_back(&JobPool::workerLoop, this, i);
+    }
+}
+
+JobPool::~JobPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void JobPool::parallelFor(int count, const std::function<void(int)>& fn)
+{
+    if (count <= 0) return;
+
+    // Nothing to share: skip the hand-off
+    if (workers.empty() || count == 1)
+    {
+        for (int i = 0; i < count; ++i) fn(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &fn;
+        remaining.store(count);
+        for (int i = 0; i < count; ++i)
+        {
+            Queue& queue = *queues[i % queues.size()];
+            std::lock_guard<std::mutex> queueLock(queue.mutex);
+            queue.indices.push_back(i);
+        }
+        ++batch;
+    }
+    wake.notify_all();
+
+    drain(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this]() { return remaining.load() == 0; });
+    job = nullptr;
+}
+
+void JobPool::workerLoop(int self)
+{
+    unsigned seen = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this, seen]() { return stopping || batch != seen; });
+            if (stopping) return;
+            seen = batch;
+        }
+        drain(self);
+    }
+}
+
+void JobPool::drain(int self)
+{
+    int index;
+    while (take(self, index))
+    {
+        (*job)(index);
+        if (remaining.fetch_sub(1) == 1)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            finished.notify_one();
+        }
+    }
+}
+
+bool JobPool::take(int self, int& index)
+{
+    // Own queue first, newest index first
+    {
+        Queue& own = *queues[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.indices.empty())
+        {
+            index = own.indices.back();
+            own.indices.pop_back();
+            return true;
+        }
+    }
+
+    // Then steal the oldest index of the next non-empty queue
+    const int count = static_cast<int>(queues.size());
+    for (int offset = 1; offset < count; ++offset)
+    {
+        Queue& victim = *queues[(self + offset) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.indices.empty())
+        {
+            index = victim.indices.front();
+            victim.indices.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Small work-stealing thread pool for data-parallel loops.
+ *
+ * parallelFor() deals the indices round-robin onto one queue per thread (the calling thread
+ * included). Each thread takes work from the back of its own queue and, once that is empty,
+ * steals from the front of the others', so a row with many zombies does not hold up the rest.
+ * It returns when every index has run. Which thread runs which index is not deterministic;
+ * callers keep results bit-identical by giving each index its own output slot.
+ */
+class JobPool
+{
+public:
+    /** @param threads Threads that run jobs, the calling thread included; at least 1 */
+    explicit JobPool(int threads);
+    ~JobPool();
+
+    JobPool(const JobPool&) = delete;
+    JobPool& operator=(const JobPool&) = delete;
+
+    int getThreadCount() const { return static_cast<int>(queues.size()); }
+
+    /** @brief Runs job(0) ... job(count - 1) across the pool and waits for all of them */
+    void parallelFor(int count, const std::function<void(int)>& job);
+
+private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<int> indices;
+    };
+
+    void workerLoop(int self);
+
+    /** @brief Runs indices from queue self, then stolen ones, until none are left */
+    void drain(int self);
+
+    bool take(int self, int& index);
+
+    std::vector<std::unique_ptr<Queue>> queues;     // [0] belongs to the calling thread
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable wake;                   // A batch started, or the pool is stopping
+    std::condition_variable finished;               // The last index of the batch ran
+    const std::function<void(int)>* job;
+    std::atomic<int> remaining;
+    unsigned batch;
+    bool stopping;
+};
@@ -0,0 +1,237 @@
+#include "SimPlayer.h"
+#include "SimWorld.h"
+
+// ----------------------------------------------------
+// Static constant definitions
+// ----------------------------------------------------
+const float SimReferencePlayer::DECISION_INTERVAL = 0.25f;
+const int SimReferencePlayer::PRODUCER_TARGET = 8;
+
+namespace
+{
+    const float THREAT_X = 1000.0f;         // Zombies left of this x count as a threat
+    const float BOMB_TRIGGER_X = 900.0f;
+    const int BOMB_CLUSTER_SIZE = 3;
+
+    bool isProducer(PlantName name)
+    {
+        return name == PlantName::SUNFLOWER || name == PlantName::TWINSUNFLOWER || name == PlantName::SUNSHROOM;
+    }
+
+    bool isShooter(PlantName name)
+    {
+        return name == PlantName::PEASHOOTER || name == PlantName::REPEATER || name == PlantName::THREEPEATER
+            || name == PlantName::GATLINGPEA || name == PlantName::PUFFSHROOM;
+    }
+
+    bool isWall(PlantName name)
+    {
+        return name == PlantName::WALLNUT;
+    }
+}
+
+SimReferencePlayer::SimReferencePlayer()
+    : next_decision_time(0.0f)
+{
+}
+
+void SimReferencePlayer::act(SimWorld& world)
+{
+    if (world.getTime() < next_decision_time) return;
+    next_decision_time = world.getTime() + DECISION_INTERVAL;
+
+    // One plant per decision, most urgent first
+    if (useBombs(world)) return;
+    if (buildShooter(world, true)) return;
+    if (buildProducer(world)) return;
+    if (buildUpgrade(world)) return;
+    if (buildFront(world)) return;
+    buildShooter(world, false);
+}
+
+// ----------------------------------------------------
+// Helpers
+// ----------------------------------------------------
+bool SimReferencePlayer::tryPlantInColumns(SimWorld& world, PlantName name, int row, int firstCol, int lastCol)
+{
+    int step = firstCol <= lastCol ? 1 : -1;
+    for (int col = firstCol; col != lastCol + step; col += step)
+    {
+        if (world.plant(name, row, col)) return true;
+    }
+    return false;
+}
+
+PlantName SimReferencePlayer::bestShooter(const SimWorld& world) const
+{
+    static const PlantName SHOOTER_ORDER[] = {
+        PlantName::THREEPEATER, PlantName::REPEATER, PlantName::PEASHOOTER, PlantName::PUFFSHROOM
+    };
+    for (PlantName name : SHOOTER_ORDER)
+    {
+        if (name == PlantName::PUFFSHROOM && !world.getConfig().night_mode) continue;
+        if (world.isPacketReady(name)) return name;
+    }
+    return PlantName::UNKNOWN;
+}
+
+int SimReferencePlayer::countInRow(const SimWorld& world, int row, bool (*predicate)(PlantName)) const
+{
+    int count = 0;
+    for (int col = 0; col < MAX_COL; ++col)
+    {
+        const SimPlant& p = world.plantAt(row, col);
+        if (!p.isEmpty() && predicate(p.name)) ++count;
+    }
+    return count;
+}
+
+int SimReferencePlayer::threatInRow(const SimWorld& world, int row, float maxX) const
+{
+    int count = 0;
+    for (const auto& z : world.zombiesInRow(row))
+    {
+        if (z.isActive() && z.x <= maxX) ++count;
+    }
+    return count;
+}
+
+// ----------------------------------------------------
+// Decisions
+// ----------------------------------------------------
+bool SimReferencePlayer::useBombs(SimWorld& world)
+{
+    // Jalapeno on a crowded row
+    if (world.isPacketReady(PlantName::JALAPENO))
+    {
+        for (int row = 0; row < MAX_ROW; ++row)
+        {
+            if (threatInRow(world, row, BOMB_TRIGGER_X) >= BOMB_CLUSTER_SIZE + 1
+                && tryPlantInColumns(world, PlantName::JALAPENO, row, MAX_COL - 1, 0))
+            {
+                return true;
+            }
+        }
+    }
+
+    // Cherry bomb on the densest 3x3 block
+    if (world.isPacketReady(PlantName::CHERRYBOMB))
+    {
+        int bestRow = -1, bestCol = -1, bestCount = 0;
+        for (int row = 0; row < MAX_ROW; ++row)
+        {
+            for (int col = 0; col < MAX_COL; ++col)
+            {
+                if (!world.canPlant(PlantName::CHERRYBOMB, row, col)) continue;
+                int count = 0;
+                for (int r = row - 1; r <= row + 1; ++r)
+                {
+                    if (r < 0 || r >= MAX_ROW) continue;
+                    for (const auto& z : world.zombiesInRow(r))
+                    {
+                        int zc = SimWorld::columnAt(z.x);
+                        if (z.isActive() && z.x <= BOMB_TRIGGER_X && zc >= col - 1 && zc <= col + 1) ++count;
+                    }
+                }
+                if (count > bestCount)
+                {
+                    bestCount = count;
+                    bestRow = row;
+                    bestCol = col;
+                }
+            }
+        }
+        if (bestCount >= BOMB_CLUSTER_SIZE && world.plant(PlantName::CHERRYBOMB, bestRow, bestCol)) return true;
+    }
+
+    // Potato mine just ahead of the leading zombie of a row without shooters
+    if (world.isPacketReady(PlantName::POTATOMINE))
+    {
+        for (int row = 0; row < MAX_ROW; ++row)
+        {
+            if (countInRow(world, row, isShooter) > 0 || threatInRow(world, row, THREAT_X) == 0) continue;
+            if (tryPlantInColumns(world, PlantName::POTATOMINE, row, 5, 3)) return true;
+        }
+    }
+    return false;
+}
+
+bool SimReferencePlayer::buildProducer(SimWorld& world)
+{
+    PlantName producer = world.getConfig().night_mode ? PlantName::SUNSHROOM : PlantName::SUNFLOWER;
+    if (!world.isPacketReady(producer)) return false;
+
+    int total = 0;
+    for (int row = 0; row < MAX_ROW; ++row) total += countInRow(world, row, isProducer);
+    if (total >= PRODUCER_TARGET) return false;
+
+    // Spread over rows: fill column 0 first, then column 1
+    for (int col = 0; col < 2; ++col)
+    {
+        for (int row = 0; row < MAX_ROW; ++row)
+        {
+            if (world.plant(producer, row, col)) return true;
+        }
+    }
+    return false;
+}
+
+bool SimReferencePlayer::buildShooter(SimWorld& world, bool threatenedOnly)
+{
+    PlantName shooter = bestShooter(world);
+    if (shooter == PlantName::UNKNOWN) return false;
+
+    // Rows with the most zombies and the fewest shooters first
+    int bestRow = -1, bestScore = -1;
+    for (int row = 0; row < MAX_ROW; ++row)
+    {
+        int threat = threatInRow(world, row, THREAT_X);
+        int shooters = countInRow(world, row, isShooter);
+        if (threatenedOnly && (threat == 0 || shooters >= threat)) continue;
+        if (!threatenedOnly && shooters >= 2) continue;
+
+        int score = threat * 4 - shooters * 3;
+        if (score > bestScore)
+        {
+            bestScore = score;
+            bestRow = row;
+        }
+    }
+    if (bestRow < 0) return false;
+    return tryPlantInColumns(world, shooter, bestRow, 2, 4);
+}
+
+bool SimReferencePlayer::buildFront(SimWorld& world)
+{
+    for (int row = 0; row < MAX_ROW; ++row)
+    {
+        if (countInRow(world, row, isShooter) == 0) continue;
+
+        if (countInRow(world, row, isWall) == 0 && world.isPacketReady(PlantName::WALLNUT)
+            && tryPlantInColumns(world, PlantName::WALLNUT, row, 6, 5))
+        {
+            return true;
+        }
+        if (world.isPacketReady(PlantName::SPIKEWEED) && tryPlantInColumns(world, PlantName::SPIKEWEED, row, 7, 7))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SimReferencePlayer::buildUpgrade(SimWorld& world)
+{
+    static const PlantName UPGRADES[] = {
+        PlantName::GATLINGPEA, PlantName::TWINSUNFLOWER, PlantName::SPIKEROCK
+    };
+    for (PlantName name : UPGRADES)
+    {
+        if (!world.isPacketReady(name)) continue;
+        for (int row = 0; row < MAX_ROW; ++row)
+        {
+            if (tryPlantInColumns(world, name, row, 0, MAX_COL - 1)) return true;
+        }
+    }
+    return false;
+}
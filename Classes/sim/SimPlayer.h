@@ -0,0 +1,49 @@
+#pragma once
+
+#include "GameTypes.h"
+
+class SimWorld;
+
+/**
+ * @brief Decision maker driving a SimWorld, called once before every step.
+ */
+class SimPlayer
+{
+public:
+    virtual ~SimPlayer() {}
+
+    /** @brief Inspect the world and plant whatever the player wants this step */
+    virtual void act(SimWorld& world) = 0;
+};
+
+/**
+ * @brief Deterministic rule-of-thumb player used by the command-line simulator.
+ *
+ * Builds an economy in the back columns, answers threatened rows with the best shooter
+ * of the loadout, walls and spikes the front, and spends bombs on clusters. It is not
+ * meant to be optimal, only stable, so two loadouts can be compared under the same seed.
+ */
+class SimReferencePlayer : public SimPlayer
+{
+public:
+    SimReferencePlayer();
+
+    virtual void act(SimWorld& world) override;
+
+    static const float DECISION_INTERVAL;   // Seconds between two decisions
+    static const int PRODUCER_TARGET;       // Sun producers to build before the defence is complete
+
+private:
+    bool useBombs(SimWorld& world);
+    bool buildProducer(SimWorld& world);
+    bool buildShooter(SimWorld& world, bool threatenedOnly);
+    bool buildFront(SimWorld& world);
+    bool buildUpgrade(SimWorld& world);
+
+    bool tryPlantInColumns(SimWorld& world, PlantName name, int row, int firstCol, int lastCol);
+    PlantName bestShooter(const SimWorld& world) const;
+    int countInRow(const SimWorld& world, int row, bool (*predicate)(PlantName)) const;
+    int threatInRow(const SimWorld& world, int row, float maxX) const;
+
+    float next_decision_time;
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "WavePlanner.h"
+#include <cstdint>
+
+/**
+ * @brief Small seeded generator (SplitMix64) for the headless simulator.
+ * Same seed, same sequence, on every platform; unlike rand() it carries no global state,
+ * so several simulations can run side by side.
+ */
+class SimRandom : public WaveRandom
+{
+public:
+    explicit SimRandom(uint64_t seed = 1) : state(seed) {}
+
+    /** @brief Next raw 64-bit value */
+    uint64_t next()
+    {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    virtual int range(int a, int b) override
+    {
+        if (b < a) { int t = a; a = b; b = t; }
+        uint64_t span = static_cast<uint64_t>(b - a) + 1;
+        return a + static_cast<int>(next() % span);
+    }
+
+    virtual float unit() override
+    {
+        // 24 random mantissa bits, inclusive of 1.0 like CCRANDOM_0_1()
+        return static_cast<float>(next() >> 40) / static_cast<float>((1 << 24) - 1);
+    }
+
+private:
+    uint64_t state;
+};
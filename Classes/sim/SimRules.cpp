@@ -0,0 +1,76 @@
+#include "SimRules.h"
+
+// ----------------------------------------------------
+// Default rule tables
+// ----------------------------------------------------
+SimRules SimRules::defaults()
+{
+    SimRules r;
+
+    // id, sun cost, packet cooldown, health, interval, half width
+    r.plant(PlantName::SUNFLOWER)     = { "sunflower",     50,  7.5f,  80,   12.0f, 50.0f };
+    r.plant(PlantName::PEASHOOTER)    = { "peashooter",    100, 7.5f,  80,   1.5f,  50.0f };
+    r.plant(PlantName::WALLNUT)       = { "wallnut",       50,  30.0f, 1000, 1.5f,  50.0f };
+    r.plant(PlantName::POTATOMINE)    = { "potatomine",    25,  30.0f, 80,   12.0f, 37.5f };
+    r.plant(PlantName::REPEATER)      = { "repeater",      200, 7.5f,  80,   1.5f,  50.0f };
+    r.plant(PlantName::THREEPEATER)   = { "threepeater",   325, 7.5f,  80,   1.5f,  45.5f };
+    r.plant(PlantName::CHERRYBOMB)    = { "cherrybomb",    150, 50.0f, 1000, 1.12f, 75.0f };
+    r.plant(PlantName::SUNSHROOM)     = { "sunshroom",     25,  7.5f,  80,   15.0f, 42.7f };
+    r.plant(PlantName::PUFFSHROOM)    = { "puffshroom",    0,   7.5f,  80,   1.5f,  42.7f };
+    r.plant(PlantName::SPIKEWEED)     = { "spikeweed",     100, 7.5f,  300,  0.75f, 53.1f };
+    r.plant(PlantName::JALAPENO)      = { "jalapeno",      125, 50.0f, 1000, 0.56f, 42.5f };
+    r.plant(PlantName::TWINSUNFLOWER) = { "twinsunflower", 150, 50.0f, 80,   15.0f, 51.9f };
+    r.plant(PlantName::GATLINGPEA)    = { "gatlingpea",    250, 50.0f, 100,  1.5f,  53.0f };
+    r.plant(PlantName::SPIKEROCK)     = { "spikerock",     125, 50.0f, 3000, 0.75f, 52.5f };
+
+    // id, health, armor, speed, bite damage, bite interval, half width, bite offset, bite shrink
+    r.zombie(SimZombieKind::NORMAL)       = { "normal",     200,  0,    20.0f, 10.0f,   0.5f,  62.5f,   40.0f,  100.0f };
+    r.zombie(SimZombieKind::FLAG)         = { "flag",       200,  0,    20.0f, 10.0f,   0.5f,  104.0f,  120.0f, 200.0f };
+    r.zombie(SimZombieKind::POLE_VAULTER) = { "pole",       200,  0,    20.0f, 10.0f,   0.5f,  56.25f,  40.0f,  100.0f };
+    r.zombie(SimZombieKind::BUCKET_HEAD)  = { "bucket",     200,  1000, 20.0f, 10.0f,   0.5f,  62.5f,   40.0f,  100.0f };
+    r.zombie(SimZombieKind::ZOMBONI)      = { "zomboni",    1300, 0,    20.0f, 10000.0f, 0.0f, 105.75f, 40.0f,  100.0f };
+    r.zombie(SimZombieKind::GARGANTUAR)   = { "gargantuar", 3000, 0,    20.0f, 1000.0f, 2.64f, 140.0f,  60.0f,  180.0f };
+    r.zombie(SimZombieKind::IMP)          = { "imp",        100,  0,    40.0f, 10.0f,   0.5f,  50.0f,   40.0f,  100.0f };
+
+    r.pea_speed = 400.0f;
+    r.pea_damage = 20;
+    r.pea_half_width = 14.0f;
+    r.puff_speed = 300.0f;
+    r.puff_damage = 20;
+    r.puff_lifetime = 1.3f;
+    r.puff_half_width = 9.5f;
+
+    r.sky_sun_value = 25;
+    r.sky_sun_interval = 5.0f;
+
+    return r;
+}
+
+// ----------------------------------------------------
+// Name lookup
+// ----------------------------------------------------
+const char* SimRules::plantId(PlantName name)
+{
+    static const SimRules table = SimRules::defaults();
+    int index = static_cast<int>(name);
+    if (index < 0 || index >= SIM_PLANT_KIND_COUNT) return "unknown";
+    return table.plants[index].id;
+}
+
+PlantName SimRules::parsePlantName(const std::string& id)
+{
+    for (int i = 0; i < SIM_PLANT_KIND_COUNT; ++i)
+    {
+        PlantName name = static_cast<PlantName>(i);
+        if (id == plantId(name)) return name;
+    }
+    return PlantName::UNKNOWN;
+}
+
+const char* SimRules::zombieId(SimZombieKind kind)
+{
+    static const SimRules table = SimRules::defaults();
+    int index = static_cast<int>(kind);
+    if (index < 0 || index >= SIM_ZOMBIE_KIND_COUNT) return "unknown";
+    return table.zombies[index].id;
+}
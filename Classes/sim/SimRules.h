@@ -0,0 +1,83 @@
+#pragma once
+
+#include "GameTypes.h"
+#include "SimTypes.h"
+#include <string>
+
+const int SIM_PLANT_KIND_COUNT = static_cast<int>(PlantName::UNKNOWN);
+const int SIM_ZOMBIE_KIND_COUNT = static_cast<int>(SimZombieKind::COUNT);
+
+/**
+ * @struct SimPlantRules
+ * @brief Tunable numbers of one plant species.
+ * Defaults mirror SeedPacket::CONFIG_TABLE and the plant classes.
+ */
+struct SimPlantRules
+{
+    const char* id;         // Command-line name, e.g. "peashooter"
+    int sun_cost;
+    float packet_cooldown;
+    int max_health;
+    float interval;         // Fire / produce / fuse interval in seconds
+    float half_width;       // Half of the sprite frame width (bounding box)
+};
+
+/**
+ * @struct SimZombieRules
+ * @brief Tunable numbers of one zombie species.
+ * Defaults mirror the zombie classes; extents mirror the sprite frames used for bounding boxes.
+ */
+struct SimZombieRules
+{
+    const char* id;
+    int health;
+    int armor;
+    float speed;
+    float bite_damage;
+    float bite_interval;
+    float half_width;       // Half of the bounding box width
+    float bite_offset;      // X_CORRECTION applied to the box when looking for plants
+    float bite_shrink;      // SIZE_CORRECTION applied to the box when looking for plants
+};
+
+/**
+ * @brief Rule tables of the headless simulator.
+ * A plain value so a balance run can copy the defaults and override single numbers.
+ */
+class SimRules
+{
+public:
+    /** @brief Rules matching the shipped game */
+    static SimRules defaults();
+
+    const SimPlantRules& plant(PlantName name) const { return plants[static_cast<int>(name)]; }
+    SimPlantRules& plant(PlantName name) { return plants[static_cast<int>(name)]; }
+
+    const SimZombieRules& zombie(SimZombieKind kind) const { return zombies[static_cast<int>(kind)]; }
+    SimZombieRules& zombie(SimZombieKind kind) { return zombies[static_cast<int>(kind)]; }
+
+    /** @brief Short lowercase name of a plant ("unknown" for PlantName::UNKNOWN) */
+    static const char* plantId(PlantName name);
+
+    /** @brief Inverse of plantId(); returns PlantName::UNKNOWN for unknown names */
+    static PlantName parsePlantName(const std::string& id);
+
+    /** @brief Short lowercase name of a zombie kind */
+    static const char* zombieId(SimZombieKind kind);
+
+    SimPlantRules plants[SIM_PLANT_KIND_COUNT];
+    SimZombieRules zombies[SIM_ZOMBIE_KIND_COUNT];
+
+    // Projectiles
+    float pea_speed;
+    int pea_damage;
+    float pea_half_width;
+    float puff_speed;
+    int puff_damage;
+    float puff_lifetime;
+    float puff_half_width;
+
+    // Economy
+    int sky_sun_value;
+    float sky_sun_interval;
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "GameTypes.h"
+#include <cstdint>
+
+/**
+ * @file SimTypes.h
+ * @brief Plain-data entities used by the headless simulator.
+ * Positions are in the same world coordinates as the game (x only; rows are discrete).
+ */
+
+/** @brief Zombie species known to the simulator */
+enum class SimZombieKind
+{
+    NORMAL,
+    FLAG,
+    POLE_VAULTER,
+    BUCKET_HEAD,
+    ZOMBONI,
+    GARGANTUAR,
+    IMP,
+    COUNT
+};
+
+/** @brief Behaviour state of a simulated zombie (mirrors the per-class ZombieState values) */
+enum class SimZombieState
+{
+    WALKING,
+    EATING,
+    RUNNING,    // Pole vaulter before the jump
+    JUMPING,    // Pole vaulter jump animation
+    THROWING,   // Gargantuar throwing its imp
+    FLYING,     // Imp in the air
+    DYING,      // Death animation, still counts as present
+    DEAD
+};
+
+/** @brief Final state of a simulated level */
+enum class SimOutcome
+{
+    RUNNING,
+    WIN,
+    LOSE,
+    TIMEOUT
+};
+
+/**
+ * @struct SimPlant
+ * @brief One grid cell. name == PlantName::UNKNOWN means the cell is empty.
+ */
+struct SimPlant
+{
+    PlantName name;
+    int health;
+    float x;                // Same x the game places the sprite at
+    float accumulated_time; // Cooldown timer, Plant::accumulated_time
+    float age;              // Time since planted (arming, growth, fuses)
+    bool exploded;          // Bombs and mines: damage already dealt
+
+    bool isEmpty() const { return name == PlantName::UNKNOWN; }
+};
+
+/** @struct SimZombie */
+struct SimZombie
+{
+    uint32_t id;
+    SimZombieKind kind;
+    SimZombieState state;
+    float x;
+    int health;
+    int armor;              // Bucket health, absorbed before health
+    float speed;
+    float accumulated_time; // Bite timer
+    float state_time;       // Time spent in timed states (jump, throw, fly, dying)
+    float ice_accumulate;   // Zomboni distance since the last ice slice
+    int target_col;         // Column of the plant being eaten, -1 when none
+    bool has_jumped;
+    bool has_thrown;
+    bool spiked;            // Zomboni already popped by spikes
+
+    /** @brief Still on the lawn and able to act (dying zombies are not targetable) */
+    bool isActive() const { return state != SimZombieState::DYING && state != SimZombieState::DEAD; }
+
+    /** @brief Counts as present for the victory check (matches !Zombie::isDead()) */
+    bool isPresent() const { return state != SimZombieState::DEAD; }
+};
+
+/** @struct SimBullet */
+struct SimBullet
+{
+    float x;
+    float speed;
+    int damage;
+    float life_time;
+    float max_life;         // <= 0 for unlimited range (peas)
+    bool active;
+};
+
+/** @struct SimSun */
+struct SimSun
+{
+    float collect_at;       // Level time at which the sun value is credited
+    int value;
+};
+
+/** @struct SimIceCell */
+struct SimIceCell
+{
+    float expire_at;        // Level time the ice melts, 0 when the cell is clear
+};
+
+/**
+ * @struct SimStats
+ * @brief Counters accumulated over one simulated level.
+ */
+struct SimStats
+{
+    int zombies_spawned;
+    int zombies_killed;
+    int plants_placed;
+    int plants_lost;
+    int sun_collected;
+    int sun_spent;
+    int mowers_triggered;
+    int peak_zombies;
+    long bullets_fired;
+    long bullet_hits;
+};
+
+/**
+ * @struct SimResult
+ * @brief Outcome and counters of a finished (or aborted) simulation.
+ */
+struct SimResult
+{
+    SimOutcome outcome;
+    float sim_time_sec;
+    long steps;
+    SimStats stats;
+};
@@ -0,0 +1,1019 @@
+#include "SimWorld.h"
+#include "SimPlayer.h"
+#include "JobPool.h"
+#include <algorithm>
+
+// ----------------------------------------------------
+// Static constant definitions
+// ----------------------------------------------------
+namespace
+{
+    const float VISIBLE_WIDTH = 1280.0f;            // Design resolution width
+    const float ZOMBIE_SPAWN_X = VISIBLE_WIDTH + 10.0f;
+    const float BULLET_OFF_SCREEN_X = VISIBLE_WIDTH + 50.0f;
+    const float COLLISION_PRECHECK = 60.0f;         // GameWorld::updateBullets quick x test
+
+    const float MOWER_START_X = -20.0f;
+    const float MOWER_HALF_WIDTH = 35.0f;
+    const float MOWER_SPEED = 900.0f;
+    const float MOWER_REMOVE_X = VISIBLE_WIDTH + 100.0f;
+    const int MOWER_DAMAGE = 99999;
+
+    const float DEATH_FADE_TIME = 0.5f;
+    const float ZOMBONI_SPECIAL_DEATH_TIME = 12 * 0.08f + DEATH_FADE_TIME;
+
+    const float POLE_RUN_SPEED = 40.0f;
+    const float POLE_RUN_HALF_WIDTH = 168.75f;      // 375 px frame at 0.9 scale
+    const float POLE_RUN_X_CORRECTION = 110.0f;
+    const float POLE_RUN_SIZE_CORRECTION = 160.0f;
+    const float POLE_JUMP_TIME = 42 * 0.03f;
+    const float POLE_JUMP_DISTANCE = 170.0f;
+
+    const float GARGANTUAR_THROW_HEALTH = 1500.0f;
+    const float GARGANTUAR_THROW_MIN_X = 500.0f;
+    const float GARGANTUAR_PRETHROW_TIME = 2.4f;
+    const float GARGANTUAR_POSTTHROW_TIME = 0.56f;
+    const float IMP_THROW_OFFSET = 250.0f;
+    const float IMP_FLY_TIME = 1.38f;
+    const float IMP_FLY_SPEED = 120.0f;
+
+    const float ZOMBONI_ICE_STEP = 10.0f;
+
+    // Bullets plus zombies on the lawn below which forEachRow stays on the calling thread.
+    // Waking the pool and waiting for it costs microseconds, far more than a typical step
+    const int ROW_JOB_MIN_ENTITIES = 256;
+    const float ICE_LIFETIME = 60.0f;
+    const int ZOMBONI_SPIKE_DAMAGE = 1000;
+
+    const float SPIKE_X_CORRECTION = 45.0f;
+    const float SPIKE_SIZE_CORRECTION = 90.0f;
+    const int SPIKE_DAMAGE = 20;
+
+    const float POTATO_ARM_TIME = 12.0f;
+    const int POTATO_DAMAGE = 1800;
+    const int CHERRY_DAMAGE = 1500;
+    const int JALAPENO_DAMAGE = 1500;
+
+    const int PUFFSHROOM_RANGE_CELLS = 3;
+    const float SUNSHROOM_GROW_TIME = 25.0f;
+    const int SUNSHROOM_SMALL_VALUE = 15;
+    const int SUN_VALUE = 25;
+
+    SimZombieKind zombieKindOf(WaveZombie type)
+    {
+        switch (type)
+        {
+            case WaveZombie::POLE_VAULTER: return SimZombieKind::POLE_VAULTER;
+            case WaveZombie::BUCKET_HEAD:  return SimZombieKind::BUCKET_HEAD;
+            case WaveZombie::ZOMBONI:      return SimZombieKind::ZOMBONI;
+            case WaveZombie::GARGANTUAR:   return SimZombieKind::GARGANTUAR;
+            case WaveZombie::FLAG:         return SimZombieKind::FLAG;
+            default:                       return SimZombieKind::NORMAL;
+        }
+    }
+
+    bool overlaps(float aMin, float aMax, float bMin, float bMax)
+    {
+        return !(aMax < bMin || bMax < aMin);
+    }
+
+    bool isMushroom(PlantName name)
+    {
+        return name == PlantName::SUNSHROOM || name == PlantName::PUFFSHROOM;
+    }
+
+    bool isSpike(PlantName name)
+    {
+        return name == PlantName::SPIKEWEED || name == PlantName::SPIKEROCK;
+    }
+
+    /** @brief Base plant an upgrade packet must be planted on, UNKNOWN for regular plants */
+    PlantName upgradeBase(PlantName name)
+    {
+        switch (name)
+        {
+            case PlantName::TWINSUNFLOWER: return PlantName::SUNFLOWER;
+            case PlantName::GATLINGPEA:    return PlantName::REPEATER;
+            case PlantName::SPIKEROCK:     return PlantName::SPIKEWEED;
+            default:                       return PlantName::UNKNOWN;
+        }
+    }
+
+    SimPlant emptyPlant()
+    {
+        SimPlant p = { PlantName::UNKNOWN, 0, 0.0f, 0.0f, 0.0f, false };
+        return p;
+    }
+}
+
+SimConfig::SimConfig()
+    : seed(1)
+    , dt(1.0f / 60.0f)
+    , night_mode(false)
+    , mowers(true)
+    , max_time_sec(600.0f)
+    , sun_collect_delay_sec(1.0f)
+    , initial_sun(200)
+    , threads(1)
+    , rules(SimRules::defaults())
+    , waves(WaveRules::defaults())
+{
+}
+
+SimWorld::SimWorld(const SimConfig& cfg)
+    : config(cfg)
+    , planner(cfg.night_mode, cfg.waves)
+    , rng(cfg.seed)
+{
+    if (config.threads > 1)
+    {
+        jobs.reset(new JobPool(std::min(config.threads, MAX_ROW)));
+    }
+    reset();
+}
+
+SimWorld::~SimWorld()
+{
+}
+
+void SimWorld::reset()
+{
+    rng = SimRandom(config.seed);
+    planner = WavePlanner(config.night_mode, config.waves);
+
+    elapsed_time = 0.0f;
+    steps = 0;
+    sun_count = config.initial_sun;
+    outcome = SimOutcome::RUNNING;
+    stats = SimStats();
+
+    schedule.build(planner, rng);
+    final_wave_triggered = false;
+    sun_spawn_timer = 0.0f;
+    next_zombie_id = 1;
+
+    for (int i = 0; i < SIM_PLANT_KIND_COUNT; ++i) packet_cooldown[i] = -1.0f;
+    for (auto name : config.loadout)
+    {
+        if (name != PlantName::UNKNOWN) packet_cooldown[static_cast<int>(name)] = 0.0f;   // Packets start ready
+    }
+
+    for (int row = 0; row < MAX_ROW; ++row)
+    {
+        for (int col = 0; col < MAX_COL; ++col)
+        {
+            grid[row][col] = emptyPlant();
+            ice[row][col].expire_at = 0.0f;
+        }
+        zombies[row].clear();
+        bullets[row].clear();
+        mowers[row].x = MOWER_START_X;
+        mowers[row].present = config.mowers;
+        mowers[row].moving = false;
+    }
+    spawned.clear();
+    suns.clear();
+}
+
+// ----------------------------------------------------
+// Main loop
+// ----------------------------------------------------
+bool SimWorld::step()
+{
+    if (outcome != SimOutcome::RUNNING) return false;
+
+    const float delta = config.dt;
+    elapsed_time += delta;
+    ++steps;
+
+    for (int i = 0; i < SIM_PLANT_KIND_COUNT; ++i)
+    {
+        if (packet_cooldown[i] > 0.0f) packet_cooldown[i] = std::max(0.0f, packet_cooldown[i] - delta);
+    }
+
+    updateWaves();
+    updateSkySun(delta);
+    updatePlants(delta);
+    updateBullets(delta);
+    updateZombies(delta);
+    if (outcome != SimOutcome::RUNNING) return true;
+    updateSuns();
+    updateIce();
+
+    removeDeadPlants();
+    removeDeadZombies();
+    checkVictory();
+
+    if (outcome == SimOutcome::RUNNING && elapsed_time >= config.max_time_sec)
+    {
+        outcome = SimOutcome::TIMEOUT;
+    }
+    return true;
+}
+
+SimResult SimWorld::run(SimPlayer* player)
+{
+    while (outcome == SimOutcome::RUNNING)
+    {
+        if (player) player->act(*this);
+        step();
+    }
+
+    SimResult result;
+    result.outcome = outcome;
+    result.sim_time_sec = elapsed_time;
+    result.steps = steps;
+    result.stats = stats;
+    return result;
+}
+
+// ----------------------------------------------------
+// Player actions
+// ----------------------------------------------------
+bool SimWorld::hasPacket(PlantName name) const
+{
+    if (name == PlantName::UNKNOWN) return false;
+    return packet_cooldown[static_cast<int>(name)] >= 0.0f;
+}
+
+bool SimWorld::isPacketReady(PlantName name) const
+{
+    if (!hasPacket(name)) return false;
+    const SimPlantRules& rules = config.rules.plant(name);
+    return packet_cooldown[static_cast<int>(name)] <= 0.0f && sun_count >= rules.sun_cost;
+}
+
+bool SimWorld::canPlant(PlantName name, int row, int col) const
+{
+    if (row < 0 || row >= MAX_ROW || col < 0 || col >= MAX_COL) return false;
+    if (!isPacketReady(name)) return false;
+    if (hasIceAt(row, col)) return false;
+
+    const SimPlant& current = grid[row][col];
+    PlantName base = upgradeBase(name);
+    if (base != PlantName::UNKNOWN)
+    {
+        return current.name == base && current.health > 0;
+    }
+    return current.isEmpty();
+}
+
+bool SimWorld::plant(PlantName name, int row, int col)
+{
+    if (!canPlant(name, row, col)) return false;
+
+    const SimPlantRules& rules = config.rules.plant(name);
+    sun_count -= rules.sun_cost;
+    stats.sun_spent += rules.sun_cost;
+    packet_cooldown[static_cast<int>(name)] = rules.packet_cooldown;
+
+    SimPlant& p = grid[row][col];
+    p = emptyPlant();
+    p.name = name;
+    p.health = rules.max_health;
+    p.x = plantX(col);
+    ++stats.plants_placed;
+    return true;
+}
+
+bool SimWorld::hasIceAt(int row, int col) const
+{
+    return ice[row][col].expire_at > elapsed_time;
+}
+
+int SimWorld::columnAt(float x)
+{
+    float local = x - GRID_ORIGIN_X;
+    if (local < 0.0f) return -1;
+    int col = static_cast<int>(local / GRID_CELL_WIDTH);
+    return col < MAX_COL ? col : -1;
+}
+
+float SimWorld::plantX(int col)
+{
+    return GRID_ORIGIN_X + col * GRID_CELL_WIDTH + GRID_CELL_WIDTH * 0.5f + 30.0f;
+}
+
+// ----------------------------------------------------
+// Waves and sun
+// ----------------------------------------------------
+void SimWorld::updateWaves()
+{
+    if (!final_wave_triggered && elapsed_time >= schedule.getFinalWaveTime())
+    {
+        final_wave_triggered = true;
+    }
+
+    // Release due zombies in schedule order, like GameWorld::releaseScheduledSpawns
+    while (const WaveSpawn* spawn = schedule.popDue(elapsed_time))
+    {
+        spawnZombie(zombieKindOf(spawn->type), spawn->row, ZOMBIE_SPAWN_X);
+    }
+
+    for (auto& s : spawned) zombies[s.row].push_back(s.zombie);
+    spawned.clear();
+}
+
+void SimWorld::updateSkySun(float delta)
+{
+    if (config.night_mode) return;
+
+    sun_spawn_timer += delta;
+    if (sun_spawn_timer >= config.rules.sky_sun_interval)
+    {
+        produceSun(config.rules.sky_sun_value, 1);
+        sun_spawn_timer = 0.0f;
+    }
+}
+
+void SimWorld::produceSun(int value, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        SimSun sun = { elapsed_time + config.sun_collect_delay_sec, value };
+        suns.push_back(sun);
+    }
+}
+
+void SimWorld::updateSuns()
+{
+    for (size_t i = 0; i < suns.size();)
+    {
+        if (suns[i].collect_at <= elapsed_time)
+        {
+            sun_count += suns[i].value;
+            stats.sun_collected += suns[i].value;
+            suns[i] = suns.back();
+            suns.pop_back();
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+// ----------------------------------------------------
+// Plants
+// ----------------------------------------------------
+void SimWorld::updatePlants(float delta)
+{
+    for (int row = 0; row < MAX_ROW; ++row)
+    {
+        for (int col = 0; col < MAX_COL; ++col)
+        {
+            SimPlant& p = grid[row][col];
+            if (p.isEmpty() || p.health <= 0) continue;
+
+            p.age += delta;
+
+            // Mushrooms sleep during the day
+            if (isMushroom(p.name) && !config.night_mode) continue;
+
+            p.accumulated_time += delta;
+            const SimPlantRules& rules = config.rules.plant(p.name);
+
+            switch (p.name)
+            {
+                case PlantName::SUNFLOWER:
+                case PlantName::TWINSUNFLOWER:
+                    if (p.accumulated_time >= rules.interval)
+                    {
+                        p.accumulated_time = 0.0f;
+                        produceSun(SUN_VALUE, p.name == PlantName::TWINSUNFLOWER ? 2 : 1);
+                    }
+                    break;
+
+                case PlantName::SUNSHROOM:
+                    if (p.accumulated_time >= rules.interval)
+                    {
+                        p.accumulated_time = 0.0f;
+                        produceSun(p.age < SUNSHROOM_GROW_TIME ? SUNSHROOM_SMALL_VALUE : SUN_VALUE, 1);
+                    }
+                    break;
+
+                case PlantName::PEASHOOTER:
+                case PlantName::REPEATER:
+                case PlantName::THREEPEATER:
+                case PlantName::GATLINGPEA:
+                case PlantName::PUFFSHROOM:
+                    fireAttackingPlant(p, row);
+                    break;
+
+                case PlantName::SPIKEWEED:
+                case PlantName::SPIKEROCK:
+                    updateSpikes(p, row);
+                    break;
+
+                case PlantName::POTATOMINE:
+                    updatePotatoMine(p, row);
+                    break;
+
+                case PlantName::CHERRYBOMB:
+                    if (p.age >= rules.interval) explodeCherryBomb(p, row, col);
+                    break;
+
+                case PlantName::JALAPENO:
+                    if (p.age >= rules.interval) explodeJalapeno(p, row);
+                    break;
+
+                default:
+                    break;
+            }
+        }
+    }
+}
+
+bool SimWorld::zombieToTheRight(int row, float x, float maxX) const
+{
+    if (row < 0 || row >= MAX_ROW) return false;
+    for (const auto& z : zombies[row])
+    {
+        if (z.isPresent() && z.x > x && z.x <= maxX) return true;
+    }
+    return false;
+}
+
+void SimWorld::firePeas(int row, float x, const float* offsets, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        SimBullet pea = { x + offsets[i], config.rules.pea_speed, config.rules.pea_damage, 0.0f, 0.0f, true };
+        bullets[row].push_back(pea);
+        ++stats.bullets_fired;
+    }
+}
+
+void SimWorld::fireAttackingPlant(SimPlant& p, int row)
+{
+    static const float SINGLE[] = { 30.0f };
+    static const float DOUBLE[] = { 30.0f, 70.0f };
+    static const float GATLING[] = { 30.0f, 50.0f, 70.0f, 90.0f };
+
+    const SimPlantRules& rules = config.rules.plant(p.name);
+    const float unlimited = 1e9f;
+
+    if (p.name == PlantName::THREEPEATER)
+    {
+        bool inRange = false;
+        for (int r = row - 1; r <= row + 1 && !inRange; ++r) inRange = zombieToTheRight(r, p.x, unlimited);
+        if (!inRange || p.accumulated_time < rules.interval) return;
+        p.accumulated_time = 0.0f;
+        for (int r = row - 1; r <= row + 1; ++r)
+        {
+            if (r >= 0 && r < MAX_ROW) firePeas(r, p.x, SINGLE, 1);
+        }
+        return;
+    }
+
+    if (p.name == PlantName::PUFFSHROOM)
+    {
+        float maxX = p.x + GRID_CELL_WIDTH * PUFFSHROOM_RANGE_CELLS;
+        if (!zombieToTheRight(row, p.x, maxX) || p.accumulated_time < rules.interval) return;
+        p.accumulated_time = 0.0f;
+        SimBullet puff = { p.x + 30.0f, config.rules.puff_speed, config.rules.puff_damage, 0.0f, config.rules.puff_lifetime, true };
+        bullets[row].push_back(puff);
+        ++stats.bullets_fired;
+        return;
+    }
+
+    if (!zombieToTheRight(row, p.x, unlimited) || p.accumulated_time < rules.interval) return;
+    p.accumulated_time = 0.0f;
+
+    if (p.name == PlantName::REPEATER) firePeas(row, p.x, DOUBLE, 2);
+    else if (p.name == PlantName::GATLINGPEA) firePeas(row, p.x, GATLING, 4);
+    else firePeas(row, p.x, SINGLE, 1);
+}
+
+void SimWorld::updateSpikes(SimPlant& p, int row)
+{
+    const SimPlantRules& rules = config.rules.plant(p.name);
+    float spikeMin = p.x - rules.half_width + SPIKE_X_CORRECTION;
+    float spikeMax = spikeMin + rules.half_width * 2.0f - SPIKE_SIZE_CORRECTION;
+
+    // Like SpikeWeed::checkAndAttack, nothing is touched until the cooldown is ready
+    if (p.accumulated_time < rules.interval) return;
+    p.accumulated_time = 0.0f;
+
+    for (auto& z : zombies[row])
+    {
+        if (!z.isActive()) continue;
+        float hw = zombieHalfWidth(z);
+        if (!overlaps(z.x - hw, z.x + hw, spikeMin, spikeMax)) continue;
+
+        if (z.kind == SimZombieKind::ZOMBONI && !z.spiked)
+        {
+            // Zomboni pops on spikes and damages them
+            z.spiked = true;
+            z.health = 0;
+            z.state = SimZombieState::DYING;
+            z.state_time = 0.0f;
+            p.health -= ZOMBONI_SPIKE_DAMAGE;
+            continue;
+        }
+        damageZombie(z, SPIKE_DAMAGE);
+    }
+}
+
+void SimWorld::updatePotatoMine(SimPlant& p, int row)
+{
+    if (p.exploded || p.age < POTATO_ARM_TIME) return;
+
+    const SimPlantRules& rules = config.rules.plant(p.name);
+    float mineMin = p.x - rules.half_width;
+    float mineMax = p.x + rules.half_width;
+
+    bool triggered = false;
+    for (const auto& z : zombies[row])
+    {
+        float hw = zombieHalfWidth(z);
+        if (z.isActive() && overlaps(z.x - hw, z.x + hw, mineMin, mineMax)) { triggered = true; break; }
+    }
+    if (!triggered) return;
+
+    for (auto& z : zombies[row])
+    {
+        float hw = zombieHalfWidth(z);
+        if (z.isActive() && overlaps(z.x - hw, z.x + hw, mineMin, mineMax)) damageZombie(z, POTATO_DAMAGE);
+    }
+    p.exploded = true;
+    p.health = 0;
+}
+
+void SimWorld::explodeCherryBomb(SimPlant& p, int row, int col)
+{
+    if (p.exploded) return;
+    for (int r = std::max(0, row - 1); r <= std::min(MAX_ROW - 1, row + 1); ++r)
+    {
+        for (auto& z : zombies[r])
+        {
+            if (!z.isActive()) continue;
+            int zc = columnAt(z.x);
+            if (zc >= col - 1 && zc <= col + 1) damageZombie(z, CHERRY_DAMAGE);
+        }
+    }
+    p.exploded = true;
+    p.health = 0;
+}
+
+void SimWorld::explodeJalapeno(SimPlant& p, int row)
+{
+    if (p.exploded) return;
+    for (auto& z : zombies[row])
+    {
+        if (z.isActive()) damageZombie(z, JALAPENO_DAMAGE);
+    }
+    for (int col = 0; col < MAX_COL; ++col) ice[row][col].expire_at = 0.0f;
+    p.exploded = true;
+    p.health = 0;
+}
+
+// ----------------------------------------------------
+// Bullets
+// ----------------------------------------------------
+void SimWorld::forEachRow(const std::function<void(int)>& job)
+{
+    size_t entities = 0;
+    if (jobs)
+    {
+        for (int row = 0; row < MAX_ROW; ++row)
+        {
+            entities += zombies[row].size() + bullets[row].size();
+        }
+    }
+
+    if (entities >= static_cast<size_t>(ROW_JOB_MIN_ENTITIES))
+    {
+        jobs->parallelFor(MAX_ROW, job);
+    }
+    else
+    {
+        for (int row = 0; row < MAX_ROW; ++row) job(row);
+    }
+}
+
+void SimWorld::updateBullets(float delta)
+{
+    forEachRow([this, delta](int row) {
+        RowResult& out = row_results[row];
+        out.bullet_hits = 0;
+        updateBulletRow(row, delta, out);
+    });
+
+    for (int row = 0; row < MAX_ROW; ++row)
+    {
+        stats.bullet_hits += row_results[row].bullet_hits;
+    }
+}
+
+void SimWorld::updateBulletRow(int row, float delta, RowResult& out)
+{
+    auto& rowBullets = bullets[row];
+    for (auto& b : rowBullets)
+    {
+        if (!b.active) continue;
+
+        b.x += b.speed * delta;
+        b.life_time += delta;
+        bool isPuff = b.max_life > 0.0f;
+        if ((isPuff && b.life_time >= b.max_life) || b.x > BULLET_OFF_SCREEN_X)
+        {
+            b.active = false;
+            continue;
+        }
+
+        float bhw = isPuff ? config.rules.puff_half_width : config.rules.pea_half_width;
+        for (auto& z : zombies[row])
+        {
+            if (!z.isActive()) continue;
+            if (!(b.x < z.x + COLLISION_PRECHECK && b.x > z.x - COLLISION_PRECHECK)) continue;
+
+            float zhw = zombieHalfWidth(z);
+            if (overlaps(b.x - bhw, b.x + bhw, z.x - zhw, z.x + zhw))
+            {
+                damageZombie(z, b.damage);
+                b.active = false;
+                ++out.bullet_hits;
+                break;
+            }
+        }
+    }
+
+    rowBullets.erase(std::remove_if(rowBullets.begin(), rowBullets.end(),
+        [](const SimBullet& b) { return !b.active; }), rowBullets.end());
+}
+
+// ----------------------------------------------------
+// Zombies
+// ----------------------------------------------------
+SimZombie SimWorld::makeZombie(SimZombieKind kind, float x) const
+{
+    const SimZombieRules& rules = config.rules.zombie(kind);
+
+    SimZombie z;
+    z.id = 0;
+    z.kind = kind;
+    z.state = SimZombieState::WALKING;
+    z.x = x;
+    z.health = rules.health;
+    z.armor = rules.armor;
+    z.speed = rules.speed;
+    z.accumulated_time = 0.0f;
+    z.state_time = 0.0f;
+    z.ice_accumulate = 0.0f;
+    z.target_col = -1;
+    z.has_jumped = false;
+    z.has_thrown = false;
+    z.spiked = false;
+
+    if (kind == SimZombieKind::POLE_VAULTER)
+    {
+        z.state = SimZombieState::RUNNING;
+        z.speed = POLE_RUN_SPEED;
+    }
+    else if (kind == SimZombieKind::IMP)
+    {
+        z.state = SimZombieState::FLYING;
+    }
+    return z;
+}
+
+void SimWorld::spawnZombie(SimZombieKind kind, int row, float x)
+{
+    SimZombie z = makeZombie(kind, x);
+    z.id = next_zombie_id++;
+
+    SpawnedZombie s = { row, z };
+    spawned.push_back(s);
+    ++stats.zombies_spawned;
+}
+
+void SimWorld::damageZombie(SimZombie& z, int damage)
+{
+    if (!z.isActive()) return;
+
+    if (z.armor > 0)
+    {
+        int absorbed = std::min(z.armor, damage);
+        z.armor -= absorbed;
+        damage -= absorbed;
+    }
+    z.health -= damage;
+
+    if (z.health <= 0)
+    {
+        z.health = 0;
+        z.state = SimZombieState::DYING;
+        z.state_time = 0.0f;
+    }
+}
+
+float SimWorld::zombieHalfWidth(const SimZombie& z) const
+{
+    if (z.kind == SimZombieKind::POLE_VAULTER && !z.has_jumped) return POLE_RUN_HALF_WIDTH;
+    return config.rules.zombie(z.kind).half_width;
+}
+
+int SimWorld::findBiteTarget(const SimZombie& z, int row, bool includeSpikes) const
+{
+    const SimZombieRules& rules = config.rules.zombie(z.kind);
+    float hw = zombieHalfWidth(z);
+    float offset = rules.bite_offset;
+    float shrink = rules.bite_shrink;
+    if (z.kind == SimZombieKind::POLE_VAULTER && !z.has_jumped)
+    {
+        offset = POLE_RUN_X_CORRECTION;
+        shrink = POLE_RUN_SIZE_CORRECTION;
+    }
+    float biteMin = z.x - hw + offset;
+    float biteMax = biteMin + hw * 2.0f - shrink;
+
+    for (int col = 0; col < MAX_COL; ++col)
+    {
+        const SimPlant& p = grid[row][col];
+        if (p.isEmpty() || p.health <= 0) continue;
+        if (!includeSpikes && isSpike(p.name)) continue;
+
+        float phw = config.rules.plant(p.name).half_width;
+        if (overlaps(biteMin, biteMax, p.x - phw, p.x + phw)) return col;
+    }
+    return -1;
+}
+
+void SimWorld::layIce(SimZombie& z, int row, float distance)
+{
+    z.ice_accumulate += distance;
+    while (z.ice_accumulate >= ZOMBONI_ICE_STEP)
+    {
+        z.ice_accumulate -= ZOMBONI_ICE_STEP;
+        int col = columnAt(z.x);
+        if (col >= 0) ice[row][col].expire_at = elapsed_time + ICE_LIFETIME;
+    }
+}
+
+void SimWorld::updateZombie(SimZombie& z, int row, float delta, RowResult& out)
+{
+    const SimZombieRules& rules = config.rules.zombie(z.kind);
+
+    switch (z.state)
+    {
+        case SimZombieState::RUNNING:
+        {
+            if (findBiteTarget(z, row, false) >= 0)
+            {
+                z.state = SimZombieState::JUMPING;
+                z.state_time = 0.0f;
+                break;
+            }
+            z.x -= z.speed * delta;
+            break;
+        }
+
+        case SimZombieState::JUMPING:
+        {
+            z.state_time += delta;
+            if (z.state_time >= POLE_JUMP_TIME)
+            {
+                z.x -= POLE_JUMP_DISTANCE;
+                z.has_jumped = true;
+                z.speed = rules.speed;
+                z.state = SimZombieState::WALKING;
+            }
+            break;
+        }
+
+        case SimZombieState::FLYING:
+        {
+            z.state_time += delta;
+            z.x -= IMP_FLY_SPEED * delta;
+            if (z.state_time >= IMP_FLY_TIME)
+            {
+                z.state = SimZombieState::WALKING;
+                z.state_time = 0.0f;
+            }
+            break;
+        }
+
+        case SimZombieState::THROWING:
+        {
+            z.state_time += delta;
+            if (!z.has_thrown && z.state_time >= GARGANTUAR_PRETHROW_TIME)
+            {
+                z.has_thrown = true;
+                out.thrown.push_back(makeZombie(SimZombieKind::IMP, z.x - IMP_THROW_OFFSET));
+            }
+            if (z.state_time >= GARGANTUAR_PRETHROW_TIME + GARGANTUAR_POSTTHROW_TIME)
+            {
+                z.state = SimZombieState::WALKING;
+                z.state_time = 0.0f;
+            }
+            break;
+        }
+
+        case SimZombieState::EATING:
+        {
+            SimPlant* target = z.target_col >= 0 ? &grid[row][z.target_col] : nullptr;
+            if (!target || target->isEmpty() || target->health <= 0)
+            {
+                z.state = SimZombieState::WALKING;
+                z.target_col = -1;
+                break;
+            }
+            z.accumulated_time += delta;
+            if (z.accumulated_time >= rules.bite_interval)
+            {
+                target->health -= static_cast<int>(rules.bite_damage);
+                z.accumulated_time = 0.0f;
+                if (target->health <= 0)
+                {
+                    z.state = SimZombieState::WALKING;
+                    z.target_col = -1;
+                }
+            }
+            break;
+        }
+
+        case SimZombieState::WALKING:
+        {
+            if (z.kind == SimZombieKind::GARGANTUAR && !z.has_thrown
+                && z.health <= GARGANTUAR_THROW_HEALTH && z.x >= GARGANTUAR_THROW_MIN_X)
+            {
+                z.state = SimZombieState::THROWING;
+                z.state_time = 0.0f;
+                break;
+            }
+
+            bool includeSpikes = z.kind == SimZombieKind::GARGANTUAR;
+            int col = findBiteTarget(z, row, includeSpikes);
+            if (z.kind == SimZombieKind::ZOMBONI)
+            {
+                // Zomboni flattens whatever it drives over
+                if (col >= 0) grid[row][col].health = 0;
+            }
+            else if (col >= 0)
+            {
+                z.state = SimZombieState::EATING;
+                z.target_col = col;
+                break;
+            }
+
+            float distance = z.speed * delta;
+            z.x -= distance;
+            if (z.kind == SimZombieKind::ZOMBONI) layIce(z, row, distance);
+            break;
+        }
+
+        case SimZombieState::DYING:
+        {
+            z.state_time += delta;
+            float fade = z.spiked ? ZOMBONI_SPECIAL_DEATH_TIME : DEATH_FADE_TIME;
+            if (z.state_time >= fade) z.state = SimZombieState::DEAD;
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+void SimWorld::updateZombies(float delta)
+{
+    forEachRow([this, delta](int row) {
+        RowResult& out = row_results[row];
+        out.mowers_triggered = 0;
+        out.present = 0;
+        out.lost = false;
+        out.thrown.clear();
+        updateZombieRow(row, delta, out);
+    });
+
+    // Merge in row order, as if the rows had run one after another: ids go to thrown imps in
+    // that order, and a lost level ignores the rows after the one that lost
+    int present = 0;
+    for (int row = 0; row < MAX_ROW; ++row)
+    {
+        RowResult& out = row_results[row];
+        stats.mowers_triggered += out.mowers_triggered;
+        present += out.present;
+        for (auto& imp : out.thrown)
+        {
+            imp.id = next_zombie_id++;
+            SpawnedZombie s = { row, imp };
+            spawned.push_back(s);
+            ++stats.zombies_spawned;
+        }
+
+        if (out.lost)
+        {
+            outcome = SimOutcome::LOSE;
+            return;
+        }
+    }
+    stats.peak_zombies = std::max(stats.peak_zombies, present);
+
+    // Imps thrown during the loop join their row once iteration is over
+    for (auto& s : spawned) zombies[s.row].push_back(s.zombie);
+    spawned.clear();
+}
+
+void SimWorld::updateZombieRow(int row, float delta, RowResult& out)
+{
+    Mower& mower = mowers[row];
+    if (mower.present && mower.moving)
+    {
+        mower.x += MOWER_SPEED * delta;
+        if (mower.x > MOWER_REMOVE_X) mower.present = false;
+    }
+
+    for (auto& z : zombies[row])
+    {
+        if (!z.isPresent()) continue;
+        ++out.present;
+
+        if (z.isActive())
+        {
+            float hw = zombieHalfWidth(z);
+            if (mower.present && overlaps(z.x - hw, z.x + hw, mower.x - MOWER_HALF_WIDTH, mower.x + MOWER_HALF_WIDTH))
+            {
+                if (!mower.moving)
+                {
+                    mower.moving = true;
+                    ++out.mowers_triggered;
+                }
+                else
+                {
+                    damageZombie(z, MOWER_DAMAGE);
+                }
+            }
+
+            if (z.x <= 0.0f)
+            {
+                out.lost = true;
+                return;
+            }
+        }
+
+        updateZombie(z, row, delta, out);
+    }
+}
+
+void SimWorld::updateIce()
+{
+    for (int row = 0; row < MAX_ROW; ++row)
+    {
+        for (int col = 0; col < MAX_COL; ++col)
+        {
+            if (ice[row][col].expire_at > 0.0f && ice[row][col].expire_at <= elapsed_time)
+            {
+                ice[row][col].expire_at = 0.0f;
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------
+// Cleanup
+// ----------------------------------------------------
+void SimWorld::removeDeadPlants()
+{
+    for (int row = 0; row < MAX_ROW; ++row)
+    {
+        for (int col = 0; col < MAX_COL; ++col)
+        {
+            SimPlant& p = grid[row][col];
+            if (!p.isEmpty() && p.health <= 0)
+            {
+                // Bombs remove themselves; everything else was eaten or crushed
+                if (!p.exploded) ++stats.plants_lost;
+                p = emptyPlant();
+            }
+        }
+    }
+}
+
+void SimWorld::removeDeadZombies()
+{
+    for (int row = 0; row < MAX_ROW; ++row)
+    {
+        auto& rowZombies = zombies[row];
+        size_t before = rowZombies.size();
+        rowZombies.erase(std::remove_if(rowZombies.begin(), rowZombies.end(),
+            [](const SimZombie& z) { return z.state == SimZombieState::DEAD; }), rowZombies.end());
+        stats.zombies_killed += static_cast<int>(before - rowZombies.size());
+    }
+}
+
+void SimWorld::checkVictory()
+{
+    if (!final_wave_triggered || elapsed_time < schedule.getSpawningDoneTime()) return;
+    if (!schedule.isExhausted() || !spawned.empty()) return;
+
+    for (int row = 0; row < MAX_ROW; ++row)
+    {
+        for (const auto& z : zombies[row])
+        {
+            if (z.isPresent()) return;
+        }
+    }
+    outcome = SimOutcome::WIN;
+}
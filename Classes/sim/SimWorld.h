@@ -0,0 +1,192 @@
+#pragma once
+
+#include "GameTypes.h"
+#include "SimTypes.h"
+#include "SimRules.h"
+#include "SimRandom.h"
+#include "WavePlanner.h"
+#include "WaveSchedule.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+class SimPlayer;
+class JobPool;
+
+/**
+ * @struct SimConfig
+ * @brief Inputs of one headless run.
+ */
+struct SimConfig
+{
+    SimConfig();
+
+    std::vector<PlantName> loadout;     // Seed packets available to the player
+    uint64_t seed;                      // Seed of every random decision in the level
+    float dt;                           // Fixed timestep in seconds
+    bool night_mode;
+    bool mowers;                        // One lawn mower per row, as in the game
+    float max_time_sec;                 // Abort with SimOutcome::TIMEOUT after this much level time
+    float sun_collect_delay_sec;        // Delay between a sun appearing and being credited
+    int initial_sun;
+    int threads;                        // Threads for the per-row phases; 1 runs them on the calling thread
+    SimRules rules;
+    WaveRules waves;
+};
+
+/**
+ * @brief Headless, fixed-timestep version of the GameWorld rules.
+ *
+ * One step() runs the same phases, in the same order, as GameWorld::update:
+ * wave scheduling, sky suns, plants, bullets, zombies, suns, ice, then cleanup and
+ * the victory check. Entities are plain structs stored per row; there is no scene graph,
+ * no rendering and no audio, so a full level runs in milliseconds.
+ *
+ * Bullets and zombies only ever touch their own row (plants, ice, mower), so those two phases
+ * run one job per row on a JobPool when SimConfig::threads > 1 and the lawn is crowded enough
+ * to pay for the hand-off (ordinary levels stay on the calling thread). Each row writes its counters
+ * and thrown imps to its own RowResult; the merge after the phase folds them in row order and
+ * hands out zombie ids, which keeps every result bit-identical to the single-threaded run.
+ * Cross-row effects (ThreePeater, cherry bomb, jalapeno, sky sun) stay in the serial phases.
+ */
+class SimWorld
+{
+public:
+    explicit SimWorld(const SimConfig& config);
+    ~SimWorld();
+
+    /** @brief Restart the level from the beginning with the configured seed */
+    void reset();
+
+    /**
+     * @brief Advance the level by one fixed timestep.
+     * @return false once the outcome is decided (the step is not run in that case)
+     */
+    bool step();
+
+    /**
+     * @brief Run the level to completion.
+     * @param player Decides what to plant; may be nullptr for a plant-free run
+     */
+    SimResult run(SimPlayer* player);
+
+    // ----------------------------------------------------
+    // Player actions
+    // ----------------------------------------------------
+
+    /** @brief Same rules as GameWorld::tryPlantAtPosition plus the seed packet checks */
+    bool canPlant(PlantName name, int row, int col) const;
+
+    /** @brief Spend sun, start the packet cooldown and place the plant */
+    bool plant(PlantName name, int row, int col);
+
+    // ----------------------------------------------------
+    // Queries
+    // ----------------------------------------------------
+    const SimConfig& getConfig() const { return config; }
+    float getTime() const { return elapsed_time; }
+    long getSteps() const { return steps; }
+    int getSun() const { return sun_count; }
+    SimOutcome getOutcome() const { return outcome; }
+    const SimStats& getStats() const { return stats; }
+
+    bool hasPacket(PlantName name) const;
+    bool isPacketReady(PlantName name) const;
+    bool hasIceAt(int row, int col) const;
+    const SimPlant& plantAt(int row, int col) const { return grid[row][col]; }
+    const std::vector<SimZombie>& zombiesInRow(int row) const { return zombies[row]; }
+
+    /** @brief Column whose cell contains x, or -1 outside the lawn */
+    static int columnAt(float x);
+
+    /** @brief X the game places a plant sprite at for a column */
+    static float plantX(int col);
+
+private:
+    struct SpawnedZombie
+    {
+        int row;
+        SimZombie zombie;
+    };
+
+    struct Mower
+    {
+        float x;
+        bool present;
+        bool moving;
+    };
+
+    /** @brief What one row's bullet or zombie job reports back to the merge */
+    struct RowResult
+    {
+        long bullet_hits;
+        int mowers_triggered;
+        int present;                        // Zombies on the lawn, dying ones included
+        bool lost;                          // A zombie reached the house; the row stopped there
+        std::vector<SimZombie> thrown;      // Imps, without an id until the merge
+    };
+
+    // Phases, in GameWorld::update order
+    void updateWaves();
+    void updateSkySun(float delta);
+    void updatePlants(float delta);
+    void updateBullets(float delta);
+    void updateZombies(float delta);
+    void updateSuns();
+    void updateIce();
+    void removeDeadPlants();
+    void removeDeadZombies();
+    void checkVictory();
+
+    /** @brief Runs job(row) for every row, on the pool when there is one and enough work to share */
+    void forEachRow(const std::function<void(int)>& job);
+    void updateBulletRow(int row, float delta, RowResult& out);
+    void updateZombieRow(int row, float delta, RowResult& out);
+
+    // Plant behaviour
+    bool zombieToTheRight(int row, float x, float maxX) const;
+    void firePeas(int row, float x, const float* offsets, int count);
+    void fireAttackingPlant(SimPlant& p, int row);
+    void updateSpikes(SimPlant& p, int row);
+    void updatePotatoMine(SimPlant& p, int row);
+    void explodeCherryBomb(SimPlant& p, int row, int col);
+    void explodeJalapeno(SimPlant& p, int row);
+    void produceSun(int value, int count);
+
+    // Zombie behaviour
+    SimZombie makeZombie(SimZombieKind kind, float x) const;
+    void spawnZombie(SimZombieKind kind, int row, float x);
+    void damageZombie(SimZombie& z, int damage);
+    void updateZombie(SimZombie& z, int row, float delta, RowResult& out);
+    int findBiteTarget(const SimZombie& z, int row, bool includeSpikes) const;
+    void layIce(SimZombie& z, int row, float distance);
+    float zombieHalfWidth(const SimZombie& z) const;
+
+    SimConfig config;
+    WavePlanner planner;
+    SimRandom rng;
+
+    float elapsed_time;
+    long steps;
+    int sun_count;
+    SimOutcome outcome;
+    SimStats stats;
+
+    WaveSchedule schedule;                          // Every zombie of the level, planned in reset()
+    bool final_wave_triggered;
+    float sun_spawn_timer;
+    uint32_t next_zombie_id;
+
+    float packet_cooldown[SIM_PLANT_KIND_COUNT];    // Remaining cooldown per plant, < 0 when not in the loadout
+
+    SimPlant grid[MAX_ROW][MAX_COL];
+    SimIceCell ice[MAX_ROW][MAX_COL];
+    std::vector<SimZombie> zombies[MAX_ROW];
+    std::vector<SpawnedZombie> spawned;             // Zombies created mid-phase (imps), merged after the phase
+    std::vector<SimBullet> bullets[MAX_ROW];
+    std::vector<SimSun> suns;
+    Mower mowers[MAX_ROW];
+
+    std::unique_ptr<JobPool> jobs;                  // Only when config.threads > 1
+    RowResult row_results[MAX_ROW];
+};
@@ -1,31 +1,16 @@
 
 #include "BucketHeadZombie.h"
+#include "Log.h"
 #include "Plant.h"
 
 USING_NS_CC;
 
-Sprite* BucketHeadZombie::createShowcaseSprite(const Vec2& pos)
-{
-    auto animation = initAnimate("bucket_head_idle_spritesheet.png", 1200.0f, 975.0f, 7, 5, 35, 0.06f);
-    auto animate = Animate::create(animation);
-    auto _idleAction = RepeatForever::create(animate);
-
-    auto sp = Sprite::create();
-    if (sp) {
-        sp->setPosition(pos);
-        sp->setScale(0.2f);
-        sp->runAction(_idleAction);
-    }
-    return sp;
-}
-
-
 // Destructor
 BucketHeadZombie::~BucketHeadZombie()
 {
     CC_SAFE_RELEASE(_walkAction);
     CC_SAFE_RELEASE(_eatAction);
-    CCLOG("Zombie destroyed.");
+    LOG_TRACE(LIFECYCLE, "Zombie destroyed.");
 }
 
 // Initialization function
@@ -37,12 +22,35 @@ bool BucketHeadZombie::init()
         return false;
     }
 
-    // Enable per-frame update
-    this->scheduleUpdate();
-
     return true;
 }
 
+// Sprite sheet slicing
+const AnimationSpec BucketHeadZombie::WALK_ANIMATION = AnimationSpec::grid("bucket_head_walk_spritesheet.png", 125.0f, 173.8f, 5, 10, 46, 0.05f);
+const AnimationSpec BucketHeadZombie::IDLE_ANIMATION = AnimationSpec::grid("bucket_head_idle_spritesheet.png", 1200.0f, 975.0f, 7, 5, 35, 0.06f);
+const AnimationSpec BucketHeadZombie::EAT_ANIMATION = AnimationSpec::grid("bucket_head_eat_spritesheet.png", 125.0f, 173.8f, 4, 10, 39, 0.03f);
+
+std::vector<AnimationSpec> BucketHeadZombie::getAnimationSpecs()
+{
+    return { WALK_ANIMATION, EAT_ANIMATION };
+}
+
+// Warm the shared animations so the first spawn does not slice sheets
+void BucketHeadZombie::preloadAnimations()
+{
+    AnimationLibrary::getInstance()->warm(getAnimationSpecs());
+}
+
+AnimationSpec BucketHeadZombie::getShowcaseSpec()
+{
+    return IDLE_ANIMATION;
+}
+
+Sprite* BucketHeadZombie::createShowcaseSprite(const Vec2& pos)
+{
+    return createLoopingSprite(IDLE_ANIMATION, pos, 0.2f);
+}
+
 // Static factory method to create zombie with animations
 BucketHeadZombie* BucketHeadZombie::createZombie()
 {
@@ -52,17 +60,34 @@ BucketHeadZombie* BucketHeadZombie::createZombie()
         z->autorelease();
         z->initWalkAnimation();
         z->initEatAnimation();
-        z->runAction(z->_walkAction);
+        z->respawn();
         return z;
     }
     delete z;
     return nullptr;
 }
 
+void BucketHeadZombie::respawn()
+{
+    Zombie::respawn();
+    _bucketHealth = 1000;
+
+    // The bucket fell off last time: swap the bare-head cycles back for the bucket ones
+    if (_useNormalZombie)
+    {
+        _useNormalZombie = false;
+        CC_SAFE_RELEASE_NULL(_walkAction);
+        CC_SAFE_RELEASE_NULL(_eatAction);
+        initWalkAnimation();
+        initEatAnimation();
+    }
+    this->runAction(_walkAction);
+}
+
 // Initialize walking animation
 void BucketHeadZombie::initWalkAnimation()
 {
-    auto animation = initAnimate("bucket_head_walk_spritesheet.png", 125.0f, 173.8f, 5, 10, 46, 0.05f);
+    auto animation = initAnimate(WALK_ANIMATION);
     auto animate = Animate::create(animation);
     this->_walkAction = RepeatForever::create(animate);
     _walkAction->retain();
@@ -71,7 +96,7 @@ void BucketHeadZombie::initWalkAnimation()
 // Initialize eating animation
 void BucketHeadZombie::initEatAnimation()
 {
-    auto animation = initAnimate("bucket_head_eat_spritesheet.png", 125.0f, 173.8f, 4, 10, 39, 0.03f);
+    auto animation = initAnimate(EAT_ANIMATION);
     auto animate = Animate::create(animation);
     this->_eatAction = RepeatForever::create(animate);
     _eatAction->retain();
@@ -128,23 +153,22 @@ void BucketHeadZombie::setAnimationForState()
     switch (static_cast<ZombieState>(current_state))
     {
         case ZombieState::WALKING:
-            CCLOG("Setting WALKING animation.");
+            LOG_TRACE(ZOMBIES, "Setting WALKING animation.");
             this->stopAllActions();
             this->runAction(_walkAction);            
             break;
         case ZombieState::EATING:
-            CCLOG("Setting EATING animation.");
+            LOG_TRACE(ZOMBIES, "Setting EATING animation.");
             this->stopAllActions();
             this->runAction(_eatAction);
             break;
         case ZombieState::DYING:
         {
-            CCLOG("Setting DYING animation.");
+            LOG_TRACE(ZOMBIES, "Setting DYING animation.");
             this->stopAllActions();
             auto fadeOut = FadeOut::create(0.5f);
             auto markDead = CallFunc::create([this]() {
-                is_dead = true;
-                _isDying = false;
+                finishDying();
                 });
             auto sequence = Sequence::create(fadeOut, markDead, nullptr);
             this->runAction(sequence);
@@ -175,6 +199,8 @@ void BucketHeadZombie::onBucketBroken()
         frameIndex = animate->getCurrentFrameIndex();
     }
     stopAllActions();
+    CC_SAFE_RELEASE_NULL(_walkAction);
+    CC_SAFE_RELEASE_NULL(_eatAction);
 
     if (_isEating) {
         _walkAction = createNormalWalkActionFromFrame(1);
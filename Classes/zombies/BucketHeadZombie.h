@@ -41,8 +41,25 @@ public:
      */
     static BucketHeadZombie* createZombie();
 
-    // 选卡展示静态图
-    cocos2d::Sprite* createShowcaseSprite(const cocos2d::Vec2& pos) ;
+    /** @brief Sprite sheet slicing of every animation createZombie builds */
+    static std::vector<AnimationSpec> getAnimationSpecs();
+
+    /**
+     * @brief Builds the shared animations used by createZombie ahead of the first spawn
+     */
+    static void preloadAnimations();
+
+    /** @brief Back to the spawn state for ZombiePool reuse */
+    virtual void respawn() override;
+
+    /** @brief Animation of the card selection preview, e.g. to fetch its sheet ahead of time */
+    static AnimationSpec getShowcaseSpec();
+
+    /**
+     * @brief Looping preview sprite for the card selection scene.
+     * Built from the cached showcase frames only; no zombie is constructed.
+     */
+    static cocos2d::Sprite* createShowcaseSprite(const cocos2d::Vec2& pos);
 
 
     /**
@@ -66,6 +83,11 @@ public:
     inline bool hasBucketHead() const { return !_useNormalZombie; }
 
 protected:
+    // Sprite sheet slicing of each animation, shared through AnimationLibrary
+    static const AnimationSpec WALK_ANIMATION;
+    static const AnimationSpec IDLE_ANIMATION;
+    static const AnimationSpec EAT_ANIMATION;
+
 
     // Virtual destructor
     virtual ~BucketHeadZombie();
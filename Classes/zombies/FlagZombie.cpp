@@ -1,30 +1,16 @@
 
 #include "FlagZombie.h"
+#include "Log.h"
 #include "Plant.h"
 
 USING_NS_CC;
 
-Sprite* FlagZombie::createShowcaseSprite(const Vec2& pos)
-{
-    auto animation = initAnimate("flag_zombie_idle_spritesheet.png", 250.0f, 250.0f, 6, 5, 29, 0.05f);
-    auto animate = Animate::create(animation);
-    auto _idleAction = RepeatForever::create(animate);
-
-    auto sp = Sprite::create();
-    if (sp) {
-        sp->setPosition(pos);
-        sp->runAction(_idleAction);
-    }
-    return sp;
-}
-
-
 // Destructor
 FlagZombie::~FlagZombie()
 {
     CC_SAFE_RELEASE(_walkAction);
     CC_SAFE_RELEASE(_eatAction);
-    CCLOG("Zombie destroyed.");
+    LOG_TRACE(LIFECYCLE, "Zombie destroyed.");
 }
 
 // Initialization function
@@ -36,12 +22,35 @@ bool FlagZombie::init()
         return false;
     }
 
-    // Enable per-frame update
-    this->scheduleUpdate();
-
     return true;
 }
 
+// Sprite sheet slicing
+const AnimationSpec FlagZombie::WALK_ANIMATION = AnimationSpec::grid("flag_zombie_walk_spritesheet.png", 208.0f, 180.0f, 3, 5, 12, 0.18f);
+const AnimationSpec FlagZombie::IDLE_ANIMATION = AnimationSpec::grid("flag_zombie_idle_spritesheet.png", 250.0f, 250.0f, 6, 5, 29, 0.05f);
+const AnimationSpec FlagZombie::EAT_ANIMATION = AnimationSpec::grid("flag_zombie_eat_spritesheet.png", 208.0f, 180.0f, 3, 5, 11, 0.1f);
+
+std::vector<AnimationSpec> FlagZombie::getAnimationSpecs()
+{
+    return { WALK_ANIMATION, EAT_ANIMATION };
+}
+
+// Warm the shared animations so the first spawn does not slice sheets
+void FlagZombie::preloadAnimations()
+{
+    AnimationLibrary::getInstance()->warm(getAnimationSpecs());
+}
+
+AnimationSpec FlagZombie::getShowcaseSpec()
+{
+    return IDLE_ANIMATION;
+}
+
+Sprite* FlagZombie::createShowcaseSprite(const Vec2& pos)
+{
+    return createLoopingSprite(IDLE_ANIMATION, pos, 1.0f);
+}
+
 // Static factory method to create zombie with animations
 FlagZombie* FlagZombie::createZombie()
 {
@@ -53,17 +62,23 @@ FlagZombie* FlagZombie::createZombie()
         z->initEatAnimation();
         z->X_CORRECTION = 120.0f;
         z->SIZE_CORRECTION = 200.0f;
-        z->runAction(z->_walkAction);
+        z->respawn();
         return z;
     }
     delete z;
     return nullptr;
 }
 
+void FlagZombie::respawn()
+{
+    Zombie::respawn();
+    this->runAction(_walkAction);
+}
+
 // Initialize walking animation
 void FlagZombie::initWalkAnimation()
 {
-    auto animation = initAnimate("flag_zombie_walk_spritesheet.png", 208.0f, 180.0f, 3, 5, 12, 0.18f);
+    auto animation = initAnimate(WALK_ANIMATION);
     auto animate = Animate::create(animation);
     this->_walkAction = RepeatForever::create(animate);
     _walkAction->retain();
@@ -72,7 +87,7 @@ void FlagZombie::initWalkAnimation()
 // Initialize eating animation
 void FlagZombie::initEatAnimation()
 {
-    auto animation = initAnimate("flag_zombie_eat_spritesheet.png", 208.0f, 180.0f, 3, 5, 11, 0.1f);
+    auto animation = initAnimate(EAT_ANIMATION);
     auto animate = Animate::create(animation);
     this->_eatAction = RepeatForever::create(animate);
     _eatAction->retain();
@@ -86,23 +101,22 @@ void FlagZombie::setAnimationForState()
     switch (static_cast<ZombieState>(current_state))
     {
         case ZombieState::WALKING:
-            CCLOG("Setting WALKING animation.");
+            LOG_TRACE(ZOMBIES, "Setting WALKING animation.");
             this->stopAllActions();
             this->runAction(_walkAction);
             break;
         case ZombieState::EATING:
-            CCLOG("Setting EATING animation.");
+            LOG_TRACE(ZOMBIES, "Setting EATING animation.");
             this->stopAllActions();
             this->runAction(_eatAction);
             break;
         case ZombieState::DYING:
         {
-            CCLOG("Setting DYING animation.");
+            LOG_TRACE(ZOMBIES, "Setting DYING animation.");
             this->stopAllActions();
             auto fadeOut = FadeOut::create(0.5f);
             auto markDead = CallFunc::create([this]() {
-                is_dead = true;
-                _isDying = false;
+                finishDying();
                 });
             auto sequence = Sequence::create(fadeOut, markDead, nullptr);
             this->runAction(sequence);
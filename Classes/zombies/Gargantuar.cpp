@@ -1,27 +1,13 @@
 
 #include "Gargantuar.h"
+#include "Log.h"
 #include "GameWorld.h"
 #include "Imp.h"
 #include "Plant.h"
+#include "SoundManager.h"
 
 USING_NS_CC;
 
-Sprite* Gargantuar::createShowcaseSprite(const Vec2& pos)
-{
-    auto animation = initAnimate("gargantuar_idle_spritesheet.png", 750.0f, 750.0f, 9, 5, 45, 0.05f);
-    auto animate = Animate::create(animation);
-    auto _idleAction = RepeatForever::create(animate);
-
-    auto sp = Sprite::create();
-    if (sp) {
-        sp->setPosition(pos);
-        sp->setScale(0.4f);
-        sp->runAction(_idleAction);
-    }
-    return sp;
-}
-
-
 // Protected constructor
 Gargantuar::Gargantuar()
     : _walkAction(nullptr)
@@ -31,7 +17,7 @@ Gargantuar::Gargantuar()
     , _isThrowing(false)
     , _hasthrown(false)
 {
-    CCLOG("Zombie created.");
+    LOG_TRACE(LIFECYCLE, "Zombie created.");
 }
 
 // Destructor
@@ -39,7 +25,7 @@ Gargantuar::~Gargantuar()
 {
     CC_SAFE_RELEASE(_walkAction);
     CC_SAFE_RELEASE(_smashAction);
-    CCLOG("Zombie destroyed.");
+    LOG_TRACE(LIFECYCLE, "Zombie destroyed.");
 }
 
 // Initialization function
@@ -50,12 +36,38 @@ bool Gargantuar::init()
     {
         return false;
     }
-    // Enable per-frame update
-    this->scheduleUpdate();
 
     return true;
 }
 
+// Sprite sheet slicing
+const AnimationSpec Gargantuar::WALK_ANIMATION = AnimationSpec::grid("gargantuar_walk_spritesheet.png", 280.0f, 292.0f, 7, 6, 40, 0.08f);
+const AnimationSpec Gargantuar::IDLE_ANIMATION = AnimationSpec::grid("gargantuar_idle_spritesheet.png", 750.0f, 750.0f, 9, 5, 45, 0.05f);
+const AnimationSpec Gargantuar::SMASH_ANIMATION = AnimationSpec::grid("gargantuar_smash_spritesheet.png", 395.0f, 365.0f, 7, 5, 33, 0.08f);
+const AnimationSpec Gargantuar::PRE_THROW_ANIMATION = AnimationSpec::range("gargantuar_throw_spritesheet.png", 469.0f, 400.0f, 4, 10, 0, 30, 0.08f);
+const AnimationSpec Gargantuar::POST_THROW_ANIMATION = AnimationSpec::range("gargantuar_throw_spritesheet.png", 469.0f, 400.0f, 4, 10, 30, 37, 0.08f);
+
+std::vector<AnimationSpec> Gargantuar::getAnimationSpecs()
+{
+    return { WALK_ANIMATION, SMASH_ANIMATION, PRE_THROW_ANIMATION, POST_THROW_ANIMATION };
+}
+
+// Warm the shared animations so the first spawn does not slice sheets
+void Gargantuar::preloadAnimations()
+{
+    AnimationLibrary::getInstance()->warm(getAnimationSpecs());
+}
+
+AnimationSpec Gargantuar::getShowcaseSpec()
+{
+    return IDLE_ANIMATION;
+}
+
+Sprite* Gargantuar::createShowcaseSprite(const Vec2& pos)
+{
+    return createLoopingSprite(IDLE_ANIMATION, pos, 0.4f);
+}
+
 // Static factory method to create zombie with animations
 Gargantuar* Gargantuar::createZombie()
 {
@@ -66,20 +78,28 @@ Gargantuar* Gargantuar::createZombie()
         z->initWalkAnimation();
         z->initSmashAnimation();
         z->initThrowAnimation();
-        z->current_health = static_cast<int>(3000.0f);
         z->ATTACK_DAMAGE = 1000.0f;
         z->ATTACK_INTERVAL = 2.64f;
-        z->runAction(z->_walkAction);
+        z->respawn();
         return z;
     }
     delete z;
     return nullptr;
 }
 
+void Gargantuar::respawn()
+{
+    Zombie::respawn();
+    current_health = static_cast<int>(3000.0f);
+    _isThrowing = false;
+    _hasthrown = false;
+    this->runAction(_walkAction);
+}
+
 // Initialize walking animation
 void Gargantuar::initWalkAnimation()
 {
-    auto animation = initAnimate("gargantuar_walk_spritesheet.png", 280.0f, 292.0f, 7, 6, 40, 0.08f);
+    auto animation = initAnimate(WALK_ANIMATION);
     auto animate = Animate::create(animation);
     this->_walkAction = RepeatForever::create(animate);
     _walkAction->retain();
@@ -88,7 +108,7 @@ void Gargantuar::initWalkAnimation()
 // Initialize eating animation
 void Gargantuar::initSmashAnimation()
 {
-    auto animation = initAnimate("gargantuar_smash_spritesheet.png", 395.0f, 365.0f, 7, 5, 33, 0.08f);
+    auto animation = initAnimate(SMASH_ANIMATION);
     auto animate = Animate::create(animation);
     this->_smashAction = Animate::create(animation);
     _smashAction->retain();
@@ -96,40 +116,45 @@ void Gargantuar::initSmashAnimation()
 
 void Gargantuar::initThrowAnimation()
 {
-    auto preThrowAnimation = initAnimate("gargantuar_throw_spritesheet.png", 469.0f, 400.0f, 4, 10, 0,30, 0.08f);
+    auto preThrowAnimation = initAnimate(PRE_THROW_ANIMATION);
     this->_prethrowAction= Animate::create(preThrowAnimation);
     _prethrowAction->retain();
 
-    auto postThrowAnimation= initAnimate("gargantuar_throw_spritesheet.png", 469.0f, 400.0f, 4, 10, 30, 37, 0.08f);
+    auto postThrowAnimation= initAnimate(POST_THROW_ANIMATION);
     this->_postthrowAction = Animate::create(postThrowAnimation);
     _postthrowAction->retain();
 }
 
 
-void Gargantuar::updateMoving(float delta)
+uint8_t Gargantuar::getLaneFlags() const
 {
+    if (is_dead || _isDying)
+        return 0;
+    if (_isEating)
+        return ZombieLanes::TIMER | ZombieLanes::EATS;
     if (_isThrowing)
-        return;
-    if (current_health <= 1500 && current_health > 0 && _hasthrown == false && this->getPositionX() >= 500) {
-        this->current_speed = 0;
+        return 0;
+    // Ticks only until the imp is thrown
+    return _hasthrown ? ZombieLanes::MOVES : ZombieLanes::MOVES | ZombieLanes::TICKS;
+}
+
+void Gargantuar::updateLaneTick(float delta)
+{
+    // ZombieLanes has already moved us this frame; the throw check uses the position before that step
+    float step = getSpeed() * delta;
+    if (current_health <= 1500 && current_health > 0 && _hasthrown == false && getLaneX() + step >= 500) {
+        setLaneX(getLaneX() + step);
+        this->setSpeed(0);
         this->_isThrowing = true;
         setState(static_cast<int>(ZombieState::THROWING));
-        return;
     }
-    float newX = this->getPositionX() - current_speed * delta;
-    this->setPositionX(newX);
 }
 
-void Gargantuar::updateEating(float delta)
+void Gargantuar::bite()
 {
-    accumulated_time += delta;
-    // If eating, deal damage periodically
-    if (accumulated_time >= ATTACK_INTERVAL)
-    {
-        _targetPlant->takeDamage(ATTACK_DAMAGE);
-        cocos2d::AudioEngine::play2d("gargantuar-thump.mp3");
-        accumulated_time = 0.0f;
-    }
+    _targetPlant->takeDamage(ATTACK_DAMAGE);
+    SoundManager::getInstance()->post("gargantuar-thump.mp3", SoundPriority::NORMAL);
+    setAttackTimer(0.0f);
 }
 
 // Set animation corresponding to state
@@ -138,12 +163,12 @@ void Gargantuar::setAnimationForState()
     switch (static_cast<ZombieState>(current_state))
     {
         case ZombieState::WALKING:
-            CCLOG("Setting WALKING animation.");
+            LOG_TRACE(ZOMBIES, "Setting WALKING animation.");
             this->stopAction(_smashAction);
             this->runAction(_walkAction);
             break;
         case ZombieState::SMASHING:
-            CCLOG("Setting EATING animation.");
+            LOG_TRACE(ZOMBIES, "Setting EATING animation.");
             this->stopAction(_walkAction);
             this->runAction(Sequence::create(
                 MoveBy::create(0, Vec2(-20, 55)),
@@ -151,21 +176,21 @@ void Gargantuar::setAnimationForState()
                 MoveBy::create(0, Vec2(20, -55)),
                 CallFunc::create([this]() {
                     this->_isEating = false;
-                    this->current_speed = MOVE_SPEED;
+                    this->setSpeed(MOVE_SPEED);
                     setState(static_cast<int>(ZombieState::WALKING));
                     }),
                 nullptr
             ));
             break;
         case ZombieState::THROWING:
-            CCLOG("setting throwing animation");           
+            LOG_TRACE(ZOMBIES, "setting throwing animation");           
             this->stopAllActions();
             this->runAction(
                 Sequence::create(
                     MoveBy::create(0, Vec2(-46, 35)),
                     _prethrowAction,
                     CallFunc::create([this]() {
-                        CCLOG("throw");
+                        LOG_TRACE(ZOMBIES, "throw");
                         this->throwImp();
                         }),
                     _postthrowAction,
@@ -173,7 +198,7 @@ void Gargantuar::setAnimationForState()
                     CallFunc::create([this]() {
                         this->_hasthrown = true;
                         this->_isThrowing = false;
-                        this->current_speed = MOVE_SPEED;
+                        this->setSpeed(MOVE_SPEED);
                         this->setState(static_cast<int>(ZombieState::WALKING));
                         }),
                     nullptr
@@ -182,12 +207,11 @@ void Gargantuar::setAnimationForState()
             break;
         case ZombieState::DYING:
         {
-            CCLOG("Setting DYING animation.");
+            LOG_TRACE(ZOMBIES, "Setting DYING animation.");
             this->stopAllActions();
             auto fadeOut = FadeOut::create(0.5f);
             auto markDead = CallFunc::create([this]() {
-                is_dead = true;
-                _isDying = false;
+                finishDying();
                 });
             auto sequence = Sequence::create(fadeOut, markDead, nullptr);
             this->runAction(sequence);
@@ -227,12 +251,11 @@ void Gargantuar::encounterPlant(const std::vector<Plant*>& plants)
 
 void Gargantuar::throwImp()
 {
-    CCLOG("imp created");
+    LOG_TRACE(ZOMBIES, "imp created");
     auto imp = Imp::createZombie();
     auto pos = this->getPosition();
     imp->setPosition(pos + Vec2(-250, 35));
     auto gameWorld = static_cast<GameWorld*>(Director::getInstance()->getRunningScene());
-    gameWorld->addChild(imp, ENEMY_LAYER);
     gameWorld->addZombie(imp);
-    cocos2d::AudioEngine::play2d("imp-pvz.mp3", false, 1.0f);
+    SoundManager::getInstance()->post("imp-pvz.mp3", SoundPriority::NORMAL);
 }
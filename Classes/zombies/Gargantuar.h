@@ -41,8 +41,25 @@ public:
      */
     static Gargantuar* createZombie();
 
-    // 选卡展示静态图
-    cocos2d::Sprite* createShowcaseSprite(const cocos2d::Vec2& pos);
+    /** @brief Sprite sheet slicing of every animation createZombie builds */
+    static std::vector<AnimationSpec> getAnimationSpecs();
+
+    /**
+     * @brief Builds the shared animations used by createZombie ahead of the first spawn
+     */
+    static void preloadAnimations();
+
+    /** @brief Back to the spawn state for ZombiePool reuse */
+    virtual void respawn() override;
+
+    /** @brief Animation of the card selection preview, e.g. to fetch its sheet ahead of time */
+    static AnimationSpec getShowcaseSpec();
+
+    /**
+     * @brief Looping preview sprite for the card selection scene.
+     * Built from the cached showcase frames only; no zombie is constructed.
+     */
+    static cocos2d::Sprite* createShowcaseSprite(const cocos2d::Vec2& pos);
 
     /**
      * @brief Update function called every frame for movement, attack, death, etc.
@@ -66,6 +83,13 @@ public:
 
 
 protected:
+    // Sprite sheet slicing of each animation, shared through AnimationLibrary
+    static const AnimationSpec WALK_ANIMATION;
+    static const AnimationSpec IDLE_ANIMATION;
+    static const AnimationSpec SMASH_ANIMATION;
+    static const AnimationSpec PRE_THROW_ANIMATION;
+    static const AnimationSpec POST_THROW_ANIMATION;
+
     // Protected constructor
     Gargantuar();
 
@@ -85,9 +109,14 @@ protected:
 
     void initThrowAnimation();
 
-    virtual void updateMoving(float delta) override;
+    /** @brief Walks with a throw check until the imp is thrown; smashes on a bite timer */
+    virtual uint8_t getLaneFlags() const override;
+
+    /** @brief Starts the imp throw once health drops to half, far enough from the house */
+    virtual void updateLaneTick(float delta) override;
 
-    virtual void updateEating(float delta) override;
+    /** @brief Smash damage; a smash ignores whether the plant already died */
+    virtual void bite() override;
 
     /**
      * @brief Set animation corresponding to state
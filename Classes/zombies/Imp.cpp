@@ -1,6 +1,8 @@
 
 #include "Imp.h"
+#include "Log.h"
 #include "Plant.h"
+#include "SoundManager.h"
 
 USING_NS_CC;
 
@@ -12,7 +14,7 @@ Imp::Imp()
     , _hasBeenThrown(false)
     , _isFlying(false)
 {
-    CCLOG("Zombie created.");
+    LOG_TRACE(LIFECYCLE, "Zombie created.");
 }
 
 // Destructor
@@ -21,7 +23,7 @@ Imp::~Imp()
     CC_SAFE_RELEASE(_walkAction);
     CC_SAFE_RELEASE(_eatAction);
     CC_SAFE_RELEASE(_flyAnimate);
-    CCLOG("Zombie destroyed.");
+    LOG_TRACE(LIFECYCLE, "Zombie destroyed.");
 }
 
 // Initialization function
@@ -33,12 +35,25 @@ bool Imp::init()
         return false;
     }
 
-    // Enable per-frame update
-    this->scheduleUpdate();
-
     return true;
 }
 
+// Sprite sheet slicing
+const AnimationSpec Imp::WALK_ANIMATION = AnimationSpec::grid("imp_walk_spritesheet.png", 100.0f, 138.0f, 3, 5, 12, 0.08f);
+const AnimationSpec Imp::EAT_ANIMATION = AnimationSpec::grid("imp_eat_spritesheet.png", 100.0f, 128.0f, 2, 5, 7, 0.15f);
+const AnimationSpec Imp::FLY_ANIMATION = AnimationSpec::grid("imp_fly_spritesheet.png", 145.0f, 200.0f, 4, 5, 23, 0.06f);
+
+std::vector<AnimationSpec> Imp::getAnimationSpecs()
+{
+    return { WALK_ANIMATION, EAT_ANIMATION, FLY_ANIMATION };
+}
+
+// Warm the shared animations so the first spawn does not slice sheets
+void Imp::preloadAnimations()
+{
+    AnimationLibrary::getInstance()->warm(getAnimationSpecs());
+}
+
 // Static factory method to create zombie with animations
 Imp* Imp::createZombie()
 {
@@ -50,7 +65,7 @@ Imp* Imp::createZombie()
         z->initEatAnimation();
         z->initFlyAnimation();
         z->MOVE_SPEED = 40.0f;
-        z->current_speed = z->MOVE_SPEED;
+        z->setSpeed(z->MOVE_SPEED);
         z->current_health = 100;
         z->current_state = static_cast<int>(ZombieState::FLYING);
         //z->runAction(z->_flyAnimate);
@@ -64,7 +79,7 @@ Imp* Imp::createZombie()
 // Initialize walking animation
 void Imp::initWalkAnimation()
 {
-    auto animation = initAnimate("imp_walk_spritesheet.png", 100.0f, 138.0f, 3, 5, 12, 0.08f);
+    auto animation = initAnimate(WALK_ANIMATION);
     auto animate = Animate::create(animation);
     this->_walkAction = RepeatForever::create(animate);
     _walkAction->retain();
@@ -73,7 +88,7 @@ void Imp::initWalkAnimation()
 // Initialize eating animation
 void Imp::initEatAnimation()
 {
-    auto animation = initAnimate("imp_eat_spritesheet.png", 100.0f, 128.0f, 2, 5, 7, 0.15f);
+    auto animation = initAnimate(EAT_ANIMATION);
     auto animate = Animate::create(animation);
     this->_eatAction = RepeatForever::create(animate);
     _eatAction->retain();
@@ -81,7 +96,7 @@ void Imp::initEatAnimation()
 
 void Imp::initFlyAnimation()
 {
-    auto animation = initAnimate("imp_fly_spritesheet.png", 145.0f, 200.0f, 4, 5, 23, 0.06f);
+    auto animation = initAnimate(FLY_ANIMATION);
     this->_flyAnimate = Animate::create(animation);
     _flyAnimate->retain();
 }
@@ -93,16 +108,16 @@ void Imp::setAnimationForState()
     switch (static_cast<ZombieState>(current_state))
     {
     case ZombieState::WALKING:
-        CCLOG("Setting imp WALKING animation.");
+        LOG_TRACE(ZOMBIES, "Setting imp WALKING animation.");
         this->stopAllActions();
         this->runAction(_walkAction);
         break;
     case ZombieState::EATING:
-        CCLOG("Setting EATING animation.");
+        LOG_TRACE(ZOMBIES, "Setting EATING animation.");
         this->stopAllActions();
         // ---  ---
         this->_isFlying = false;          // ֹͣ߼
-        this->current_speed = MOVE_SPEED; // ָٶ
+        this->setSpeed(MOVE_SPEED); // ָٶ
         // ----------------
         this->runAction(_eatAction);
         break;
@@ -112,12 +127,12 @@ void Imp::setAnimationForState()
         this->stopAllActions();
         this->runAction(Sequence::create(
             CallFunc::create([this]() {
-                this->current_speed = 120.0f; // ٶ
+                this->setSpeed(120.0f); // ٶ
                 }),
             _flyAnimate,
             CallFunc::create([this]() {
                 this->_isFlying = false;     // 
-                this->current_speed = MOVE_SPEED;
+                this->setSpeed(MOVE_SPEED);
                 this->setState(static_cast<int>(ZombieState::WALKING));
 
                 // ȷصߵĻ׼ϣ
@@ -129,12 +144,11 @@ void Imp::setAnimationForState()
     }
     case ZombieState::DYING:
     {
-        CCLOG("Setting DYING animation.");
+        LOG_TRACE(ZOMBIES, "Setting DYING animation.");
         this->stopAllActions();
         auto fadeOut = FadeOut::create(0.5f);
         auto markDead = CallFunc::create([this]() {
-            is_dead = true;
-            _isDying = false;
+            finishDying();
             });
         auto sequence = Sequence::create(fadeOut, markDead, nullptr);
         this->runAction(sequence);
@@ -145,60 +159,38 @@ void Imp::setAnimationForState()
     }
 }
 
-void Imp::update(float delta)
+uint8_t Imp::getLaneFlags() const
 {
     if (is_dead || _isDying)
-    {
-        return;
-    }
+        return 0;
+    // The bite timer keeps running while the imp walks or flies
+    if (_isEating)
+        return ZombieLanes::TIMER | ZombieLanes::EATS | ZombieLanes::TICKS;
+    return ZombieLanes::MOVES | ZombieLanes::TIMER;
+}
 
-    accumulated_time += delta;
-    // If zombie is not eating, continue walking left
-    if (!_isEating)
+float Imp::getLaneFall() const
+{
+    // Drops towards its row while flying from the Gargantuar's hand
+    return _isFlying ? 50.0f : 0.0f;
+}
+
+void Imp::bite()
+{
+    if (_targetPlant && !_targetPlant->isDead())
     {
-        // ֻвڳԶʱƶ
-        float newX = this->getPositionX() - current_speed * delta;
-        this->setPositionX(newX);
-
-        // ֻȷڷ״̬ʱżλ
-        if (_isFlying) {
-            float newY = this->getPositionY() - 50.0f * delta; // 50ԸҪ
-            this->setPositionY(newY);
-        }
+        _targetPlant->takeDamage(ATTACK_DAMAGE);
+        SoundManager::getInstance()->post("zombie_eating.mp3", SoundPriority::LOW);
+        LOG_TRACE(COMBAT, "Zombie deals %f damage to plant", ATTACK_DAMAGE);
+        setAttackTimer(0.0f);
 
-        // Check if zombie reached the left edge (game over condition)
-        if (newX < -100)
+        // Check if plant died
+        if (_targetPlant->isDead())
         {
-            // Zombie reached the house - game over
-            CCLOG("Zombie reached the house!");
-        }
-    }
-    else
-    {
-        if (!_targetPlant || _targetPlant->isDead()) {
+            SoundManager::getInstance()->post("zombie_gulp.mp3", SoundPriority::NORMAL);
             onPlantDied();
-            return;
-        }
-        // If eating, deal damage periodically
-        if (accumulated_time >= ATTACK_INTERVAL)
-        {
-            if (_targetPlant && !_targetPlant->isDead())
-            {
-                _targetPlant->takeDamage(ATTACK_DAMAGE);
-                cocos2d::AudioEngine::play2d("zombie_eating.mp3");
-                CCLOG("Zombie deals %f damage to plant", ATTACK_DAMAGE);
-                accumulated_time = 0.0f;
-
-                // Check if plant died
-                if (_targetPlant->isDead())
-                {
-                    cocos2d::AudioEngine::play2d("zombie_gulp.mp3");
-                    onPlantDied();
-                }
-            }
         }
     }
-
 }
 
 void Imp::encounterPlant(const std::vector<Plant*>& plants)
@@ -50,17 +50,36 @@ public:
      */
     static Imp* createZombie();
 
-    virtual void update(float delta) override;
+    /** @brief Sprite sheet slicing of every animation createZombie builds */
+    static std::vector<AnimationSpec> getAnimationSpecs();
+
+    /**
+     * @brief Builds the shared animations used by createZombie ahead of the first spawn
+     */
+    static void preloadAnimations();
 
     void encounterPlant(const std::vector<Plant*>& plants) override;
 
 protected:
+    // Sprite sheet slicing of each animation, shared through AnimationLibrary
+    static const AnimationSpec WALK_ANIMATION;
+    static const AnimationSpec EAT_ANIMATION;
+    static const AnimationSpec FLY_ANIMATION;
+
     // Protected constructor
     Imp();
 
     // Virtual destructor
     virtual ~Imp();
 
+    /** @brief Walks (or flies) with the bite timer always running, as the imp always did */
+    virtual uint8_t getLaneFlags() const override;
+
+    /** @brief 50 px/s while flying */
+    virtual float getLaneFall() const override;
+
+    virtual void bite() override;
+
     /**
      * @brief Initialize walking animation
      */
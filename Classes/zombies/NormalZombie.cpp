@@ -1,5 +1,6 @@
 
 #include "NormalZombie.h"
+#include "Log.h"
 #include "Plant.h"
 #include "SpikeWeed.h"
 #include "SpikeRock.h"
@@ -13,7 +14,7 @@ NormalZombie::~NormalZombie()
 {
     CC_SAFE_RELEASE(_walkAction);
     CC_SAFE_RELEASE(_eatAction);
-    CCLOG("NormalZombie destroyed.");
+    LOG_TRACE(LIFECYCLE, "NormalZombie destroyed.");
 }
 
 // Initialization function
@@ -25,12 +26,35 @@ bool NormalZombie::init()
         return false;
     }
 
-    // Enable per-frame update
-    this->scheduleUpdate();
-
     return true;
 }
 
+// Sprite sheet slicing
+const AnimationSpec NormalZombie::WALK_ANIMATION = AnimationSpec::grid("zombie_walk_spritesheet.png", 125.0f, 173.8f, 5, 10, 46, 0.05f);
+const AnimationSpec NormalZombie::IDLE_ANIMATION = AnimationSpec::grid("zombie_idle_spritesheet.png", 235.0f, 225.0f, 6, 5, 29, 0.05f);
+const AnimationSpec NormalZombie::EAT_ANIMATION = AnimationSpec::grid("zombie_eat_spritesheet.png", 125.0f, 173.8f, 4, 10, 39, 0.03f);
+
+std::vector<AnimationSpec> NormalZombie::getAnimationSpecs()
+{
+    return { WALK_ANIMATION, EAT_ANIMATION };
+}
+
+// Warm the shared animations so the first spawn does not slice sheets
+void NormalZombie::preloadAnimations()
+{
+    AnimationLibrary::getInstance()->warm(getAnimationSpecs());
+}
+
+AnimationSpec NormalZombie::getShowcaseSpec()
+{
+    return IDLE_ANIMATION;
+}
+
+Sprite* NormalZombie::createShowcaseSprite(const Vec2& pos)
+{
+    return createLoopingSprite(IDLE_ANIMATION, pos, 1.0f);
+}
+
 // Static factory method to create zombie with animations
 NormalZombie* NormalZombie::createZombie()
 {
@@ -40,31 +64,23 @@ NormalZombie* NormalZombie::createZombie()
         z->autorelease();
         z->initWalkAnimation();
         z->initEatAnimation();
-        z->runAction(z->_walkAction);
+        z->respawn();
         return z;
     }
     delete z;
     return nullptr;
 }
 
-Sprite* NormalZombie::createShowcaseSprite(const Vec2& pos)
+void NormalZombie::respawn()
 {
-    auto animation = initAnimate("zombie_idle_spritesheet.png", 235.0f, 225.0f, 6, 5, 29, 0.05f);
-    auto animate = Animate::create(animation);
-    auto _idleAction = RepeatForever::create(animate);
-
-    auto sp = Sprite::create();
-    if (sp) {
-        sp->setPosition(pos);
-        sp->runAction(_idleAction);
-    }
-    return sp;
+    Zombie::respawn();
+    this->runAction(_walkAction);
 }
 
 // Initialize walking animation
 void NormalZombie::initWalkAnimation()
 {
-    auto animation = initAnimate("zombie_walk_spritesheet.png", 125.0f, 173.8f, 5, 10, 46, 0.05f);
+    auto animation = initAnimate(WALK_ANIMATION);
     auto animate = Animate::create(animation);
     this->_walkAction = RepeatForever::create(animate);
     _walkAction->retain();
@@ -73,7 +89,7 @@ void NormalZombie::initWalkAnimation()
 // Initialize eating animation
 void NormalZombie::initEatAnimation()
 {
-    auto animation = initAnimate("zombie_eat_spritesheet.png", 125.0f, 173.8f, 4, 10, 39, 0.03f);
+    auto animation = initAnimate(EAT_ANIMATION);
     auto animate = Animate::create(animation);
     this->_eatAction = RepeatForever::create(animate);
     _eatAction->retain();
@@ -87,23 +103,22 @@ void NormalZombie::setAnimationForState()
     switch (static_cast<ZombieState>(current_state))
     {
         case ZombieState::WALKING:
-            CCLOG("Setting WALKING animation.");
+            LOG_TRACE(ZOMBIES, "Setting WALKING animation.");
             this->stopAllActions();
             this->runAction(_walkAction);
             break;
         case ZombieState::EATING:
-            CCLOG("Setting EATING animation.");
+            LOG_TRACE(ZOMBIES, "Setting EATING animation.");
             this->stopAllActions();
             this->runAction(_eatAction);
             break;
         case ZombieState::DYING:
         {
-            CCLOG("Setting DYING animation.");
+            LOG_TRACE(ZOMBIES, "Setting DYING animation.");
             this->stopAllActions();
             auto fadeOut = FadeOut::create(0.5f);
             auto markDead = CallFunc::create([this]() {
-                is_dead = true;
-                _isDying = false;
+                finishDying();
                 });
             auto sequence = Sequence::create(fadeOut, markDead, nullptr);
             this->runAction(sequence);
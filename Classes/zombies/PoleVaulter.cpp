@@ -1,54 +1,43 @@
 
 #include "PoleVaulter.h"
+#include "Log.h"
 #include "Plant.h"
-#include "audio/include/AudioEngine.h"
+#include "SoundManager.h"
 
 USING_NS_CC;
 
-Sprite* PoleVaulter::createShowcaseSprite(const Vec2& pos)
-{
-    float frameWidth = 1250.0f;
-    float frameHeight = 785.0f;
-
-    Vector<SpriteFrame*> frames;
-
-    for (int row = 0; row < 3; row++)
-    {
-        for (int col = 0; col < 5; col++)
-        {
-            if (row == 2 && col == 3)
-                break;
-
-            float x = col * frameWidth;
-            float y = row * frameHeight;
+// ----------------------------------------------------
+// Static constant definitions
+// ----------------------------------------------------
 
-            auto frame = SpriteFrame::create(
-                "pole_vaulter_idle_spritesheet.png",
-                Rect(x, y, frameWidth, frameHeight)
-            );
+const float PoleVaulter::RUNNING_SPEED = 40.0f;
 
-            frames.pushBack(frame);
-        }
-    }
+const AnimationSpec PoleVaulter::WALK_ANIMATION = AnimationSpec::grid("pole_vaulter_walk_spritesheet.png", 125.0f, 225.0f, 5, 10, 44, 0.05f);
+const AnimationSpec PoleVaulter::IDLE_ANIMATION = AnimationSpec::grid("pole_vaulter_idle_spritesheet.png", 1250.0f, 785.0f, 3, 5, 13, 0.06f);
+const AnimationSpec PoleVaulter::EAT_ANIMATION = AnimationSpec::grid("pole_vaulter_eat_spritesheet.png", 125.0f, 225.0f, 3, 10, 27, 0.03f);
+const AnimationSpec PoleVaulter::RUN_ANIMATION = AnimationSpec::grid("pole_vaulter_run_spritesheet.png", 375.0f, 225.0f, 6, 6, 36, 0.03f);
+const AnimationSpec PoleVaulter::JUMP_ANIMATION = AnimationSpec::grid("pole_vaulter_jump_spritesheet.png", 625.0f, 225.0f, 11, 4, 42, 0.03f);
 
-    auto animation = Animation::createWithSpriteFrames(frames, 0.06f);
-    auto animate = Animate::create(animation);
-    auto _idleAction = RepeatForever::create(animate);
+std::vector<AnimationSpec> PoleVaulter::getAnimationSpecs()
+{
+    return { WALK_ANIMATION, EAT_ANIMATION, RUN_ANIMATION, JUMP_ANIMATION };
+}
 
-    auto sp = Sprite::create();
-    if (sp) {
-        sp->setPosition(pos);
-        sp->setScale(0.35f);
-        sp->runAction(_idleAction);
-    }
-    return sp;
+// Warm the shared animations so the first spawn does not slice sheets
+void PoleVaulter::preloadAnimations()
+{
+    AnimationLibrary::getInstance()->warm(getAnimationSpecs());
 }
 
-// ----------------------------------------------------
-// Static constant definitions
-// ----------------------------------------------------
+AnimationSpec PoleVaulter::getShowcaseSpec()
+{
+    return IDLE_ANIMATION;
+}
 
-const float PoleVaulter::RUNNING_SPEED = 40.0f;
+Sprite* PoleVaulter::createShowcaseSprite(const Vec2& pos)
+{
+    return createLoopingSprite(IDLE_ANIMATION, pos, 0.35f);
+}
 
 // Protected constructor
 PoleVaulter::PoleVaulter()
@@ -59,7 +48,7 @@ PoleVaulter::PoleVaulter()
     , _isJumping(false)
     , _hasJumped(false)
 {
-    CCLOG("Zombie created.");
+    LOG_TRACE(LIFECYCLE, "Zombie created.");
 }
 
 // Destructor
@@ -69,7 +58,7 @@ PoleVaulter::~PoleVaulter()
     CC_SAFE_RELEASE(_eatAction);
     CC_SAFE_RELEASE(_runAction);
     CC_SAFE_RELEASE(_jumpAction);
-    CCLOG("Zombie destroyed.");
+    LOG_TRACE(LIFECYCLE, "Zombie destroyed.");
 }
 
 // Initialization function
@@ -84,8 +73,6 @@ bool PoleVaulter::init()
 
     this->setScale(0.9f);
 
-    // Enable per-frame update
-    this->scheduleUpdate();
     return true;
 }
 
@@ -100,43 +87,27 @@ PoleVaulter* PoleVaulter::createZombie()
         z->initEatAnimation();
         z->initRunningAnimation();
         z->initJumpingAnimation();
-        z->current_state = static_cast<int>(ZombieState::RUNNING);
-        z->current_speed = RUNNING_SPEED;
-        z->runAction(z->_runAction);
+        z->respawn();
         return z;
     }
     delete z;
     return nullptr;
 }
 
+void PoleVaulter::respawn()
+{
+    Zombie::respawn();
+    _isJumping = false;
+    _hasJumped = false;
+    current_state = static_cast<int>(ZombieState::RUNNING);
+    setSpeed(RUNNING_SPEED);
+    this->runAction(_runAction);
+}
+
 // Initialize walking animation
 void PoleVaulter::initWalkAnimation()
 {
-    const float frameWidth = 125;
-    const float frameHeight = 225;
-
-    Vector<SpriteFrame*> frames;
-
-    for (int row = 0; row < 5; row++)
-    {
-        for (int col = 0; col < 10; col++)
-        {
-            if (row == 4 && col == 4)
-                break;
-
-            float x = col * frameWidth;
-            float y = row * frameHeight;
-
-            auto frame = SpriteFrame::create(
-                "pole_vaulter_walk_spritesheet.png",
-                Rect(x, y, frameWidth, frameHeight)
-            );
-
-            frames.pushBack(frame);
-        }
-    }
-
-    auto animation = Animation::createWithSpriteFrames(frames, 0.05f);
+    auto animation = initAnimate(WALK_ANIMATION);
     auto animate = Animate::create(animation);
 
     this->_walkAction = RepeatForever::create(animate);
@@ -146,31 +117,7 @@ void PoleVaulter::initWalkAnimation()
 // Initialize eating animation
 void PoleVaulter::initEatAnimation()
 {
-    const float frameWidth = 125;
-    const float frameHeight = 225;
-
-    Vector<SpriteFrame*> frames;
-
-    for (int row = 0; row < 3; row++)
-    {
-        for (int col = 0; col < 10; col++)
-        {
-            if (row == 2 && col == 7)
-                break;
-
-            float x = col * frameWidth;
-            float y = row * frameHeight;
-
-            auto frame = SpriteFrame::create(
-                "pole_vaulter_eat_spritesheet.png",
-                Rect(x, y, frameWidth, frameHeight)
-            );
-
-            frames.pushBack(frame);
-        }
-    }
-
-    auto animation = Animation::createWithSpriteFrames(frames, 0.03f);
+    auto animation = initAnimate(EAT_ANIMATION);
     auto animate = Animate::create(animation);
 
     this->_eatAction = RepeatForever::create(animate);
@@ -179,29 +126,7 @@ void PoleVaulter::initEatAnimation()
 
 void PoleVaulter::initRunningAnimation()
 {
-    const float frameWidth = 375;
-    const float frameHeight = 225;
-
-    Vector<SpriteFrame*> frames;
-
-    for (int row = 0; row < 6; row++)
-    {
-        for (int col = 0; col < 6; col++)
-        {
-
-            float x = col * frameWidth;
-            float y = row * frameHeight;
-
-            auto frame = SpriteFrame::create(
-                "pole_vaulter_run_spritesheet.png",
-                Rect(x, y, frameWidth, frameHeight)
-            );
-
-            frames.pushBack(frame);
-        }
-    }
-
-    auto animation = Animation::createWithSpriteFrames(frames, 0.03f);
+    auto animation = initAnimate(RUN_ANIMATION);
     auto animate = Animate::create(animation);
 
     this->_runAction = RepeatForever::create(animate);
@@ -210,31 +135,7 @@ void PoleVaulter::initRunningAnimation()
 
 void PoleVaulter::initJumpingAnimation()
 {
-    const float frameWidth = 625;
-    const float frameHeight = 225;
-
-    Vector<SpriteFrame*> frames;
-
-    for (int row = 0; row < 11; row++)
-    {
-        for (int col = 0; col < 4; col++)
-        {
-            if (row == 10 && col == 2)
-                break;
-
-            float x = col * frameWidth;
-            float y = row * frameHeight;
-
-            auto frame = SpriteFrame::create(
-                "pole_vaulter_jump_spritesheet.png",
-                Rect(x, y, frameWidth, frameHeight)
-            );
-
-            frames.pushBack(frame);
-        }
-    }
-
-    auto animation = Animation::createWithSpriteFrames(frames, 0.03f);
+    auto animation = initAnimate(JUMP_ANIMATION);
     this->_jumpAction = Animate::create(animation);
     _jumpAction->retain();
 }
@@ -312,14 +213,14 @@ void PoleVaulter::setAnimationForState()
     switch (static_cast<ZombieState>(current_state))
     {
         case ZombieState::WALKING:
-            CCLOG("Setting WALKING animation.");
+            LOG_TRACE(ZOMBIES, "Setting WALKING animation.");
             this->runAction(_walkAction);
             this->stopAction(_eatAction);
             this->stopAction(_runAction);
             this->stopAction(_jumpAction);
             break;
         case ZombieState::EATING:
-            CCLOG("Setting EATING animation.");
+            LOG_TRACE(ZOMBIES, "Setting EATING animation.");
             this->stopAction(_walkAction);
             this->runAction(_eatAction);
             this->stopAction(_runAction);
@@ -328,26 +229,25 @@ void PoleVaulter::setAnimationForState()
 
         case ZombieState::DYING:
         {
-            CCLOG("Setting DYING animation.");
+            LOG_TRACE(ZOMBIES, "Setting DYING animation.");
             this->stopAllActions();
             auto fadeOut = FadeOut::create(0.5f);
             auto markDead = CallFunc::create([this]() {
-                is_dead = true;
-                _isDying = false;
+                finishDying();
                 });
             auto sequence = Sequence::create(fadeOut, markDead, nullptr);
             this->runAction(sequence);
             break;
         }
         case ZombieState::JUMPING:
-            CCLOG("Setting JUMPING animation.");
+            LOG_TRACE(ZOMBIES, "Setting JUMPING animation.");
             this->stopAllActions();
             this->runAction(
                 Sequence::create(
                     jumpAnim,
                     CallFunc::create([this]() {
                         this->_isJumping = false;
-                        this->current_speed = MOVE_SPEED;
+                        this->setSpeed(MOVE_SPEED);
                         this->setState(static_cast<int>(ZombieState::WALKING));
                         }),
                     MoveBy::create(0.0001f, Vec2(-170, 0)),
@@ -357,7 +257,7 @@ void PoleVaulter::setAnimationForState()
             break;
 
         case ZombieState::RUNNING:
-            CCLOG("Setting RUNNING animation.");
+            LOG_TRACE(ZOMBIES, "Setting RUNNING animation.");
             this->stopAction(_walkAction);
             this->stopAction(_eatAction);
             this->runAction(_runAction);
@@ -397,7 +297,7 @@ void PoleVaulter::encounterPlant(const std::vector<Plant*>& plants)
 
             if (zombieRect.intersectsRect(plant->getBoundingBox()))
             {
-                CCLOG("!!!should jump!!!");
+                LOG_TRACE(ZOMBIES, "!!!should jump!!!");
                 if (_hasJumped)
                     startEating(plant);
                 else
@@ -422,10 +322,10 @@ void PoleVaulter::startJumping()
 {
     _hasJumped = true;
     _isJumping = true;
-    current_speed = 0;
+    setSpeed(0);
     setState(static_cast<int>(ZombieState::JUMPING));
-    CCLOG("Zombie start jumping!");
-    cocos2d::AudioEngine::play2d("polevault.mp3", false);
+    LOG_TRACE(ZOMBIES, "Zombie start jumping!");
+    SoundManager::getInstance()->post("polevault.mp3", SoundPriority::HIGH);
 }
 
 // Called when plant dies
@@ -1,7 +1,9 @@
 
 #include "Zombie.h"
+#include "Log.h"
 #include "Plant.h"
-#include "audio/include/AudioEngine.h"
+#include "SoundManager.h"
+#include "PopulationTracker.h"
 
 USING_NS_CC;
 
@@ -14,12 +16,154 @@ bool Zombie::init()
         return false;
     }
 
-    // Enable per-frame update
-    this->scheduleUpdate();
-
+    // No per-sprite update: GameWorld steps every zombie through ZombieLanes
     return true;
 }
 
+Zombie::~Zombie()
+{
+    leaveLanes();
+}
+
+
+// ----------------------------------------------------
+// Lane store
+// ----------------------------------------------------
+
+void Zombie::joinLanes(ZombieLanes* lanes, int row)
+{
+    leaveLanes();
+
+    ZombieLanes::Entry entry;
+    entry.x = this->getPositionX();
+    entry.y = this->getPositionY();
+    entry.speed = current_speed;
+    entry.fall = getLaneFall();
+    entry.timer = accumulated_time;
+    entry.interval = ATTACK_INTERVAL;
+    entry.flags = getLaneFlags();
+    lanes->add(this, &lane_slot, row, entry);
+}
+
+void Zombie::leaveLanes()
+{
+    if (!lane_slot.lanes) return;
+
+    accumulated_time = lane_slot.lanes->getTimer(lane_slot);
+    lane_slot.lanes->remove(&lane_slot);
+}
+
+void Zombie::joinPopulation(PopulationTracker* tracker, int row)
+{
+    population = tracker;
+    population_row = row;
+}
+
+void Zombie::respawn()
+{
+    leaveLanes();
+    this->stopAllActions();
+
+    population = nullptr;
+    population_row = -1;
+    current_state = 1;
+    _isDying = false;
+    is_dead = false;
+    _isEating = false;
+    _targetPlant = nullptr;
+    current_health = MAX_HEALTH;
+    accumulated_time = 0.0f;
+    current_speed = MOVE_SPEED;
+
+    // The death animation faded the sprite out
+    this->setOpacity(255);
+    this->setVisible(true);
+}
+
+Sprite* Zombie::createLoopingSprite(const AnimationSpec& spec, const Vec2& pos, float scale)
+{
+    // Frames come from the shared library, so a preview costs one sprite and one action
+    auto animation = AnimationLibrary::getInstance()->get(spec);
+    if (!animation) return nullptr;
+
+    auto sp = Sprite::create();
+    if (sp) {
+        sp->setPosition(pos);
+        sp->setScale(scale);
+        sp->runAction(RepeatForever::create(Animate::create(animation)));
+    }
+    return sp;
+}
+
+void Zombie::finishDying()
+{
+    if (isDead()) return;
+
+    is_dead = true;
+    _isDying = false;
+    if (population)
+    {
+        population->onZombieDied(this, population_row);
+    }
+}
+
+uint8_t Zombie::getLaneFlags() const
+{
+    if (is_dead || _isDying)
+        return 0;
+    if (_isEating)
+        return ZombieLanes::TIMER | ZombieLanes::EATS | ZombieLanes::TICKS;
+    return ZombieLanes::MOVES;
+}
+
+void Zombie::syncLane()
+{
+    if (!lane_slot.lanes) return;
+
+    lane_slot.lanes->setFlags(lane_slot, getLaneFlags());
+    lane_slot.lanes->setFall(lane_slot, getLaneFall());
+}
+
+void Zombie::setSpeed(float speed)
+{
+    current_speed = speed;
+    if (lane_slot.lanes)
+    {
+        lane_slot.lanes->setSpeed(lane_slot, speed);
+    }
+}
+
+float Zombie::getAttackTimer() const
+{
+    return lane_slot.lanes ? lane_slot.lanes->getTimer(lane_slot) : accumulated_time;
+}
+
+void Zombie::setAttackTimer(float time)
+{
+    accumulated_time = time;
+    if (lane_slot.lanes)
+    {
+        lane_slot.lanes->setTimer(lane_slot, time);
+    }
+}
+
+float Zombie::getLaneX() const
+{
+    return lane_slot.lanes ? lane_slot.lanes->getX(lane_slot) : this->getPositionX();
+}
+
+void Zombie::setLaneX(float x)
+{
+    if (lane_slot.lanes)
+    {
+        lane_slot.lanes->setX(lane_slot, x);
+    }
+    else
+    {
+        this->setPositionX(x);
+    }
+}
+
 
 // Set zombie state
 void Zombie::setState(int newState)
@@ -29,6 +173,9 @@ void Zombie::setState(int newState)
         current_state = newState;
         setAnimationForState();
     }
+
+    // Eating, dying, throwing... flags may change even when the state value does not
+    syncLane();
 }
 
 
@@ -42,7 +189,7 @@ void Zombie::takeDamage(float damage)
     }
 
     current_health -= static_cast<int>(damage);
-    CCLOG("Zombie took %f damage, remaining health: %d", damage, current_health); // Reduced logging
+    LOG_TRACE(COMBAT, "Zombie took %f damage, remaining health: %d", damage, current_health); // Reduced logging
 
     if (current_health <= 0)
     {
@@ -89,9 +236,9 @@ void Zombie::startEating(Plant* plant)
 {
     _isEating = true;
     _targetPlant = plant;
-    current_speed = 0;
+    setSpeed(0);
     setState(2);
-    CCLOG("Zombie start eating plant!");
+    LOG_TRACE(ZOMBIES, "Zombie start eating plant!");
 
 }
 
@@ -99,47 +246,38 @@ void Zombie::startEating(Plant* plant)
 void Zombie::onPlantDied()
 {
     _isEating = false;
-    current_speed = MOVE_SPEED;
+    setSpeed(MOVE_SPEED);
     _targetPlant = nullptr;
     setState(1);
-    CCLOG("Zombie resume walking");
+    LOG_TRACE(ZOMBIES, "Zombie resume walking");
 }
 
-void Zombie::update(float delta)
+void Zombie::updateLaneTick(float delta)
 {
-    if (is_dead || _isDying)
-        return;   
-    if (_isEating)
-        updateEating(delta);
-    else 
-        updateMoving(delta);      
-}
-
-void Zombie::updateMoving(float delta)
-{
-    float newX = this->getPositionX() - current_speed * delta;
-    this->setPositionX(newX);
+    // Flagged only while eating: stop before the timer advances once the plant is gone
+    if (!_targetPlant || _targetPlant->isDead())
+    {
+        onPlantDied();
+    }
 }
 
-void Zombie::updateEating(float delta)
+void Zombie::bite()
 {
-    if (!_targetPlant || _targetPlant->isDead()) {
+    // Another zombie may have finished the plant earlier in this frame
+    if (!_targetPlant || _targetPlant->isDead())
+    {
         onPlantDied();
         return;
     }
-    accumulated_time += delta;
-    // If eating, deal damage periodically
-    if (accumulated_time >= ATTACK_INTERVAL)
-    {
-        _targetPlant->takeDamage(ATTACK_DAMAGE);
-        cocos2d::AudioEngine::play2d("zombie_eating.mp3");
-        accumulated_time = 0.0f;
 
-        // Check if plant died
-        if (_targetPlant->isDead())
-        {
-            cocos2d::AudioEngine::play2d("zombie_gulp.mp3");
-            onPlantDied();
-        }
+    _targetPlant->takeDamage(ATTACK_DAMAGE);
+    SoundManager::getInstance()->post("zombie_eating.mp3", SoundPriority::LOW);
+    setAttackTimer(0.0f);
+
+    // Check if plant died
+    if (_targetPlant->isDead())
+    {
+        SoundManager::getInstance()->post("zombie_gulp.mp3", SoundPriority::NORMAL);
+        onPlantDied();
     }
-}
\ No newline at end of file
+}
@@ -4,12 +4,14 @@
 #include "cocos2d.h"
 #include "GameObject.h"
 #include "GameDefs.h"
+#include "ZombieLanes.h"
 #include "audio/include/AudioEngine.h"
 #include <vector>
 #include <string>
 
 // Forward declaration
 class Plant;
+class PopulationTracker;
 
 /**
  * @brief Zombie class, inherits from GameObject.
@@ -22,11 +24,44 @@ public:
 
     virtual bool init() = 0;
 
-    virtual void update(float delta);
+    virtual ~Zombie();
 
-    virtual void updateEating(float delta);
+    /**
+     * @brief Enlists the zombie in GameWorld's lane store.
+     * From then on ZombieLanes moves it and runs its attack timer; there is no per-sprite update.
+     * @param row Lawn row the zombie walks in
+     */
+    void joinLanes(ZombieLanes* lanes, int row);
+
+    /** @brief Leaves the lane store, e.g. before the zombie is removed from the scene */
+    void leaveLanes();
+
+    /** @brief Reports this zombie's death to the tracker once its death animation is over */
+    void joinPopulation(PopulationTracker* tracker, int row);
+
+    /**
+     * @brief Puts a recycled zombie back into the state createZombie leaves it in.
+     * Health, flags and speed are restored and the first animation is restarted from the
+     * retained actions. Subclasses reset their own fields and call the base version first.
+     */
+    virtual void respawn();
+
+    /** @brief The zombie was just enlisted on the lawn (entrance sounds and the like) */
+    virtual void onEnterLawn() {}
+
+    /** @brief ZombiePool free list this zombie returns to, or -1 if the pool did not create it */
+    int getPoolKey() const { return pool_key; }
+    void setPoolKey(int key) { pool_key = key; }
+
+    /**
+     * @brief Per-zombie logic for entries flagged ZombieLanes::TICKS.
+     * Runs after ZombieLanes::integrate and before the attack timers advance.
+     * The base version stops eating once the target plant is gone.
+     */
+    virtual void updateLaneTick(float delta);
 
-    virtual void updateMoving(float delta);
+    /** @brief The attack timer of an eating zombie reached ATTACK_INTERVAL */
+    virtual void bite();
 
     void setState(int newState);
 
@@ -72,6 +107,40 @@ public:
     virtual void setSpecialDeath() { /* Default implementation does nothing */ }
 
 protected:
+    /**
+     * @brief ZombieLanes flags for the current state.
+     * Re-read by syncLane() on every state change; the base zombie walks, or eats with a bite timer.
+     */
+    virtual uint8_t getLaneFlags() const;
+
+    /** @brief Downward speed while moving (imps in flight) */
+    virtual float getLaneFall() const { return 0.0f; }
+
+    /** @brief Pushes flags and fall to the lane store after a state change */
+    void syncLane();
+
+    /** @brief End of the death animation: isDead() turns true and the tracker is told, once */
+    void finishDying();
+
+    /** @brief Plain sprite playing spec forever, for previews that need no zombie behind them */
+    static cocos2d::Sprite* createLoopingSprite(const AnimationSpec& spec, const cocos2d::Vec2& pos, float scale);
+
+    float getSpeed() const { return current_speed; }
+    void setSpeed(float speed);
+
+    float getAttackTimer() const;
+    void setAttackTimer(float time);
+
+    /** @brief Position x as integrated by the lane store (the sprite catches up at the end of the frame) */
+    float getLaneX() const;
+    void setLaneX(float x);
+
+    ZombieSlot lane_slot;
+
+    PopulationTracker* population = nullptr;   // Set while the zombie is on the lawn
+    int population_row = -1;
+    int pool_key = -1;
+
     //0 dying
     //1 walking
     //2 eating
@@ -80,7 +149,7 @@ protected:
     bool _isDying = false;
     bool is_dead = false;
     int current_health = 200;
-    float accumulated_time = 0.0f;
+    float accumulated_time = 0.0f;     // Attack timer until the zombie joins the lanes
     bool _isEating = false;
     Plant* _targetPlant = nullptr;
     float current_speed = 20.0f;
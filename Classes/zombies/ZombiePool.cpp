@@ -0,0 +1,163 @@
+#include "ZombiePool.h"
+#include "Log.h"
+#include "NormalZombie.h"
+#include "PoleVaulter.h"
+#include "BucketHeadZombie.h"
+#include "Zomboni.h"
+#include "Gargantuar.h"
+#include "FlagZombie.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+ZombiePool* ZombiePool::instance = nullptr;
+
+ZombiePool* ZombiePool::getInstance()
+{
+    if (!instance)
+    {
+        instance = new (std::nothrow) ZombiePool();
+    }
+    return instance;
+}
+
+ZombiePool::ZombiePool()
+{
+    std::fill(targets, targets + TYPE_COUNT, 0);
+    resetStats();
+}
+
+void ZombiePool::resetStats()
+{
+    stats.hits = 0;
+    stats.misses = 0;
+    stats.releases = 0;
+    stats.in_use = 0;
+    stats.peak_in_use = 0;
+}
+
+void ZombiePool::logStats() const
+{
+    LOG_INFO(ZOMBIES, "ZombiePool: hits=%ld misses=%ld releases=%ld peak=%d",
+        stats.hits, stats.misses, stats.releases, stats.peak_in_use);
+}
+
+Zombie* ZombiePool::createZombie(WaveZombie type)
+{
+    Zombie* z = nullptr;
+    switch (type)
+    {
+        case WaveZombie::NORMAL:       z = NormalZombie::createZombie(); break;
+        case WaveZombie::POLE_VAULTER: z = PoleVaulter::createZombie(); break;
+        case WaveZombie::BUCKET_HEAD:  z = BucketHeadZombie::createZombie(); break;
+        case WaveZombie::ZOMBONI:      z = Zomboni::createZombie(); break;
+        case WaveZombie::GARGANTUAR:   z = Gargantuar::createZombie(); break;
+        case WaveZombie::FLAG:         z = FlagZombie::createZombie(); break;
+        default: break;
+    }
+    if (z)
+    {
+        z->setPoolKey(static_cast<int>(type));
+    }
+    return z;
+}
+
+void ZombiePool::plan(const WaveSchedule& schedule)
+{
+    for (int t = 0; t < TYPE_COUNT; ++t)
+    {
+        targets[t] = schedule.getPeakSpawns(static_cast<WaveZombie>(t), ZOMBIE_POOL_WINDOW);
+
+        // A lighter level than the last one: keep only what this one needs
+        auto& list = free_lists[t];
+        while (static_cast<int>(list.size()) > targets[t])
+        {
+            list.back()->release();
+            list.pop_back();
+        }
+    }
+    LOG_DEBUG(ZOMBIES, "ZombiePool: targets normal %d, pole %d, bucket %d, zomboni %d, gargantuar %d, flag %d",
+        targets[0], targets[1], targets[2], targets[3], targets[4], targets[5]);
+}
+
+int ZombiePool::prewarm(int budget)
+{
+    int missing = 0;
+    for (int t = 0; t < TYPE_COUNT; ++t)
+    {
+        auto& list = free_lists[t];
+        while (static_cast<int>(list.size()) < targets[t] && budget > 0)
+        {
+            Zombie* zombie = createZombie(static_cast<WaveZombie>(t));
+            if (!zombie) break;
+
+            // Off the lawn nothing should tick; respawn restarts the first animation on acquire
+            zombie->stopAllActions();
+            zombie->retain();
+            list.push_back(zombie);
+            --budget;
+        }
+        missing += std::max(0, targets[t] - static_cast<int>(list.size()));
+    }
+    return missing;
+}
+
+Zombie* ZombiePool::acquire(WaveZombie type)
+{
+    auto& list = free_lists[static_cast<int>(type)];
+    Zombie* zombie = nullptr;
+
+    if (!list.empty())
+    {
+        zombie = list.back();
+        list.pop_back();
+        zombie->respawn();
+        // Hand the pool's reference over to the caller, like createZombie() does
+        zombie->autorelease();
+        ++stats.hits;
+    }
+    else
+    {
+        zombie = createZombie(type);
+        if (!zombie) return nullptr;
+        ++stats.misses;
+    }
+
+    ++stats.in_use;
+    stats.peak_in_use = std::max(stats.peak_in_use, stats.in_use);
+    return zombie;
+}
+
+void ZombiePool::release(Zombie* zombie)
+{
+    if (!zombie) return;
+
+    int key = zombie->getPoolKey();
+    if (key < 0 || key >= TYPE_COUNT)
+    {
+        zombie->removeFromParentAndCleanup(true);
+        return;
+    }
+
+    // Keep our own reference before the parent drops its one; cleanup stops every action
+    zombie->retain();
+    zombie->removeFromParentAndCleanup(true);
+    free_lists[key].push_back(zombie);
+
+    ++stats.releases;
+    if (stats.in_use > 0) --stats.in_use;
+}
+
+void ZombiePool::clear()
+{
+    for (auto& list : free_lists)
+    {
+        for (auto zombie : list)
+        {
+            zombie->release();
+        }
+        list.clear();
+    }
+    std::fill(targets, targets + TYPE_COUNT, 0);
+    stats.in_use = 0;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "cocos2d.h"
+#include "WaveSchedule.h"
+#include <vector>
+
+class Zombie;
+
+/**
+ * @brief Singleton recycling pool for the zombies the wave schedule spawns, one free list per type.
+ *
+ * Building a zombie slices nothing any more (AnimationLibrary caches the sheets), but it still
+ * allocates the sprite and creates and retains every RepeatForever/Animate of its type. The pool
+ * does that work ahead of time, during the SelectCardsScene countdown, and takes zombies back
+ * from GameWorld::removeDeadZombies instead of freeing them.
+ *
+ * Free zombies are detached from the scene graph, so they survive the scene change from the
+ * countdown into the level. The pool holds one reference on every free zombie; an acquired
+ * zombie is returned autoreleased and reset by Zombie::respawn, exactly like createZombie.
+ */
+class ZombiePool
+{
+public:
+    /** @brief Hit/miss counters used to check the planned pool sizes */
+    struct Stats
+    {
+        long hits;          // Acquires served from a free list
+        long misses;        // Acquires that had to create a new zombie
+        long releases;      // Zombies returned to the pool
+        int in_use;         // Pooled zombies currently on the lawn
+        int peak_in_use;    // Highest in_use seen since the last reset
+    };
+
+    /** @brief Access the global zombie pool. */
+    static ZombiePool* getInstance();
+
+    ZombiePool(const ZombiePool&) = delete;
+    ZombiePool& operator=(const ZombiePool&) = delete;
+
+    /**
+     * @brief Sizes every free list from a planned level.
+     * The target of a type is the most zombies of that type the schedule spawns within
+     * ZOMBIE_POOL_WINDOW seconds; free zombies beyond a lower target are dropped.
+     */
+    void plan(const WaveSchedule& schedule);
+
+    /**
+     * @brief Creates up to budget free zombies towards the planned targets.
+     * @return Zombies still missing afterwards (0 once every free list is full)
+     */
+    int prewarm(int budget);
+
+    /** @brief Takes a zombie of the given type from the pool (or creates one), reset to its spawn state */
+    Zombie* acquire(WaveZombie type);
+
+    /**
+     * @brief Returns a dead zombie to its free list and detaches it from the scene.
+     * Zombies created outside the pool (thrown imps, debug spawns) are only removed from the scene.
+     */
+    void release(Zombie* zombie);
+
+    /** @brief Drops every free zombie */
+    void clear();
+
+    const Stats& getStats() const { return stats; }
+    void resetStats();
+    void logStats() const;
+
+private:
+    ZombiePool();
+    static ZombiePool* instance;
+
+    Zombie* createZombie(WaveZombie type);
+
+    static const int TYPE_COUNT = static_cast<int>(WaveZombie::COUNT);
+
+    std::vector<Zombie*> free_lists[TYPE_COUNT];
+    int targets[TYPE_COUNT];
+    Stats stats;
+};
+
+// Seconds of spawns one pooled zombie is expected to cover (roughly one walk across the lawn)
+const float ZOMBIE_POOL_WINDOW = 30.0f;
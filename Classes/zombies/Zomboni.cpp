@@ -1,23 +1,12 @@
 
 #include "Zomboni.h"
+#include "Log.h"
 #include "Plant.h"
 #include "GameWorld.h"
-#include "audio/include/AudioEngine.h"
+#include "SoundManager.h"
 
 USING_NS_CC;
 
-Sprite* Zomboni::createShowcaseSprite(const Vec2& pos)
-{
-    auto sp = Sprite::create();
-    if (sp) {
-        sp->setScale(0.45f);
-        sp->setPosition(pos);
-        sp->runAction(_driveAction);
-    }
-    return sp;
-}
-
-
 const float Zomboni::MOVE_SPEED = 20.0f;
 const float Zomboni::ICE_STEP = 10.0f;
 const int Zomboni::ICE_COUNT = 15;
@@ -32,14 +21,14 @@ Zomboni::Zomboni()
     , _iceIndex(0)
     , _hasBeenAttackedBySpike(false)
 {
-    CCLOG("Zombie created.");
+    LOG_TRACE(LIFECYCLE, "Zombie created.");
 }
 
 // Destructor
 Zomboni::~Zomboni()
 {
     CC_SAFE_RELEASE(_driveAction);
-    CCLOG("Zombie destroyed.");
+    LOG_TRACE(LIFECYCLE, "Zombie destroyed.");
 }
 
 // Initialization function
@@ -51,16 +40,36 @@ bool Zomboni::init()
         return false;
     }
 
-    // Enable per-frame update
-    cocos2d::AudioEngine::play2d("zomboni.mp3");
-    this->current_health = MAX_HEALTH;
-    this->_hasBeenAttackedBySpike = false; // Reset spike attack flag on initialization
     this->setScale(0.45f);
-    this->scheduleUpdate();
 
     return true;
 }
 
+// Sprite sheet slicing
+const AnimationSpec Zomboni::DRIVE_ANIMATION = AnimationSpec::grid("zomboni_drive_spritesheet.png", 470.0f, 450.0f, 3, 4, 12, 0.08f);
+const AnimationSpec Zomboni::SPECIAL_ANIMATION = AnimationSpec::grid("zomboni_special_spritesheet.png", 600.0f, 525.0f, 2, 6, 12, 0.08f);
+
+std::vector<AnimationSpec> Zomboni::getAnimationSpecs()
+{
+    return { DRIVE_ANIMATION, SPECIAL_ANIMATION };
+}
+
+// Warm the shared animations so the first spawn does not slice sheets
+void Zomboni::preloadAnimations()
+{
+    AnimationLibrary::getInstance()->warm(getAnimationSpecs());
+}
+
+AnimationSpec Zomboni::getShowcaseSpec()
+{
+    return DRIVE_ANIMATION;
+}
+
+Sprite* Zomboni::createShowcaseSprite(const Vec2& pos)
+{
+    return createLoopingSprite(DRIVE_ANIMATION, pos, 0.45f);
+}
+
 // Static factory method to create zombie with animations
 Zomboni* Zomboni::createZombie()
 {
@@ -70,17 +79,34 @@ Zomboni* Zomboni::createZombie()
         z->autorelease();
         z->initDriveAnimation();
         z->initSpecialDieAnimation();
-        z->runAction(z->_driveAction);
+        z->respawn();
         return z;
     }
     delete z;
     return nullptr;
 }
 
+void Zomboni::respawn()
+{
+    Zombie::respawn();
+    this->current_health = MAX_HEALTH;
+    this->_hasBeenAttackedBySpike = false; // Reset spike attack flag for the new run
+    _iceAccumulate = 0.0f;
+    _iceIndex = 0;
+    current_state = static_cast<int>(ZombieState::DRIVING);
+    this->runAction(_driveAction);
+}
+
+void Zomboni::onEnterLawn()
+{
+    // Played on the lawn rather than in init, so pooled zomboni stay silent while pre-warmed
+    SoundManager::getInstance()->post("zomboni.mp3", SoundPriority::NORMAL);
+}
+
 // Initialize walking animation
 void Zomboni::initDriveAnimation()
 {
-    auto animation = initAnimate("zomboni_drive_spritesheet.png", 470.0f, 450.0f, 3, 4, 12, 0.08f);
+    auto animation = initAnimate(DRIVE_ANIMATION);
     auto animate = Animate::create(animation);
     this->_driveAction = RepeatForever::create(animate);
     _driveAction->retain();
@@ -89,20 +115,23 @@ void Zomboni::initDriveAnimation()
 // Initialize eating animation
 void Zomboni::initSpecialDieAnimation()
 {
-    auto animation = initAnimate("zomboni_special_spritesheet.png", 600.0f, 525.0f, 2, 6, 12, 0.08f);
+    auto animation = initAnimate(SPECIAL_ANIMATION);
     this->_specialDieAction = Animate::create(animation);
     _specialDieAction->retain();
 }
 
-// Update every frame
-void Zomboni::update(float delta)
+uint8_t Zomboni::getLaneFlags() const
 {
     if (is_dead || _isDying)
-        return;
+        return 0;
+    // Keeps driving while it crushes a plant; ice and crushing run in the tick
+    return ZombieLanes::MOVES | ZombieLanes::TICKS;
+}
 
-    float dx = current_speed * delta;
-    float newX = this->getPositionX() - dx;
-    this->setPositionX(newX);
+void Zomboni::updateLaneTick(float delta)
+{
+    // Distance ZombieLanes drove this frame
+    float dx = getSpeed() * delta;
 
     // Accumulate movement distance
     _iceAccumulate += dx;
@@ -113,9 +142,9 @@ void Zomboni::update(float delta)
         spawnIce();   // Lay a piece of ice
     }
 
-    if (newX < -100)
+    if (getLaneX() < -100)
     {
-        CCLOG("Zombie reached the house!");
+        LOG_DEBUG(ZOMBIES, "Zombie reached the house!");
     }
 
     if (_isEating)
@@ -125,7 +154,8 @@ void Zomboni::update(float delta)
             _targetPlant->takeDamage(10000.0f);
             _isEating = false;
             _targetPlant = nullptr;
-            this->current_speed = MOVE_SPEED;
+            this->setSpeed(MOVE_SPEED);
+            syncLane();
         }
     }
 }
@@ -139,7 +169,7 @@ void Zomboni::setAnimationForState()
     switch (static_cast<ZombieState>(current_state))
     {
     case ZombieState::DRIVING:
-        CCLOG("Setting DRIVING animation.");
+        LOG_TRACE(ZOMBIES, "Setting DRIVING animation.");
         this->stopAllActions();
         this->runAction(_driveAction);
         break;
@@ -149,17 +179,16 @@ void Zomboni::setAnimationForState()
         this->stopAllActions();
         auto fadeOut = FadeOut::create(0.5f);
         auto markDead = CallFunc::create([this]() {
-            is_dead = true;
-            _isDying = false;
-            CCLOG("Zombie death animation finished, marked as dead.");
+            finishDying();
+            LOG_TRACE(ZOMBIES, "Zombie death animation finished, marked as dead.");
             });
         auto sequence = Sequence::create(fadeOut, markDead, nullptr);
         this->runAction(sequence);
         break;
     }
     case ZombieState::SPECIAL:
-        CCLOG("settting special animation");
-        cocos2d::AudioEngine::play2d("Explosion.mp3");
+        LOG_TRACE(ZOMBIES, "settting special animation");
+        SoundManager::getInstance()->post("Explosion.mp3", SoundPriority::HIGH);
         this->stopAllActions();
         this->_isDying = true;
         this->runAction(Sequence::create(_specialDieAction, CallFunc::create([this]() {
@@ -181,12 +210,13 @@ void Zomboni::spawnIce()
     Rect iceRect(rectX, 0, ICE_STEP, 90.0f); // 90 = ice image height
 
     // Create ice sprite
-    auto ice = IceTile::create(this->getPosition(), _iceIndex);
+    // The sprite catches up with the lane position at the end of the frame
+    auto ice = IceTile::create(Vec2(getLaneX(), this->getPositionY()), _iceIndex);
     if (!ice) return;
 
 
     // Hand over to GameWorld management
-    auto gameWorld = static_cast<GameWorld*>(this->getParent());
+    auto gameWorld = static_cast<GameWorld*>(this->getScene());
     if (gameWorld)
     {
         gameWorld->addIceTile(ice);
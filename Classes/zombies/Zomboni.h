@@ -42,14 +42,34 @@ public:
      */
     static Zomboni* createZombie();
 
-    // 选卡展示静态图
-    cocos2d::Sprite* createShowcaseSprite(const cocos2d::Vec2& pos);
+    /** @brief Sprite sheet slicing of every animation createZombie builds */
+    static std::vector<AnimationSpec> getAnimationSpecs();
 
     /**
-     * @brief Update function called every frame for movement, attack, death, etc.
+     * @brief Builds the shared animations used by createZombie ahead of the first spawn
+     */
+    static void preloadAnimations();
+
+    /** @brief Back to the spawn state for ZombiePool reuse */
+    virtual void respawn() override;
+
+    /** @brief Engine sound as the zomboni drives onto the lawn */
+    virtual void onEnterLawn() override;
+
+    /** @brief Animation of the card selection preview, e.g. to fetch its sheet ahead of time */
+    static AnimationSpec getShowcaseSpec();
+
+    /**
+     * @brief Looping preview sprite for the card selection scene.
+     * Built from the cached showcase frames only; no zombie is constructed.
+     */
+    static cocos2d::Sprite* createShowcaseSprite(const cocos2d::Vec2& pos);
+
+    /**
+     * @brief Lays ice behind the distance driven this frame and crushes the plant it ran into
      * @param delta Time delta
      */
-    virtual void update(float delta) override;
+    virtual void updateLaneTick(float delta) override;
 
     /**
      * @brief Get coin drop bonus multiplier for this zombie type
@@ -69,6 +89,12 @@ public:
     
     virtual bool hasBeenAttackedBySpike() const override { return _hasBeenAttackedBySpike; }
 protected:
+    virtual uint8_t getLaneFlags() const override;
+
+    // Sprite sheet slicing of each animation, shared through AnimationLibrary
+    static const AnimationSpec DRIVE_ANIMATION;
+    static const AnimationSpec SPECIAL_ANIMATION;
+
     // Protected constructor
     Zomboni();
 
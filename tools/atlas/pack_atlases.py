@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+"""
+Build-time texture atlas packer.
+
+Reads atlas_config.json, slices the listed grid sprite sheets into cells and collects the
+listed loose frame images, trims transparent borders, shelf-packs everything into
+power-of-two pages and writes cocos2d-x plist (format 2) atlases plus an index:
+
+    Resources/atlas/<name>-<page>.png / .plist
+    Resources/atlas/index.plist          read by SpriteAtlas at startup:
+        atlases  plist -> page texture
+        sources  original file -> plists holding its frames (registered on first use)
+
+Frame names match what the game asks SpriteAtlas for:
+    grid sheet cells  "<sheet file>#<cell index>"   (index = row * cols + col)
+    loose images      "<path relative to Resources>"
+
+The "offset" / "sourceSize" / "sourceColorRect" keys carry the trim metadata, so trimmed
+frames are drawn exactly where the untrimmed cell was. Like every plist they are in pixels;
+the config's content_scale is the pixels-per-point factor the sheets were authored for.
+
+Usage (from the repository root, needs Pillow):
+    python3 tools/atlas/pack_atlases.py [--config FILE] [--resources DIR] [--max-size N]
+"""
+
+import argparse
+import glob
+import json
+import math
+import os
+import plistlib
+import sys
+
+try:
+    from PIL import Image
+except ImportError:
+    sys.exit("pack_atlases.py needs Pillow (pip install pillow)")
+
+INDEX_NAME = "index.plist"
+INDEX_VERSION = 1
+
+
+class Frame(object):
+    def __init__(self, source, name, image, source_w, source_h):
+        self.source = source
+        self.name = name
+        self.source_w = source_w
+        self.source_h = source_h
+        # Trim to the opaque bounding box; a fully transparent cell keeps one pixel
+        bbox = image.getchannel("A").getbbox() or (0, 0, 1, 1)
+        self.trim_x, self.trim_y = bbox[0], bbox[1]
+        self.image = image.crop(bbox)
+        self.w, self.h = self.image.size
+        self.page = None
+        self.x = self.y = 0
+
+
+def load_rgba(path):
+    image = Image.open(path)
+    image.load()
+    return image.convert("RGBA")
+
+
+def sheet_frames(resources, sheet, scale):
+    """Cells of a grid sheet, sliced the same way AnimationLibrary slices them.
+    Cell sizes are in points, as in the game code; scale converts them to sheet pixels."""
+    # "path" overrides the on-disk name when the game refers to the file with other casing
+    path = os.path.join(resources, sheet.get("path", sheet["file"]))
+    if not os.path.isfile(path):
+        print("warning: %s not found, skipped" % sheet["file"])
+        return []
+    image = load_rgba(path)
+    fw, fh = float(sheet["frame_width"]) * scale, float(sheet["frame_height"]) * scale
+    rows, cols = int(sheet["rows"]), int(sheet["cols"])
+    count = min(int(sheet.get("count", rows * cols)), rows * cols)
+
+    frames = []
+    for index in range(count):
+        left = int(round((index % cols) * fw))
+        top = int(round((index // cols) * fh))
+        right = min(int(round(left + fw)), image.width)
+        bottom = min(int(round(top + fh)), image.height)
+        if right <= left or bottom <= top:
+            print("warning: %s cell %d is outside the image" % (sheet["file"], index))
+            continue
+        cell = image.crop((left, top, right, bottom))
+        frames.append(Frame(sheet["file"], "%s#%d" % (sheet["file"], index), cell, right - left, bottom - top))
+    return frames
+
+
+def image_frames(resources, pattern):
+    """Loose images matching a glob relative to the resources directory."""
+    frames = []
+    for path in sorted(glob.glob(os.path.join(resources, pattern))):
+        name = os.path.relpath(path, resources).replace(os.sep, "/")
+        image = load_rgba(path)
+        frames.append(Frame(name, name, image, image.width, image.height))
+    if not frames:
+        print("warning: no images match %s" % pattern)
+    return frames
+
+
+def next_pot(value):
+    return 1 << max(0, int(math.ceil(math.log(max(value, 1), 2))))
+
+
+def pack(frames, max_size, padding):
+    """Shelf packing, tallest first. Returns a list of (width, height, frames) pages."""
+    pending = sorted(frames, key=lambda f: (f.h, f.w), reverse=True)
+    pages = []
+    while pending:
+        placed, rest = [], []
+        shelf_x = shelf_y = shelf_h = used_w = 0
+        for frame in pending:
+            if frame.w + padding > max_size or frame.h + padding > max_size:
+                print("warning: %s (%dx%d) exceeds the page size, left loose" % (frame.name, frame.w, frame.h))
+                continue
+            if shelf_x + frame.w + padding > max_size:
+                shelf_y += shelf_h
+                shelf_x = shelf_h = 0
+            if shelf_y + frame.h + padding > max_size:
+                rest.append(frame)
+                continue
+            frame.x, frame.y = shelf_x, shelf_y
+            shelf_x += frame.w + padding
+            shelf_h = max(shelf_h, frame.h + padding)
+            used_w = max(used_w, shelf_x)
+            placed.append(frame)
+        if not placed:
+            break
+        pages.append((next_pot(used_w), next_pot(shelf_y + shelf_h), placed))
+        pending = rest
+    return pages
+
+
+def frame_entry(frame):
+    # cocos offsets are measured from the cell centre, y up
+    offset_x = frame.trim_x + frame.w / 2.0 - frame.source_w / 2.0
+    offset_y = frame.source_h / 2.0 - (frame.trim_y + frame.h / 2.0)
+    return {
+        "frame": "{{%d,%d},{%d,%d}}" % (frame.x, frame.y, frame.w, frame.h),
+        "offset": "{%g,%g}" % (offset_x, offset_y),
+        "rotated": False,
+        "sourceColorRect": "{{%d,%d},{%d,%d}}" % (frame.trim_x, frame.trim_y, frame.w, frame.h),
+        "sourceSize": "{%d,%d}" % (frame.source_w, frame.source_h),
+    }
+
+
+def write_atlas(out_dir, name, pages, index):
+    """Writes every page and records it in the index."""
+    for number, (width, height, frames) in enumerate(pages):
+        base = "%s-%d" % (name, number)
+        texture = Image.new("RGBA", (width, height), (0, 0, 0, 0))
+        for frame in frames:
+            texture.paste(frame.image, (frame.x, frame.y))
+        texture.save(os.path.join(out_dir, base + ".png"), optimize=True)
+
+        plist = {
+            "frames": dict((frame.name, frame_entry(frame)) for frame in frames),
+            "metadata": {
+                "format": 2,
+                "realTextureFileName": base + ".png",
+                "size": "{%d,%d}" % (width, height),
+                "textureFileName": base + ".png",
+            },
+        }
+        with open(os.path.join(out_dir, base + ".plist"), "wb") as f:
+            plistlib.dump(plist, f)
+        plist_path = "atlas/%s.plist" % base
+        index["atlases"][plist_path] = "atlas/%s.png" % base
+        for frame in frames:
+            plists = index["sources"].setdefault(frame.source, [])
+            if plist_path not in plists:
+                plists.append(plist_path)
+        print("%s: %dx%d, %d frames" % (base, width, height, len(frames)))
+
+
+def main():
+    root = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", ".."))
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--config", default=os.path.join(root, "tools", "atlas", "atlas_config.json"))
+    parser.add_argument("--resources", default=os.path.join(root, "Resources"))
+    parser.add_argument("--max-size", type=int, default=None, help="page size limit (power of two)")
+    args = parser.parse_args()
+
+    with open(args.config) as f:
+        config = json.load(f)
+    max_size = args.max_size or int(config.get("max_size", 2048))
+    padding = int(config.get("padding", 2))
+    scale = float(config.get("content_scale", 1.0))
+
+    out_dir = os.path.join(args.resources, "atlas")
+    if not os.path.isdir(out_dir):
+        os.makedirs(out_dir)
+
+    source_bytes = packed_bytes = 0
+    index = {"version": INDEX_VERSION, "atlases": {}, "sources": {}}
+    for atlas in config["atlases"]:
+        frames = []
+        sources = set()
+        for sheet in atlas.get("sheets", []):
+            found = sheet_frames(args.resources, sheet, scale)
+            frames.extend(found)
+            if found:
+                sources.add(sheet.get("path", sheet["file"]))
+        for pattern in atlas.get("images", []):
+            found = image_frames(args.resources, pattern)
+            frames.extend(found)
+            sources.update(frame.name for frame in found)
+
+        for source in sources:
+            with Image.open(os.path.join(args.resources, source)) as image:
+                source_bytes += image.width * image.height * 4
+        pages = pack(frames, max_size, padding)
+        packed_bytes += sum(width * height * 4 for width, height, _ in pages)
+        write_atlas(out_dir, atlas["name"], pages, index)
+
+    with open(os.path.join(out_dir, INDEX_NAME), "wb") as f:
+        plistlib.dump(index, f)
+
+    print("RGBA8888 texture memory: %.1f MB loose -> %.1f MB packed"
+          % (source_bytes / 1048576.0, packed_bytes / 1048576.0))
+
+
+if __name__ == "__main__":
+    main()
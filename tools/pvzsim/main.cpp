@@ -0,0 +1,161 @@
+/**
+ * @file main.cpp
+ * @brief Command-line front end of the headless simulator.
+ *
+ * Usage:
+ *   pvzsim --loadout sunflower,peashooter,wallnut [--seed N] [--runs N] [--dt SEC]
+ *          [--night] [--no-mowers] [--max-time SEC] [--threads N] [--quiet]
+ *
+ * Each run uses seed, seed + 1, ... and prints its outcome, counters and timing.
+ * --threads plays the runs on N threads, one whole game per job; a single run gives its per-row
+ * phases the threads instead. Results match --threads 1 exactly.
+ * Build from the repository root with Classes/core and Classes/sim on the include path:
+ *   g++ -std=c++11 -O2 -pthread -IClasses/core -IClasses/sim tools/pvzsim/main.cpp
+ *       Classes/core/WavePlanner.cpp Classes/core/WaveSchedule.cpp Classes/sim/Sim*.cpp
+ *       Classes/sim/JobPool.cpp -o pvzsim
+ */
+
+#include "SimWorld.h"
+#include "SimPlayer.h"
+#include "JobPool.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const char* outcomeName(SimOutcome outcome)
+    {
+        switch (outcome)
+        {
+            case SimOutcome::WIN:     return "win";
+            case SimOutcome::LOSE:    return "lose";
+            case SimOutcome::TIMEOUT: return "timeout";
+            default:                  return "running";
+        }
+    }
+
+    void printUsage()
+    {
+        std::printf("usage: pvzsim --loadout name,name,... [--seed N] [--runs N] [--dt SEC]\n"
+                    "              [--night] [--no-mowers] [--max-time SEC] [--threads N] [--quiet]\n"
+                    "plants:");
+        for (int i = 0; i < SIM_PLANT_KIND_COUNT; ++i)
+        {
+            std::printf(" %s", SimRules::plantId(static_cast<PlantName>(i)));
+        }
+        std::printf("\n");
+    }
+
+    bool parseLoadout(const std::string& text, std::vector<PlantName>& out)
+    {
+        std::stringstream ss(text);
+        std::string item;
+        while (std::getline(ss, item, ','))
+        {
+            if (item.empty()) continue;
+            PlantName name = SimRules::parsePlantName(item);
+            if (name == PlantName::UNKNOWN)
+            {
+                std::fprintf(stderr, "unknown plant '%s'\n", item.c_str());
+                return false;
+            }
+            out.push_back(name);
+        }
+        return !out.empty();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    SimConfig config;
+    int runs = 1;
+    int threads = 1;
+    bool quiet = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--loadout" && hasValue)
+        {
+            if (!parseLoadout(argv[++i], config.loadout)) { printUsage(); return 2; }
+        }
+        else if (arg == "--seed" && hasValue)      config.seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--runs" && hasValue)      runs = std::atoi(argv[++i]);
+        else if (arg == "--dt" && hasValue)        config.dt = static_cast<float>(std::atof(argv[++i]));
+        else if (arg == "--max-time" && hasValue)  config.max_time_sec = static_cast<float>(std::atof(argv[++i]));
+        else if (arg == "--threads" && hasValue)   threads = std::atoi(argv[++i]);
+        else if (arg == "--night")                 config.night_mode = true;
+        else if (arg == "--no-mowers")             config.mowers = false;
+        else if (arg == "--quiet")                 quiet = true;
+        else
+        {
+            printUsage();
+            return arg == "--help" ? 0 : 2;
+        }
+    }
+
+    if (config.loadout.empty() || runs < 1 || config.dt <= 0.0f || threads < 1)
+    {
+        printUsage();
+        return 2;
+    }
+
+    struct Run
+    {
+        SimResult result;
+        double ms;
+    };
+
+    // A step is well under a microsecond, too little to share; whole games are worth a job each.
+    // Only a single run hands the threads to its per-row phases
+    config.threads = runs == 1 ? threads : 1;
+    const uint64_t firstSeed = config.seed;
+    std::vector<Run> results(runs);
+
+    auto start = std::chrono::steady_clock::now();
+    JobPool pool(runs == 1 ? 1 : threads);
+    pool.parallelFor(runs, [&](int run) {
+        SimConfig runConfig = config;
+        runConfig.seed = firstSeed + static_cast<uint64_t>(run);
+        SimWorld world(runConfig);
+        SimReferencePlayer player;
+
+        auto runStart = std::chrono::steady_clock::now();
+        results[run].result = world.run(&player);
+        auto runEnd = std::chrono::steady_clock::now();
+        results[run].ms = std::chrono::duration<double, std::milli>(runEnd - runStart).count();
+    });
+    auto end = std::chrono::steady_clock::now();
+    double totalMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    int wins = 0;
+    long totalSteps = 0;
+    for (int run = 0; run < runs; ++run)
+    {
+        const SimResult& result = results[run].result;
+        if (result.outcome == SimOutcome::WIN) ++wins;
+        totalSteps += result.steps;
+
+        if (!quiet)
+        {
+            const SimStats& s = result.stats;
+            std::printf("seed=%llu outcome=%s time=%.1fs steps=%ld spawned=%d killed=%d peak=%d "
+                        "placed=%d lost=%d sun=%d/%d mowers=%d shots=%ld hits=%ld wall=%.2fms\n",
+                        static_cast<unsigned long long>(firstSeed + run), outcomeName(result.outcome),
+                        result.sim_time_sec, result.steps, s.zombies_spawned, s.zombies_killed, s.peak_zombies,
+                        s.plants_placed, s.plants_lost, s.sun_spent, s.sun_collected, s.mowers_triggered,
+                        s.bullets_fired, s.bullet_hits, results[run].ms);
+        }
+    }
+
+    double stepsPerSec = totalMs > 0.0 ? totalSteps / (totalMs / 1000.0) : 0.0;
+    std::printf("runs=%d wins=%d (%.1f%%) wall=%.2fms steps/s=%.0f\n",
+                runs, wins, 100.0 * wins / runs, totalMs, stepsPerSec);
+    return 0;
+}
@@ -0,0 +1,420 @@
+/**
+ * @file main.cpp
+ * @brief Balance sweep: runs the headless simulator over a matrix of loadouts, seeds and rule
+ * overrides on every core, and prints one summary line per configuration.
+ *
+ * Usage:
+ *   pvzsweep --loadout name,name,... [--loadout ...] [--set key=v1,v2,...] [--set ...]
+ *            [--seeds N] [--seed FIRST] [--threads N] [--dt SEC] [--max-time SEC]
+ *            [--curve-step SEC] [--night] [--no-mowers] [--csv]
+ *
+ * Every loadout is crossed with every combination of --set values, and each configuration
+ * runs seeds FIRST .. FIRST + N - 1 with the reference player. Keys of --set:
+ *   <plant>.cost | .cooldown | .health | .interval          e.g. sunflower.cost=25,50,75
+ *   <zombie>.health | .armor | .speed | .damage             e.g. bucket.armor=800,1000
+ *   wave<1-3>.normal_min | .normal_max | .pole | .bucket | .zomboni | .gargantuar | .interval
+ *   sky_sun.value | sky_sun.interval | pea.damage | puff.damage | initial_sun
+ * Columns: win and loss rates, mean level time of lost runs (time survived), sun collected and
+ * spent, mowers triggered per run, and the mean sun collected by every --curve-step seconds.
+ * Output does not depend on --threads.
+ * Build from the repository root with Classes/core and Classes/sim on the include path:
+ *   g++ -std=c++11 -O2 -pthread -IClasses/core -IClasses/sim tools/pvzsweep/main.cpp
+ *       Classes/core/WavePlanner.cpp Classes/core/WaveSchedule.cpp Classes/sim/Sim*.cpp
+ *       Classes/sim/JobPool.cpp -o pvzsweep
+ */
+
+#include "SimWorld.h"
+#include "SimPlayer.h"
+#include "JobPool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Override
+    {
+        std::string key;
+        double value;
+    };
+
+    struct Axis
+    {
+        std::string key;
+        std::vector<double> values;
+    };
+
+    struct Sweep
+    {
+        std::vector<PlantName> loadout;
+        std::vector<Override> overrides;
+        SimConfig config;
+    };
+
+    struct RunResult
+    {
+        SimResult result;
+        std::vector<int> sun_curve;     // Sun collected by each curve step, while the run lasted
+    };
+
+    void printUsage()
+    {
+        std::printf("usage: pvzsweep --loadout name,name,... [--loadout ...] [--set key=v1,v2,...]\n"
+                    "                [--seeds N] [--seed FIRST] [--threads N] [--dt SEC] [--max-time SEC]\n"
+                    "                [--curve-step SEC] [--night] [--no-mowers] [--csv]\n"
+                    "plants:");
+        for (int i = 0; i < SIM_PLANT_KIND_COUNT; ++i)
+        {
+            std::printf(" %s", SimRules::plantId(static_cast<PlantName>(i)));
+        }
+        std::printf("\nzombies:");
+        for (int i = 0; i < SIM_ZOMBIE_KIND_COUNT; ++i)
+        {
+            std::printf(" %s", SimRules::zombieId(static_cast<SimZombieKind>(i)));
+        }
+        std::printf("\n");
+    }
+
+    std::vector<std::string> split(const std::string& text, char separator)
+    {
+        std::vector<std::string> items;
+        std::stringstream ss(text);
+        std::string item;
+        while (std::getline(ss, item, separator))
+        {
+            if (!item.empty()) items.push_back(item);
+        }
+        return items;
+    }
+
+    bool parseLoadout(const std::string& text, std::vector<PlantName>& out)
+    {
+        for (const auto& item : split(text, ','))
+        {
+            PlantName name = SimRules::parsePlantName(item);
+            if (name == PlantName::UNKNOWN)
+            {
+                std::fprintf(stderr, "unknown plant '%s'\n", item.c_str());
+                return false;
+            }
+            out.push_back(name);
+        }
+        return !out.empty();
+    }
+
+    bool parseAxis(const std::string& text, Axis& out)
+    {
+        size_t equals = text.find('=');
+        if (equals == std::string::npos || equals == 0) return false;
+        out.key = text.substr(0, equals);
+        for (const auto& item : split(text.substr(equals + 1), ','))
+        {
+            out.values.push_back(std::atof(item.c_str()));
+        }
+        return !out.values.empty();
+    }
+
+    /** @brief Applies one override; false for a key that names nothing */
+    bool applyOverride(SimConfig& config, const std::string& key, double value)
+    {
+        size_t dot = key.find('.');
+        std::string owner = key.substr(0, dot);
+        std::string field = dot == std::string::npos ? "" : key.substr(dot + 1);
+        const float f = static_cast<float>(value);
+        const int i = static_cast<int>(value);
+        SimRules& rules = config.rules;
+
+        if (owner == "initial_sun" && field.empty()) { config.initial_sun = i; return true; }
+        if (owner == "sky_sun" && field == "value") { rules.sky_sun_value = i; return true; }
+        if (owner == "sky_sun" && field == "interval") { rules.sky_sun_interval = f; return true; }
+        if (owner == "pea" && field == "damage") { rules.pea_damage = i; return true; }
+        if (owner == "puff" && field == "damage") { rules.puff_damage = i; return true; }
+
+        if (owner.size() == 5 && owner.compare(0, 4, "wave") == 0)
+        {
+            int index = owner[4] - '1';
+            if (index < 0 || index >= WaveRules::PHASE_COUNT) return false;
+            WavePhaseRules& phase = config.waves.phases[index];
+            if (field == "normal_min") { phase.normal_min = i; return true; }
+            if (field == "normal_max") { phase.normal_max = i; return true; }
+            if (field == "pole") { phase.pole_prob = f; return true; }
+            if (field == "bucket") { phase.bucket_head_prob = f; return true; }
+            if (field == "zomboni") { phase.zomboni_prob = f; return true; }
+            if (field == "gargantuar") { phase.gargantuar_prob = f; return true; }
+            if (field == "interval") { phase.interval_sec = f; return true; }
+            return false;
+        }
+
+        PlantName plant = SimRules::parsePlantName(owner);
+        if (plant != PlantName::UNKNOWN)
+        {
+            SimPlantRules& p = rules.plant(plant);
+            if (field == "cost") { p.sun_cost = i; return true; }
+            if (field == "cooldown") { p.packet_cooldown = f; return true; }
+            if (field == "health") { p.max_health = i; return true; }
+            if (field == "interval") { p.interval = f; return true; }
+            return false;
+        }
+
+        for (int k = 0; k < SIM_ZOMBIE_KIND_COUNT; ++k)
+        {
+            SimZombieKind kind = static_cast<SimZombieKind>(k);
+            if (owner != SimRules::zombieId(kind)) continue;
+            SimZombieRules& z = rules.zombie(kind);
+            if (field == "health") { z.health = i; return true; }
+            if (field == "armor") { z.armor = i; return true; }
+            if (field == "speed") { z.speed = f; return true; }
+            if (field == "damage") { z.bite_damage = f; return true; }
+            return false;
+        }
+        return false;
+    }
+
+    /** @brief Every loadout crossed with every combination of axis values */
+    bool buildSweeps(const std::vector<std::vector<PlantName>>& loadouts, const std::vector<Axis>& axes,
+                     const SimConfig& base, std::vector<Sweep>& out)
+    {
+        size_t combinations = 1;
+        for (const auto& axis : axes) combinations *= axis.values.size();
+
+        for (const auto& loadout : loadouts)
+        {
+            for (size_t combination = 0; combination < combinations; ++combination)
+            {
+                Sweep sweep;
+                sweep.loadout = loadout;
+                sweep.config = base;
+                sweep.config.loadout = loadout;
+
+                // The last axis varies fastest
+                size_t rest = combination;
+                std::vector<Override> overrides(axes.size());
+                for (size_t a = axes.size(); a-- > 0;)
+                {
+                    const Axis& axis = axes[a];
+                    Override o = { axis.key, axis.values[rest % axis.values.size()] };
+                    rest /= axis.values.size();
+                    if (!applyOverride(sweep.config, o.key, o.value))
+                    {
+                        std::fprintf(stderr, "unknown key '%s'\n", o.key.c_str());
+                        return false;
+                    }
+                    overrides[a] = o;
+                }
+                sweep.overrides = overrides;
+                out.push_back(sweep);
+            }
+        }
+        return true;
+    }
+
+    RunResult runOne(const SimConfig& config, float curveStep)
+    {
+        SimWorld world(config);
+        SimReferencePlayer player;
+
+        RunResult run;
+        float nextSample = curveStep;
+        while (world.getOutcome() == SimOutcome::RUNNING)
+        {
+            player.act(world);
+            world.step();
+            if (world.getTime() >= nextSample)
+            {
+                run.sun_curve.push_back(world.getStats().sun_collected);
+                nextSample += curveStep;
+            }
+        }
+
+        run.result.outcome = world.getOutcome();
+        run.result.sim_time_sec = world.getTime();
+        run.result.steps = world.getSteps();
+        run.result.stats = world.getStats();
+        return run;
+    }
+
+    std::string describe(const Sweep& sweep)
+    {
+        std::string text;
+        for (size_t i = 0; i < sweep.loadout.size(); ++i)
+        {
+            if (i > 0) text += ',';
+            text += SimRules::plantId(sweep.loadout[i]);
+        }
+        return text;
+    }
+
+    std::string describeOverrides(const Sweep& sweep)
+    {
+        if (sweep.overrides.empty()) return "-";
+        std::string text;
+        char value[32];
+        for (size_t i = 0; i < sweep.overrides.size(); ++i)
+        {
+            if (i > 0) text += ' ';
+            std::snprintf(value, sizeof(value), "%g", sweep.overrides[i].value);
+            text += sweep.overrides[i].key + "=" + value;
+        }
+        return text;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    SimConfig base;
+    std::vector<std::vector<PlantName>> loadouts;
+    std::vector<Axis> axes;
+    int seeds = 20;
+    int threads = static_cast<int>(std::thread::hardware_concurrency());
+    float curveStep = 60.0f;
+    bool csv = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--loadout" && hasValue)
+        {
+            std::vector<PlantName> loadout;
+            if (!parseLoadout(argv[++i], loadout)) { printUsage(); return 2; }
+            loadouts.push_back(loadout);
+        }
+        else if (arg == "--set" && hasValue)
+        {
+            Axis axis;
+            if (!parseAxis(argv[++i], axis)) { printUsage(); return 2; }
+            axes.push_back(axis);
+        }
+        else if (arg == "--seeds" && hasValue)      seeds = std::atoi(argv[++i]);
+        else if (arg == "--seed" && hasValue)       base.seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--threads" && hasValue)    threads = std::atoi(argv[++i]);
+        else if (arg == "--dt" && hasValue)         base.dt = static_cast<float>(std::atof(argv[++i]));
+        else if (arg == "--max-time" && hasValue)   base.max_time_sec = static_cast<float>(std::atof(argv[++i]));
+        else if (arg == "--curve-step" && hasValue) curveStep = static_cast<float>(std::atof(argv[++i]));
+        else if (arg == "--night")                  base.night_mode = true;
+        else if (arg == "--no-mowers")              base.mowers = false;
+        else if (arg == "--csv")                    csv = true;
+        else
+        {
+            printUsage();
+            return arg == "--help" ? 0 : 2;
+        }
+    }
+
+    if (loadouts.empty() || seeds < 1 || base.dt <= 0.0f || curveStep <= 0.0f)
+    {
+        printUsage();
+        return 2;
+    }
+    threads = std::max(1, threads);
+
+    std::vector<Sweep> sweeps;
+    if (!buildSweeps(loadouts, axes, base, sweeps)) { printUsage(); return 2; }
+
+    // One job per game; whole games are independent, so the pool only has to balance their lengths
+    const int total = static_cast<int>(sweeps.size()) * seeds;
+    std::vector<RunResult> runs(total);
+    std::atomic<int> done(0);
+    const int progressEvery = std::max(1, total / 10);
+
+    std::fprintf(stderr, "pvzsweep: %d configurations x %d seeds = %d games on %d threads\n",
+                 static_cast<int>(sweeps.size()), seeds, total, threads);
+    auto start = std::chrono::steady_clock::now();
+
+    JobPool pool(threads);
+    pool.parallelFor(total, [&](int index) {
+        SimConfig config = sweeps[index / seeds].config;
+        config.seed = base.seed + static_cast<uint64_t>(index % seeds);
+        runs[index] = runOne(config, curveStep);
+
+        int finished = done.fetch_add(1) + 1;
+        if (finished % progressEvery == 0)
+        {
+            std::fprintf(stderr, "  %d/%d\n", finished, total);
+        }
+    });
+
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    if (csv)
+    {
+        size_t samples = 0;
+        for (const auto& run : runs) samples = std::max(samples, run.sun_curve.size());
+
+        std::printf("loadout,overrides,runs,win_rate,lose_rate,time_survived,sun_collected,sun_spent,mowers");
+        for (size_t s = 1; s <= samples; ++s) std::printf(",sun_at_%g", s * curveStep);
+        std::printf("\n");
+    }
+    else
+    {
+        std::printf("%-4s %-52s %-28s %5s %6s %6s %8s %8s %8s %6s  %s\n", "cfg", "loadout", "overrides", "runs",
+                    "win%", "lose%", "survived", "sun_in", "sun_out", "mowers", "sun collected by step");
+    }
+
+    for (size_t c = 0; c < sweeps.size(); ++c)
+    {
+        int wins = 0, losses = 0;
+        double lostTime = 0.0, sunIn = 0.0, sunOut = 0.0, mowers = 0.0;
+        std::vector<double> curve;
+        std::vector<int> curveRuns;
+
+        for (int s = 0; s < seeds; ++s)
+        {
+            const RunResult& run = runs[c * seeds + s];
+            const SimResult& r = run.result;
+            if (r.outcome == SimOutcome::WIN) ++wins;
+            if (r.outcome == SimOutcome::LOSE)
+            {
+                ++losses;
+                lostTime += r.sim_time_sec;
+            }
+            sunIn += r.stats.sun_collected;
+            sunOut += r.stats.sun_spent;
+            mowers += r.stats.mowers_triggered;
+
+            if (curve.size() < run.sun_curve.size())
+            {
+                curve.resize(run.sun_curve.size(), 0.0);
+                curveRuns.resize(run.sun_curve.size(), 0);
+            }
+            for (size_t k = 0; k < run.sun_curve.size(); ++k)
+            {
+                curve[k] += run.sun_curve[k];
+                ++curveRuns[k];
+            }
+        }
+
+        double survived = losses > 0 ? lostTime / losses : 0.0;
+        if (csv)
+        {
+            std::printf("\"%s\",\"%s\",%d,%.4f,%.4f,%.1f,%.1f,%.1f,%.3f", describe(sweeps[c]).c_str(),
+                        describeOverrides(sweeps[c]).c_str(), seeds, double(wins) / seeds, double(losses) / seeds,
+                        survived, sunIn / seeds, sunOut / seeds, mowers / seeds);
+            for (size_t k = 0; k < curve.size(); ++k) std::printf(",%.0f", curve[k] / curveRuns[k]);
+            std::printf("\n");
+        }
+        else
+        {
+            std::printf("%-4d %-52s %-28s %5d %6.1f %6.1f %8.1f %8.0f %8.0f %6.2f  ", static_cast<int>(c),
+                        describe(sweeps[c]).c_str(), describeOverrides(sweeps[c]).c_str(), seeds,
+                        100.0 * wins / seeds, 100.0 * losses / seeds, survived, sunIn / seeds, sunOut / seeds,
+                        mowers / seeds);
+            for (size_t k = 0; k < curve.size(); ++k)
+            {
+                std::printf(k == 0 ? "%.0f" : "/%.0f", curve[k] / curveRuns[k]);
+            }
+            std::printf("\n");
+        }
+    }
+
+    std::fprintf(stderr, "pvzsweep: %d games in %.1fs (%.0f games/s)\n", total, seconds, seconds > 0.0 ? total / seconds : 0.0);
+    return 0;
+}
@@ -0,0 +1,288 @@
+/**
+ * @file main.cpp
+ * @brief Per-frame cost of zombie movement: per-sprite update() against ZombieLanes.
+ *
+ * Usage:
+ *   zombie_bench [--frames N] [--eating PERCENT]
+ *
+ * The baseline mirrors the old Zombie::update: one heap node per zombie (padded to the size
+ * of a cocos2d Sprite), reached the way cocos2d's Scheduler reaches a scheduleUpdate target
+ * (a linked list of heap entries holding a std::function), moving itself with setPositionX.
+ * The lane side runs ZombieLanes::integrate and advanceTimers, then writes positions back to
+ * the same kind of nodes the way GameWorld::updateZombieLanes does.
+ * The baseline is a model of the scheduler dispatch, not the real Zombie::update path. Counts
+ * start at 25 because ordinary levels peak around 20-25 zombies; there the extra passes and the
+ * write-back make the lanes slower than the per-sprite loop. Between 500 and 2000 zombies the two
+ * are within run-to-run noise, and the lanes only pull clearly ahead in the thousands.
+ * Build from the repository root with Classes/core on the include path; -O3 (the Release
+ * default) is what lets the compiler vectorize the ZombieLanes loops:
+ *   g++ -std=c++11 -O3 -IClasses/core tools/zombie_bench/main.cpp
+ *       Classes/core/ZombieLanes.cpp -o zombie_bench
+ */
+
+#include "ZombieLanes.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const float DELTA = 1.0f / 60.0f;
+    const float MOVE_SPEED = 20.0f;
+    const float ATTACK_INTERVAL = 0.5f;
+
+    /** @brief Stand-in for cocos2d::Node: a position, a dirty flag and the rest of a Sprite */
+    class MockNode
+    {
+    public:
+        virtual ~MockNode() {}
+        virtual void update(float /*delta*/) {}
+
+        float getPositionX() const { return x; }
+        float getPositionY() const { return y; }
+        void setPosition(float newX, float newY)
+        {
+            // Node::setPosition: skip unchanged positions, otherwise dirty the transforms
+            if (x == newX && y == newY) return;
+            x = newX;
+            y = newY;
+            transform_updated = transform_dirty = inverse_dirty = true;
+        }
+        void setPositionX(float newX) { setPosition(newX, y); }
+
+        float x = 0.0f;
+        float y = 0.0f;
+        bool transform_updated = false;
+        bool transform_dirty = false;
+        bool inverse_dirty = false;
+        char rest_of_sprite[768];
+    };
+
+    /** @brief The old per-sprite zombie */
+    class SpriteZombie : public MockNode
+    {
+    public:
+        void update(float delta) override
+        {
+            if (is_dead) return;
+            if (is_eating)
+            {
+                accumulated_time += delta;
+                if (accumulated_time >= ATTACK_INTERVAL)
+                {
+                    accumulated_time = 0.0f;
+                    ++bites;
+                }
+            }
+            else
+            {
+                setPositionX(getPositionX() - current_speed * delta);
+            }
+        }
+
+        bool is_dead = false;
+        bool is_eating = false;
+        float accumulated_time = 0.0f;
+        float current_speed = MOVE_SPEED;
+        long bites = 0;
+    };
+
+    /** @brief Scheduler's per-target list entry (tListEntry) */
+    struct UpdateEntry
+    {
+        std::function<void(float)> callback;
+        void* target;
+        int priority;
+        bool paused;
+        bool marked_for_deletion;
+        UpdateEntry* prev;
+        UpdateEntry* next;
+    };
+
+    struct Result
+    {
+        double ns_per_frame;
+        long bites;
+    };
+
+    /** @brief Allocates nodes with unrelated allocations in between, as a running scene would */
+    template <typename T>
+    std::vector<std::unique_ptr<T>> makeNodes(int count, std::vector<std::unique_ptr<char[]>>& clutter)
+    {
+        std::vector<std::unique_ptr<T>> nodes;
+        for (int i = 0; i < count; ++i)
+        {
+            nodes.emplace_back(new T());
+            nodes.back()->setPosition(900.0f + (i % 97), 100.0f + (i % MAX_ROW) * 100.0f);
+            clutter.emplace_back(new char[64 + (i % 7) * 48]);
+        }
+        return nodes;
+    }
+
+    Result runSprites(int count, int frames, int eatingPercent)
+    {
+        std::vector<std::unique_ptr<char[]>> clutter;
+        auto zombies = makeNodes<SpriteZombie>(count, clutter);
+
+        // scheduleUpdate() per zombie; entries are allocated as zombies spawn
+        UpdateEntry* head = nullptr;
+        UpdateEntry* tail = nullptr;
+        std::vector<std::unique_ptr<UpdateEntry>> entries;
+        for (int i = 0; i < count; ++i)
+        {
+            SpriteZombie* zombie = zombies[i].get();
+            zombie->is_eating = (i * 100 / count) < eatingPercent;
+
+            entries.emplace_back(new UpdateEntry());
+            UpdateEntry* entry = entries.back().get();
+            entry->callback = [zombie](float delta) { zombie->update(delta); };
+            entry->target = zombie;
+            entry->priority = 0;
+            entry->paused = false;
+            entry->marked_for_deletion = false;
+            entry->prev = tail;
+            entry->next = nullptr;
+            (tail ? tail->next : head) = entry;
+            tail = entry;
+            clutter.emplace_back(new char[32 + (i % 5) * 64]);
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; ++frame)
+        {
+            for (UpdateEntry* entry = head; entry; entry = entry->next)
+            {
+                if (!entry->paused && !entry->marked_for_deletion)
+                {
+                    entry->callback(DELTA);
+                }
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        Result result;
+        result.ns_per_frame = std::chrono::duration<double, std::nano>(end - begin).count() / frames;
+        result.bites = 0;
+        for (const auto& zombie : zombies)
+        {
+            result.bites += zombie->bites;
+        }
+        return result;
+    }
+
+    Result runLanes(int count, int frames, int eatingPercent)
+    {
+        std::vector<std::unique_ptr<char[]>> clutter;
+        auto nodes = makeNodes<MockNode>(count, clutter);
+        std::vector<MockNode*> rowNodes[MAX_ROW];
+        std::vector<ZombieSlot> slots(count);
+
+        ZombieLanes lanes;
+        for (int i = 0; i < count; ++i)
+        {
+            bool eating = (i * 100 / count) < eatingPercent;
+            int row = i % MAX_ROW;
+
+            ZombieLanes::Entry entry;
+            entry.x = nodes[i]->getPositionX();
+            entry.y = nodes[i]->getPositionY();
+            entry.speed = eating ? 0.0f : MOVE_SPEED;
+            entry.fall = 0.0f;
+            entry.timer = 0.0f;
+            entry.interval = ATTACK_INTERVAL;
+            entry.flags = eating ? (ZombieLanes::TIMER | ZombieLanes::EATS) : ZombieLanes::MOVES;
+            lanes.add(nullptr, &slots[i], row, entry);
+            rowNodes[row].push_back(nodes[i].get());
+        }
+
+        long bites = 0;
+        auto begin = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; ++frame)
+        {
+            lanes.integrate(DELTA);
+            lanes.advanceTimers(DELTA);
+
+            for (int row = 0; row < MAX_ROW; ++row)
+            {
+                auto& lane = lanes.getRow(row);
+                const size_t size = lane.size();
+                float* x = lane.x.data();
+                float* y = lane.y.data();
+                float* shownX = lane.shown_x.data();
+                float* shownY = lane.shown_y.data();
+                float* timer = lane.timer.data();
+                const uint8_t* due = lane.due.data();
+                MockNode* const* node = rowNodes[row].data();
+
+                for (size_t i = 0; i < size; ++i)
+                {
+                    if (due[i])
+                    {
+                        timer[i] = 0.0f;
+                        ++bites;
+                    }
+
+                    float nodeX = node[i]->getPositionX();
+                    float nodeY = node[i]->getPositionY();
+                    float newX = x[i] + nodeX - shownX[i];
+                    float newY = y[i] + nodeY - shownY[i];
+                    if (newX != nodeX || newY != nodeY)
+                    {
+                        node[i]->setPosition(newX, newY);
+                    }
+                    x[i] = shownX[i] = newX;
+                    y[i] = shownY[i] = newY;
+                }
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        Result result;
+        result.ns_per_frame = std::chrono::duration<double, std::nano>(end - begin).count() / frames;
+        result.bites = bites;
+        return result;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int frames = 2000;
+    int eatingPercent = 10;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--frames" && i + 1 < argc)
+        {
+            frames = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (arg == "--eating" && i + 1 < argc)
+        {
+            eatingPercent = std::atoi(argv[++i]);
+        }
+        else
+        {
+            std::printf("usage: zombie_bench [--frames N] [--eating PERCENT]\n");
+            return 1;
+        }
+    }
+
+    std::printf("%8s %16s %16s %8s\n", "zombies", "sprites ns/frame", "lanes ns/frame", "speedup");
+    const int counts[] = { 25, 50, 100, 500, 1000, 2000, 5000 };
+    for (int count : counts)
+    {
+        Result sprites = runSprites(count, frames, eatingPercent);
+        Result lanes = runLanes(count, frames, eatingPercent);
+        if (sprites.bites != lanes.bites)
+        {
+            std::printf("bite counts differ at %d zombies: %ld vs %ld\n", count, sprites.bites, lanes.bites);
+        }
+        std::printf("%8d %16.0f %16.0f %7.2fx\n", count, sprites.ns_per_frame, lanes.ns_per_frame,
+            sprites.ns_per_frame / lanes.ns_per_frame);
+    }
+    return 0;
+}